@@ -0,0 +1,197 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   AllocCounter.cpp                                   :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: pdemont <pdemont@student.42lausanne.ch>    +#+  +:+       +#+        */
+/*   By: blucken <blucken@student.42lausanne.ch>  +#+#+#+#+#+   +#+           */
+/*                                                     #+#    #+#             */
+/*   Created: 2026/10/18                              ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+/**
+ * @file AllocCounter.cpp
+ * @brief Implements the AllocCounter class and the allocation hooks.
+ */ 
+
+#include "AllocCounter.hpp"
+#include <cstdlib>
+#include <new>
+
+namespace log42
+{
+namespace bench
+{
+
+unsigned long	AllocCounter::_allocations = 0;
+unsigned long	AllocCounter::_bytes = 0;
+
+/**
+ * @brief Gets the number of allocations made since the process started.
+ *
+ * @return The allocation count.
+ */
+unsigned long	AllocCounter::allocations()
+{
+	return (__sync_fetch_and_add(&_allocations, 0));
+}
+
+/**
+ * @brief Gets the number of bytes requested since the process started.
+ *
+ * @return The allocated byte count.
+ */
+unsigned long	AllocCounter::bytes()
+{
+	return (__sync_fetch_and_add(&_bytes, 0));
+}
+
+/**
+ * @brief Records one allocation.
+ *
+ * @param size The requested size in bytes.
+ */
+void	AllocCounter::record(std::size_t size)
+{
+	__sync_fetch_and_add(&_allocations, 1);
+	__sync_fetch_and_add(&_bytes, size);
+}
+
+} // !bench
+} // !log42
+
+#if defined(__GLIBC__)
+
+/*
+ * glibc exports its allocator under __libc_* names, so the whole malloc
+ * family can be wrapped, which also covers operator new and allocations made
+ * inside the C library (strftime, localtime, stdio buffers).
+ */
+extern "C"
+{
+
+void	*__libc_malloc(std::size_t size);
+void	*__libc_calloc(std::size_t count, std::size_t size);
+void	*__libc_realloc(void *ptr, std::size_t size);
+
+/**
+ * @brief Counting malloc.
+ *
+ * @param size Requested size.
+ * @return The allocated block.
+ */
+void	*malloc(std::size_t size)
+{
+	log42::bench::AllocCounter::record(size);
+	return (__libc_malloc(size));
+}
+
+/**
+ * @brief Counting calloc.
+ *
+ * @param count Number of elements.
+ * @param size Size of an element.
+ * @return The allocated, zeroed block.
+ */
+void	*calloc(std::size_t count, std::size_t size)
+{
+	log42::bench::AllocCounter::record(count * size);
+	return (__libc_calloc(count, size));
+}
+
+/**
+ * @brief Counting realloc; every call that may allocate is counted.
+ *
+ * @param ptr Block to resize, or NULL.
+ * @param size New size.
+ * @return The resized block.
+ */
+void	*realloc(void *ptr, std::size_t size)
+{
+	log42::bench::AllocCounter::record(size);
+	return (__libc_realloc(ptr, size));
+}
+
+} // !extern "C"
+
+#else
+
+/**
+ * @brief Counting operator new.
+ *
+ * @param size Requested size.
+ * @return The allocated block.
+ */
+void	*operator new(std::size_t size) throw(std::bad_alloc)
+{
+	log42::bench::AllocCounter::record(size);
+	void *ptr = std::malloc(size ? size : 1);
+	if (!ptr)
+		throw std::bad_alloc();
+	return (ptr);
+}
+
+/**
+ * @brief Counting operator new[].
+ *
+ * @param size Requested size.
+ * @return The allocated block.
+ */
+void	*operator new[](std::size_t size) throw(std::bad_alloc)
+{
+	return (::operator new(size));
+}
+
+/**
+ * @brief Releases a block from the counting operator new.
+ *
+ * @param ptr The block to release.
+ */
+void	operator delete(void *ptr) throw()
+{
+	std::free(ptr);
+}
+
+/**
+ * @brief Releases a block from the counting operator new[].
+ *
+ * @param ptr The block to release.
+ */
+void	operator delete[](void *ptr) throw()
+{
+	std::free(ptr);
+}
+
+#endif
+
+/* ************************************************************************** */
+/*                                                                            */
+/*                                MIT License                                 */
+/*                                                                            */
+/*   Copyright (c) 2025 Demont Pieric, Lucken Bénédict                        */
+/*                                                                            */
+/*   Inspired by the Python 'logging' module by Vinay Sajip.                  */
+/*   This implementation was rewritten in C++98 and contains no original      */
+/*   Python source code.                                                      */
+/*                                                                            */
+/*   Permission is hereby granted, free of charge, to any person obtaining    */
+/*   a copy of this software and associated documentation files (the          */
+/*   "Software"), to deal in the Software without restriction, including      */
+/*   without limitation the rights to use, copy, modify, merge, publish,      */
+/*   distribute, sublicense, and/or sell copies of the Software, and to       */
+/*   permit persons to whom the Software is furnished to do so, subject to    */
+/*   the following conditions:                                                */
+/*                                                                            */
+/*   The above copyright notice and this permission notice shall be included  */
+/*   in all copies or substantial portions of the Software.                   */
+/*                                                                            */
+/*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS  */
+/*   OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF               */
+/*   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.   */
+/*   IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY     */
+/*   CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,     */
+/*   TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE        */
+/*   SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                   */
+/*                                                                            */
+/* ************************************************************************** */
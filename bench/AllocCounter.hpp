@@ -0,0 +1,100 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   AllocCounter.hpp                                   :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: pdemont <pdemont@student.42lausanne.ch>    +#+  +:+       +#+        */
+/*   By: blucken <blucken@student.42lausanne.ch>  +#+#+#+#+#+   +#+           */
+/*                                                     #+#    #+#             */
+/*   Created: 2026/10/18                              ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef LOG42_BENCH_ALLOCCOUNTER_HPP
+#define LOG42_BENCH_ALLOCCOUNTER_HPP
+
+/**
+ * @file AllocCounter.hpp
+ * @brief Declares the AllocCounter class counting heap allocations of the
+ * benchmark process.
+ */ 
+
+#include <cstddef>
+
+namespace log42
+{
+namespace bench
+{
+
+/**
+ * @class AllocCounter
+ * @brief Process-wide count of heap allocations.
+ *
+ * Linking AllocCounter.cpp into an executable interposes malloc and friends
+ * on glibc, or the global operator new elsewhere, so that every allocation
+ * made by the library is counted. Counters only grow; measure a section by
+ * taking the difference of two snapshots.
+ *
+ * @startuml
+ * class "AllocCounter" as AllocCounter {
+		- {static} _allocations : unsigned long
+		- {static} _bytes : unsigned long
+		--
+		+ {static} allocations() : unsigned long
+		+ {static} bytes() : unsigned long
+		+ {static} record(size : size_t) : void
+	}
+ * @enduml
+ */
+class AllocCounter
+{
+	public:
+		static unsigned long	allocations();
+		static unsigned long	bytes();
+		static void				record(std::size_t size);
+
+	private:
+		static unsigned long	_allocations;
+		static unsigned long	_bytes;
+
+		AllocCounter();
+		~AllocCounter();
+		AllocCounter(const AllocCounter &rhs);
+		AllocCounter &operator=(const AllocCounter &rhs);
+};
+
+} // !bench
+} // !log42
+
+#endif // !LOG42_BENCH_ALLOCCOUNTER_HPP
+
+/* ************************************************************************** */
+/*                                                                            */
+/*                                MIT License                                 */
+/*                                                                            */
+/*   Copyright (c) 2025 Demont Pieric, Lucken Bénédict                        */
+/*                                                                            */
+/*   Inspired by the Python 'logging' module by Vinay Sajip.                  */
+/*   This implementation was rewritten in C++98 and contains no original      */
+/*   Python source code.                                                      */
+/*                                                                            */
+/*   Permission is hereby granted, free of charge, to any person obtaining    */
+/*   a copy of this software and associated documentation files (the          */
+/*   "Software"), to deal in the Software without restriction, including      */
+/*   without limitation the rights to use, copy, modify, merge, publish,      */
+/*   distribute, sublicense, and/or sell copies of the Software, and to       */
+/*   permit persons to whom the Software is furnished to do so, subject to    */
+/*   the following conditions:                                                */
+/*                                                                            */
+/*   The above copyright notice and this permission notice shall be included  */
+/*   in all copies or substantial portions of the Software.                   */
+/*                                                                            */
+/*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS  */
+/*   OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF               */
+/*   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.   */
+/*   IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY     */
+/*   CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,     */
+/*   TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE        */
+/*   SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                   */
+/*                                                                            */
+/* ************************************************************************** */
@@ -0,0 +1,175 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   Bench.cpp                                          :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: pdemont <pdemont@student.42lausanne.ch>    +#+  +:+       +#+        */
+/*   By: blucken <blucken@student.42lausanne.ch>  +#+#+#+#+#+   +#+           */
+/*                                                     #+#    #+#             */
+/*   Created: 2026/10/18                              ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+/**
+ * @file Bench.cpp
+ * @brief Implements the Benchmark and Runner classes.
+ */ 
+
+#include "AllocCounter.hpp"
+#include "Bench.hpp"
+#include "Clock.hpp"
+#include <iomanip>
+
+namespace log42
+{
+namespace bench
+{
+
+/**
+ * @brief Constructs a named benchmark.
+ *
+ * @param name The name reported for the benchmark.
+ */
+Benchmark::Benchmark(const std::string &name) : _name(name) {}
+
+/**
+ * @brief Destructor for Benchmark.
+ */
+Benchmark::~Benchmark() {}
+
+/**
+ * @brief Gets the name of the benchmark.
+ *
+ * @return The benchmark name.
+ */
+const std::string	&Benchmark::getName() const
+{
+	return (this->_name);
+}
+
+/**
+ * @brief Prepares a measured batch. Does nothing by default.
+ */
+void	Benchmark::setUp() {}
+
+/**
+ * @brief Cleans up after a measured batch. Does nothing by default.
+ */
+void	Benchmark::tearDown() {}
+
+/**
+ * @brief Constructs a Runner.
+ *
+ * @param minSeconds Minimum duration of the measured batch.
+ * @param filter Only benchmarks whose name contains it are run.
+ * @param out Stream receiving the JSON lines.
+ */
+Runner::Runner(double minSeconds, const std::string &filter, std::ostream &out) 
+	: _minSeconds(minSeconds), _filter(filter), _out(&out) {}
+
+/**
+ * @brief Destructor for Runner.
+ */
+Runner::~Runner() {}
+
+/**
+ * @brief Measures and reports a benchmark, unless it is filtered out.
+ *
+ * @param bench The benchmark to run.
+ */
+void	Runner::run(Benchmark &bench)
+{
+	if (!this->_filter.empty() && bench.getName().find(this->_filter) == std::string::npos)
+		return ;
+	this->report(this->measure(bench));
+}
+
+/**
+ * @brief Calibrates the iteration count and measures a benchmark.
+ *
+ * @param bench The benchmark to measure.
+ * @return The measurement of the last, long enough, batch.
+ */
+Result	Runner::measure(Benchmark &bench) const
+{
+	Result result;
+	std::size_t iterations = 1;
+
+	result.name = bench.getName();
+	while (true)
+	{
+		bench.setUp();
+		unsigned long allocs = AllocCounter::allocations();
+		unsigned long bytes = AllocCounter::bytes();
+		double start = Clock::nowNs();
+		bench.run(iterations);
+		double elapsed = Clock::nowNs() - start;
+		allocs = AllocCounter::allocations() - allocs;
+		bytes = AllocCounter::bytes() - bytes;
+		bench.tearDown();
+
+		if (elapsed >= this->_minSeconds * 1e9 || iterations >= (1UL << 30))
+		{
+			result.iterations = iterations;
+			result.nsPerOp = elapsed / iterations;
+			result.allocsPerOp = static_cast<double>(allocs) / iterations;
+			result.bytesPerOp = static_cast<double>(bytes) / iterations;
+			return (result);
+		}
+		iterations *= 2;
+	}
+}
+
+/**
+ * @brief Writes a result as a single JSON line.
+ *
+ * @param result The result to write.
+ */
+void	Runner::report(const Result &result)
+{
+	std::ostream &out = *this->_out;
+
+	out << "{\"bench\":\"" << result.name << "\""
+		<< ",\"iterations\":" << result.iterations
+		<< std::fixed << std::setprecision(2)
+		<< ",\"ns_per_op\":" << result.nsPerOp
+		<< std::setprecision(3)
+		<< ",\"allocs_per_op\":" << result.allocsPerOp
+		<< ",\"bytes_per_op\":" << result.bytesPerOp
+		<< "}" << std::endl;
+	out.unsetf(std::ios_base::floatfield);
+}
+
+} // !bench
+} // !log42
+
+/* ************************************************************************** */
+/*                                                                            */
+/*                                MIT License                                 */
+/*                                                                            */
+/*   Copyright (c) 2025 Demont Pieric, Lucken Bénédict                        */
+/*                                                                            */
+/*   Inspired by the Python 'logging' module by Vinay Sajip.                  */
+/*   This implementation was rewritten in C++98 and contains no original      */
+/*   Python source code.                                                      */
+/*                                                                            */
+/*   Permission is hereby granted, free of charge, to any person obtaining    */
+/*   a copy of this software and associated documentation files (the          */
+/*   "Software"), to deal in the Software without restriction, including      */
+/*   without limitation the rights to use, copy, modify, merge, publish,      */
+/*   distribute, sublicense, and/or sell copies of the Software, and to       */
+/*   permit persons to whom the Software is furnished to do so, subject to    */
+/*   the following conditions:                                                */
+/*                                                                            */
+/*   The above copyright notice and this permission notice shall be included  */
+/*   in all copies or substantial portions of the Software.                   */
+/*                                                                            */
+/*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS  */
+/*   OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF               */
+/*   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.   */
+/*   IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY     */
+/*   CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,     */
+/*   TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE        */
+/*   SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                   */
+/*                                                                            */
+/* ************************************************************************** */
@@ -0,0 +1,154 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   Bench.hpp                                          :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: pdemont <pdemont@student.42lausanne.ch>    +#+  +:+       +#+        */
+/*   By: blucken <blucken@student.42lausanne.ch>  +#+#+#+#+#+   +#+           */
+/*                                                     #+#    #+#             */
+/*   Created: 2026/10/18                              ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef LOG42_BENCH_BENCH_HPP
+#define LOG42_BENCH_BENCH_HPP
+
+/**
+ * @file Bench.hpp
+ * @brief Declares the Benchmark and Runner classes of the benchmark suite.
+ */ 
+
+#include <cstddef>
+#include <iostream>
+#include <string>
+
+namespace log42
+{
+namespace bench
+{
+
+/**
+ * @class Benchmark
+ * @brief A named operation measured by the Runner.
+ *
+ * run() performs the operation the given number of times; setUp() and
+ * tearDown() bracket every measured batch and are not timed.
+ *
+ * @startuml
+ * abstract class "Benchmark" as Benchmark {
+		- _name : string
+		--
+		+ Benchmark(name : string)
+		+ getName() : string
+		+ setUp() : void
+		+ {abstract} run(iterations : size_t) : void
+		+ tearDown() : void
+	}
+ * @enduml
+ */
+class Benchmark
+{
+	public:
+		explicit Benchmark(const std::string &name);
+		virtual ~Benchmark();
+
+		const std::string	&getName() const;
+		virtual void		setUp();
+		virtual void		run(std::size_t iterations) = 0;
+		virtual void		tearDown();
+
+	private:
+		std::string	_name;
+
+		Benchmark(const Benchmark &rhs);
+		Benchmark &operator=(const Benchmark &rhs);
+};
+
+/**
+ * @struct Result
+ * @brief Measurement of one benchmark.
+ */
+struct Result
+{
+	std::string		name;
+	unsigned long	iterations;
+	double			nsPerOp;
+	double			allocsPerOp;
+	double			bytesPerOp;
+};
+
+/**
+ * @class Runner
+ * @brief Calibrates, measures and reports benchmarks.
+ *
+ * The iteration count doubles until a batch lasts at least the minimum
+ * time; that batch is the measurement. Each result is written as one JSON
+ * object per line so that runs of two versions can be diffed by tools.
+ *
+ * @startuml
+ * class "Runner" as Runner {
+		- _minSeconds : double
+		- _filter : string
+		- _out : ostream
+		--
+		+ Runner(minSeconds : double, filter : string, out : ostream)
+		+ run(bench : Benchmark) : void
+		+ measure(bench : Benchmark) : Result
+		+ report(result : Result) : void
+	}
+ * @enduml
+ */
+class Runner
+{
+	public:
+		explicit Runner(double minSeconds = 0.2, const std::string &filter = "", std::ostream &out = std::cout);
+		~Runner();
+
+		void			run(Benchmark &bench);
+		Result			measure(Benchmark &bench) const;
+		void			report(const Result &result);
+
+	private:
+		double			_minSeconds;
+		std::string		_filter;
+		std::ostream	*_out;
+
+		Runner(const Runner &rhs);
+		Runner &operator=(const Runner &rhs);
+};
+
+} // !bench
+} // !log42
+
+#endif // !LOG42_BENCH_BENCH_HPP
+
+/* ************************************************************************** */
+/*                                                                            */
+/*                                MIT License                                 */
+/*                                                                            */
+/*   Copyright (c) 2025 Demont Pieric, Lucken Bénédict                        */
+/*                                                                            */
+/*   Inspired by the Python 'logging' module by Vinay Sajip.                  */
+/*   This implementation was rewritten in C++98 and contains no original      */
+/*   Python source code.                                                      */
+/*                                                                            */
+/*   Permission is hereby granted, free of charge, to any person obtaining    */
+/*   a copy of this software and associated documentation files (the          */
+/*   "Software"), to deal in the Software without restriction, including      */
+/*   without limitation the rights to use, copy, modify, merge, publish,      */
+/*   distribute, sublicense, and/or sell copies of the Software, and to       */
+/*   permit persons to whom the Software is furnished to do so, subject to    */
+/*   the following conditions:                                                */
+/*                                                                            */
+/*   The above copyright notice and this permission notice shall be included  */
+/*   in all copies or substantial portions of the Software.                   */
+/*                                                                            */
+/*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS  */
+/*   OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF               */
+/*   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.   */
+/*   IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY     */
+/*   CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,     */
+/*   TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE        */
+/*   SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                   */
+/*                                                                            */
+/* ************************************************************************** */
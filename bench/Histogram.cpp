@@ -0,0 +1,260 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   Histogram.cpp                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: pdemont <pdemont@student.42lausanne.ch>    +#+  +:+       +#+        */
+/*   By: blucken <blucken@student.42lausanne.ch>  +#+#+#+#+#+   +#+           */
+/*                                                     #+#    #+#             */
+/*   Created: 2026/10/18                              ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+/**
+ * @file Histogram.cpp
+ * @brief Implements the Histogram class.
+ */ 
+
+#include "Histogram.hpp"
+#include <climits>
+
+namespace log42
+{
+namespace bench
+{
+
+/**
+ * @brief Number of exact buckets, and of buckets per power of two above them.
+ */
+static const std::size_t	subBuckets = 1UL << Histogram::subBucketBits;
+
+/**
+ * @brief Number of bits of an unsigned long.
+ */
+static const std::size_t	valueBits = sizeof(unsigned long) * CHAR_BIT;
+
+/**
+ * @brief Total number of buckets covering the unsigned long range.
+ */
+static const std::size_t	bucketCount = (valueBits - Histogram::subBucketBits + 1) * subBuckets;
+
+/**
+ * @brief Constructs an empty histogram.
+ */
+Histogram::Histogram() : _counts(bucketCount, 0), _count(0), _min(ULONG_MAX), _max(0), _sum(0) {}
+
+/**
+ * @brief Destructor for Histogram.
+ */
+Histogram::~Histogram() {}
+
+/**
+ * @brief Copy constructor for Histogram.
+ *
+ * @param rhs The Histogram to copy.
+ */
+Histogram::Histogram(const Histogram &rhs) 
+	: _counts(rhs._counts), _count(rhs._count), _min(rhs._min), _max(rhs._max), _sum(rhs._sum) {}
+
+/**
+ * @brief Assignment operator for Histogram.
+ *
+ * @param rhs The Histogram to assign from.
+ * @return Reference to this Histogram.
+ */
+Histogram	&Histogram::operator=(const Histogram &rhs)
+{
+	if (this != &rhs)
+	{
+		this->_counts = rhs._counts;
+		this->_count = rhs._count;
+		this->_min = rhs._min;
+		this->_max = rhs._max;
+		this->_sum = rhs._sum;
+	}
+	return (*this);
+}
+
+/**
+ * @brief Records one value.
+ *
+ * @param value The value to record, typically a latency in nanoseconds.
+ */
+void	Histogram::record(unsigned long value)
+{
+	++this->_counts[_index(value)];
+	++this->_count;
+	this->_sum += value;
+	if (value < this->_min)
+		this->_min = value;
+	if (value > this->_max)
+		this->_max = value;
+}
+
+/**
+ * @brief Adds the values recorded by another histogram.
+ *
+ * @param other The histogram to merge.
+ */
+void	Histogram::merge(const Histogram &other)
+{
+	for (std::size_t i = 0; i < bucketCount; ++i)
+		this->_counts[i] += other._counts[i];
+	this->_count += other._count;
+	this->_sum += other._sum;
+	if (other._min < this->_min)
+		this->_min = other._min;
+	if (other._max > this->_max)
+		this->_max = other._max;
+}
+
+/**
+ * @brief Forgets every recorded value.
+ */
+void	Histogram::reset()
+{
+	this->_counts.assign(bucketCount, 0);
+	this->_count = 0;
+	this->_min = ULONG_MAX;
+	this->_max = 0;
+	this->_sum = 0;
+}
+
+/**
+ * @brief Gets the number of recorded values.
+ *
+ * @return The number of values.
+ */
+unsigned long	Histogram::count() const
+{
+	return (this->_count);
+}
+
+/**
+ * @brief Gets the smallest recorded value.
+ *
+ * @return The minimum, or 0 if nothing was recorded.
+ */
+unsigned long	Histogram::min() const
+{
+	return (this->_count ? this->_min : 0);
+}
+
+/**
+ * @brief Gets the largest recorded value.
+ *
+ * @return The maximum.
+ */
+unsigned long	Histogram::max() const
+{
+	return (this->_max);
+}
+
+/**
+ * @brief Gets the mean of the recorded values.
+ *
+ * @return The mean, or 0 if nothing was recorded.
+ */
+double	Histogram::mean() const
+{
+	return (this->_count ? this->_sum / this->_count : 0);
+}
+
+/**
+ * @brief Gets the value below or at which a given percentage of the
+ * recorded values fall.
+ *
+ * @param percent The percentile, between 0 and 100.
+ * @return The highest value equivalent to the bucket holding the percentile,
+ * capped by the recorded maximum.
+ */
+unsigned long	Histogram::percentile(double percent) const
+{
+	if (this->_count == 0)
+		return (0);
+
+	unsigned long rank = static_cast<unsigned long>(percent / 100.0 * this->_count + 0.5);
+	if (rank < 1)
+		rank = 1;
+	if (rank > this->_count)
+		rank = this->_count;
+
+	unsigned long seen = 0;
+	for (std::size_t i = 0; i < bucketCount; ++i)
+	{
+		seen += this->_counts[i];
+		if (seen >= rank)
+		{
+			unsigned long value = _highestEquivalent(i);
+			return (value < this->_max ? value : this->_max);
+		}
+	}
+	return (this->_max);
+}
+
+/**
+ * @brief Maps a value to its bucket.
+ *
+ * @param value The value.
+ * @return The bucket index.
+ */
+std::size_t	Histogram::_index(unsigned long value)
+{
+	if (value < subBuckets)
+		return (value);
+
+	std::size_t msb = valueBits - 1 - __builtin_clzl(value);
+	std::size_t shift = msb - subBucketBits;
+	std::size_t top = value >> shift;
+	return ((shift + 1) * subBuckets + (top - subBuckets));
+}
+
+/**
+ * @brief Gets the highest value mapped to a bucket.
+ *
+ * @param index The bucket index.
+ * @return The highest value of the bucket.
+ */
+unsigned long	Histogram::_highestEquivalent(std::size_t index)
+{
+	std::size_t group = index >> subBucketBits;
+	if (group == 0)
+		return (index);
+
+	unsigned long top = (index & (subBuckets - 1)) + subBuckets;
+	return (((top + 1) << (group - 1)) - 1);
+}
+
+} // !bench
+} // !log42
+
+/* ************************************************************************** */
+/*                                                                            */
+/*                                MIT License                                 */
+/*                                                                            */
+/*   Copyright (c) 2025 Demont Pieric, Lucken Bénédict                        */
+/*                                                                            */
+/*   Inspired by the Python 'logging' module by Vinay Sajip.                  */
+/*   This implementation was rewritten in C++98 and contains no original      */
+/*   Python source code.                                                      */
+/*                                                                            */
+/*   Permission is hereby granted, free of charge, to any person obtaining    */
+/*   a copy of this software and associated documentation files (the          */
+/*   "Software"), to deal in the Software without restriction, including      */
+/*   without limitation the rights to use, copy, modify, merge, publish,      */
+/*   distribute, sublicense, and/or sell copies of the Software, and to       */
+/*   permit persons to whom the Software is furnished to do so, subject to    */
+/*   the following conditions:                                                */
+/*                                                                            */
+/*   The above copyright notice and this permission notice shall be included  */
+/*   in all copies or substantial portions of the Software.                   */
+/*                                                                            */
+/*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS  */
+/*   OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF               */
+/*   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.   */
+/*   IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY     */
+/*   CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,     */
+/*   TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE        */
+/*   SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                   */
+/*                                                                            */
+/* ************************************************************************** */
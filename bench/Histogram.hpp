@@ -0,0 +1,128 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   Histogram.hpp                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: pdemont <pdemont@student.42lausanne.ch>    +#+  +:+       +#+        */
+/*   By: blucken <blucken@student.42lausanne.ch>  +#+#+#+#+#+   +#+           */
+/*                                                     #+#    #+#             */
+/*   Created: 2026/10/18                              ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef LOG42_BENCH_HISTOGRAM_HPP
+#define LOG42_BENCH_HISTOGRAM_HPP
+
+/**
+ * @file Histogram.hpp
+ * @brief Declares the Histogram class recording latency distributions.
+ */ 
+
+#include <cstddef>
+#include <vector>
+
+namespace log42
+{
+namespace bench
+{
+
+/**
+ * @class Histogram
+ * @brief Log-linear latency histogram in the style of HdrHistogram.
+ *
+ * Values below 2^subBucketBits are counted exactly; above, every power of two
+ * is split into 2^subBucketBits buckets, which bounds the relative error of a
+ * reported value to 2^-subBucketBits (about 1.6%) over the whole 64-bit range.
+ * Recording is a shift and an increment, cheap enough to time every call;
+ * each producer thread records into its own histogram and they are merged
+ * afterwards.
+ *
+ * @startuml
+ * class "Histogram" as Histogram {
+		+ {static} subBucketBits : size_t
+		- _counts : vector<unsigned long>
+		- _count : unsigned long
+		- _min : unsigned long
+		- _max : unsigned long
+		- _sum : double
+		--
+		+ Histogram()
+		+ record(value : unsigned long) : void
+		+ merge(other : Histogram) : void
+		+ reset() : void
+		+ count() : unsigned long
+		+ min() : unsigned long
+		+ max() : unsigned long
+		+ mean() : double
+		+ percentile(percent : double) : unsigned long
+		- {static} _index(value : unsigned long) : size_t
+		- {static} _highestEquivalent(index : size_t) : unsigned long
+	}
+ * @enduml
+ */
+class Histogram
+{
+	public:
+		static const std::size_t	subBucketBits = 6;
+
+		Histogram();
+		~Histogram();
+
+		Histogram(const Histogram &rhs);
+		Histogram &operator=(const Histogram &rhs);
+
+		void			record(unsigned long value);
+		void			merge(const Histogram &other);
+		void			reset();
+		unsigned long	count() const;
+		unsigned long	min() const;
+		unsigned long	max() const;
+		double			mean() const;
+		unsigned long	percentile(double percent) const;
+
+	private:
+		std::vector<unsigned long>	_counts;
+		unsigned long				_count;
+		unsigned long				_min;
+		unsigned long				_max;
+		double						_sum;
+
+		static std::size_t		_index(unsigned long value);
+		static unsigned long	_highestEquivalent(std::size_t index);
+};
+
+} // !bench
+} // !log42
+
+#endif // !LOG42_BENCH_HISTOGRAM_HPP
+
+/* ************************************************************************** */
+/*                                                                            */
+/*                                MIT License                                 */
+/*                                                                            */
+/*   Copyright (c) 2025 Demont Pieric, Lucken Bénédict                        */
+/*                                                                            */
+/*   Inspired by the Python 'logging' module by Vinay Sajip.                  */
+/*   This implementation was rewritten in C++98 and contains no original      */
+/*   Python source code.                                                      */
+/*                                                                            */
+/*   Permission is hereby granted, free of charge, to any person obtaining    */
+/*   a copy of this software and associated documentation files (the          */
+/*   "Software"), to deal in the Software without restriction, including      */
+/*   without limitation the rights to use, copy, modify, merge, publish,      */
+/*   distribute, sublicense, and/or sell copies of the Software, and to       */
+/*   permit persons to whom the Software is furnished to do so, subject to    */
+/*   the following conditions:                                                */
+/*                                                                            */
+/*   The above copyright notice and this permission notice shall be included  */
+/*   in all copies or substantial portions of the Software.                   */
+/*                                                                            */
+/*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS  */
+/*   OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF               */
+/*   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.   */
+/*   IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY     */
+/*   CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,     */
+/*   TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE        */
+/*   SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                   */
+/*                                                                            */
+/* ************************************************************************** */
@@ -0,0 +1,96 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   NullHandler.hpp                                    :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: pdemont <pdemont@student.42lausanne.ch>    +#+  +:+       +#+        */
+/*   By: blucken <blucken@student.42lausanne.ch>  +#+#+#+#+#+   +#+           */
+/*                                                     #+#    #+#             */
+/*   Created: 2026/10/18                              ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef LOG42_BENCH_NULLHANDLER_HPP
+#define LOG42_BENCH_NULLHANDLER_HPP
+
+/**
+ * @file NullHandler.hpp
+ * @brief Declares the NullHandler class, a handler that discards records.
+ */ 
+
+#include <log42/Handler.hpp>
+
+namespace log42
+{
+namespace bench
+{
+
+/**
+ * @class NullHandler
+ * @brief Handler that counts and discards the records it receives.
+ *
+ * Isolates the cost of the logging pipeline from any formatting or I/O.
+ *
+ * @startuml
+ * class "NullHandler" as NullHandler {
+		- _emitted : unsigned long
+		--
+		+ NullHandler()
+		+ emit(record : LogRecord) : void
+		+ flush() : void
+		+ getEmitted() : unsigned long
+	}
+ * @enduml
+ */
+class NullHandler : public handler::Handler
+{
+	public:
+		NullHandler();
+		~NullHandler();
+
+		void			emit(logRecord::LogRecord &record);
+		void			flush();
+		unsigned long	getEmitted() const;
+
+	private:
+		unsigned long	_emitted;
+
+		NullHandler(const NullHandler &rhs);
+		NullHandler &operator=(const NullHandler &rhs);
+};
+
+} // !bench
+} // !log42
+
+#endif // !LOG42_BENCH_NULLHANDLER_HPP
+
+/* ************************************************************************** */
+/*                                                                            */
+/*                                MIT License                                 */
+/*                                                                            */
+/*   Copyright (c) 2025 Demont Pieric, Lucken Bénédict                        */
+/*                                                                            */
+/*   Inspired by the Python 'logging' module by Vinay Sajip.                  */
+/*   This implementation was rewritten in C++98 and contains no original      */
+/*   Python source code.                                                      */
+/*                                                                            */
+/*   Permission is hereby granted, free of charge, to any person obtaining    */
+/*   a copy of this software and associated documentation files (the          */
+/*   "Software"), to deal in the Software without restriction, including      */
+/*   without limitation the rights to use, copy, modify, merge, publish,      */
+/*   distribute, sublicense, and/or sell copies of the Software, and to       */
+/*   permit persons to whom the Software is furnished to do so, subject to    */
+/*   the following conditions:                                                */
+/*                                                                            */
+/*   The above copyright notice and this permission notice shall be included  */
+/*   in all copies or substantial portions of the Software.                   */
+/*                                                                            */
+/*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS  */
+/*   OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF               */
+/*   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.   */
+/*   IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY     */
+/*   CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,     */
+/*   TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE        */
+/*   SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                   */
+/*                                                                            */
+/* ************************************************************************** */
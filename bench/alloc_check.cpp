@@ -0,0 +1,326 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   alloc_check.cpp                                    :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: pdemont <pdemont@student.42lausanne.ch>    +#+  +:+       +#+        */
+/*   By: blucken <blucken@student.42lausanne.ch>  +#+#+#+#+#+   +#+           */
+/*                                                     #+#    #+#             */
+/*   Created: 2026/10/18                              ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+/**
+ * @file alloc_check.cpp
+ * @brief Allocation-count regression check of the logging hot path.
+ *
+ * Usage: log42_alloc_check
+ *
+ * Runs canonical scenarios with the allocator interposed by AllocCounter and
+ * compares the allocations made per call, once warmed up, with a budget.
+ * Exits with a failure status if any scenario exceeds its budget.
+ */ 
+
+#include "AllocCounter.hpp"
+#include <log42/JsonStyle.hpp>
+#include <log42/Log42.hpp>
+#include <iostream>
+
+using namespace log42;
+using namespace log42::bench;
+
+namespace
+{
+
+/**
+ * @brief Calls measured per scenario, after one warm-up call.
+ */
+const unsigned long	calls = 1000;
+
+/**
+ * @brief Keeps the optimizer from discarding formatted output.
+ */
+volatile std::size_t	sink;
+
+/**
+ * @brief Handler formatting records into the dispatch arena and discarding
+ * them, so enabled calls pay for rendering and formatting but not for I/O.
+ */
+class SinkHandler : public handler::Handler
+{
+	public:
+		SinkHandler() : handler::Handler() {}
+
+		void	emit(logRecord::LogRecord &record)
+		{
+			arena::t_string out;
+			this->format(record, out);
+			sink = out.size();
+		}
+
+		void	flush() {}
+};
+
+/**
+ * @brief A scenario of the check.
+ */
+class Scenario
+{
+	public:
+		Scenario(const char *name, unsigned long budget) : _name(name), _budget(budget) {}
+		virtual ~Scenario() {}
+
+		virtual void	call() = 0;
+
+		/**
+		 * @brief Warms the scenario up, counts the allocations of the measured
+		 * calls and reports them against the budget.
+		 *
+		 * @return True if the scenario stayed within its budget.
+		 */
+		bool	check()
+		{
+			this->call();
+			unsigned long before = AllocCounter::allocations();
+			for (unsigned long i = 0; i < calls; ++i)
+				this->call();
+			unsigned long total = AllocCounter::allocations() - before;
+
+			bool ok = total <= this->_budget * calls;
+			std::cout << (ok ? "[ OK ] " : "[FAIL] ") << this->_name << ": " 
+				<< total << " allocations in " << calls << " calls, budget " 
+				<< this->_budget << " per call" << std::endl;
+			if (total < this->_budget * calls)
+				std::cout << "       below budget, lower it to " << total / calls << std::endl;
+			return (ok);
+		}
+
+	private:
+		const char		*_name;
+		unsigned long	_budget;
+};
+
+/**
+ * @brief A DEBUG call on a logger set to WARNING.
+ */
+class DisabledDebug : public Scenario
+{
+	public:
+		DisabledDebug(logger::Logger *logger) : Scenario("disabled_debug", 0), _logger(logger) {}
+
+		void	call()
+		{
+			DEBUG(this->_logger, "value %d", 42);
+		}
+
+	private:
+		logger::Logger	*_logger;
+};
+
+/**
+ * @brief An enabled call without arguments.
+ */
+class EnabledNoArgs : public Scenario
+{
+	public:
+		EnabledNoArgs(logger::Logger *logger) : Scenario("enabled_no_args", 0), _logger(logger) {}
+
+		void	call()
+		{
+			INFO(this->_logger, "connection accepted");
+		}
+
+	private:
+		logger::Logger	*_logger;
+};
+
+/**
+ * @brief An enabled call with three arguments.
+ */
+class EnabledThreeArgs : public Scenario
+{
+	public:
+		EnabledThreeArgs(logger::Logger *logger) : Scenario("enabled_three_args", 0), _logger(logger) {}
+
+		void	call()
+		{
+			INFO(this->_logger, "%d items for %s in %f ms", 1234, "client", 12.5);
+		}
+
+	private:
+		logger::Logger	*_logger;
+};
+
+/**
+ * @brief An enabled call site logging two texts in turn, so only one of
+ * them matches the template it caches.
+ */
+class EnabledVaryingText : public Scenario
+{
+	public:
+		EnabledVaryingText(logger::Logger *logger) : Scenario("enabled_varying_text", 0), _logger(logger), _round(0) {}
+
+		void	call()
+		{
+			INFO(this->_logger, ++this->_round % 2 ? "%d items for %s" : "%d items left for %s", 1234, "client");
+		}
+
+	private:
+		logger::Logger	*_logger;
+		unsigned long	_round;
+};
+
+/**
+ * @brief An enabled LOG_STREAM call with three insertions.
+ */
+class EnabledStream : public Scenario
+{
+	public:
+		EnabledStream(logger::Logger *logger) : Scenario("enabled_stream", 0), _logger(logger) {}
+
+		void	call()
+		{
+			LOG_STREAM(this->_logger, logRecord::INFO) << 1234 << " items for " << "client" << " in " << 12.5 << " ms";
+		}
+
+	private:
+		logger::Logger	*_logger;
+};
+
+/**
+ * @brief An enabled LOG_FIELDS call with three fields, on a logger with a
+ * field of its own.
+ */
+class EnabledFields : public Scenario
+{
+	public:
+		EnabledFields(logger::Logger *logger) : Scenario("enabled_fields", 0), _logger(logger) {}
+
+		void	call()
+		{
+			LOG_FIELDS(this->_logger, logRecord::INFO, Fields().add("items", 1234).add("client", "client").add("ok", true),
+				"%d items in %f ms", 1234, 12.5);
+		}
+
+	private:
+		logger::Logger	*_logger;
+};
+
+/**
+ * @brief PercentStyle rendering of a record with the default format.
+ */
+class PercentStyleDefault : public Scenario
+{
+	public:
+		PercentStyleDefault() : Scenario("percent_style_default", 0), _style(),
+			_record("alloc.check", logRecord::INFO, "bench/alloc_check.cpp", 42, 
+				"%d items for %s", Args(1234, "client")) {}
+
+		void	call()
+		{
+			arena::Scope scope;
+			arena::t_string out;
+			this->_style.format(this->_record, StringRef("2025-01-01 00:00:00,000"), out);
+			sink = out.size();
+		}
+
+	private:
+		style::PercentStyle		_style;
+		logRecord::LogRecord	_record;
+};
+
+/**
+ * @brief JsonStyle rendering of a record with structured fields and a
+ * message to escape.
+ */
+class JsonStyleDefault : public Scenario
+{
+	public:
+		JsonStyleDefault() : Scenario("json_style_default", 0), _style(formatter::JsonFormatter::defaultJsonFormat),
+			_record("alloc.check", logRecord::INFO, logRecord::CallSite::get("bench/alloc_check.cpp", 42, "call"),
+				"%d items for \"%s\"", Args(1234, "client"), Fields().add("user", "alice").add("ms", 12.5)) {}
+
+		void	call()
+		{
+			arena::Scope scope;
+			arena::t_string out;
+			this->_style.format(this->_record, StringRef("2025-01-01T00:00:00.%(msecs)+0000"), out);
+			sink = out.size();
+		}
+
+	private:
+		style::JsonStyle		_style;
+		logRecord::LogRecord	_record;
+};
+
+} // !namespace
+
+int main()
+{
+	common::core::raii::SharedPtr<logger::Logger> disabled = getLogger("alloc.disabled");
+	disabled->setLevel(logRecord::WARNING);
+
+	common::core::raii::SharedPtr<logger::Logger> enabled = getLogger("alloc.enabled");
+	enabled->setLevel(logRecord::DEBUG);
+	enabled->setPropagate(false);
+	enabled->addHandler(common::core::raii::SharedPtr<handler::Handler>(new SinkHandler()));
+
+	common::core::raii::SharedPtr<logger::Logger> fields = getLogger("alloc.fields");
+	fields->setLevel(logRecord::DEBUG);
+	fields->setPropagate(false);
+	fields->addHandler(common::core::raii::SharedPtr<handler::Handler>(new SinkHandler()));
+	fields->setField("region", "eu-west");
+
+	DisabledDebug disabledDebug(disabled.get());
+	EnabledNoArgs enabledNoArgs(enabled.get());
+	EnabledThreeArgs enabledThreeArgs(enabled.get());
+	EnabledVaryingText enabledVaryingText(enabled.get());
+	EnabledStream enabledStream(enabled.get());
+	EnabledFields enabledFields(fields.get());
+	PercentStyleDefault percentStyleDefault;
+	JsonStyleDefault jsonStyleDefault;
+
+	bool ok = true;
+	ok = disabledDebug.check() && ok;
+	ok = enabledNoArgs.check() && ok;
+	ok = enabledThreeArgs.check() && ok;
+	ok = enabledVaryingText.check() && ok;
+	ok = enabledStream.check() && ok;
+	ok = enabledFields.check() && ok;
+	ok = percentStyleDefault.check() && ok;
+	ok = jsonStyleDefault.check() && ok;
+
+	shutdown();
+	return (ok ? 0 : 1);
+}
+
+/* ************************************************************************** */
+/*                                                                            */
+/*                                MIT License                                 */
+/*                                                                            */
+/*   Copyright (c) 2025 Demont Pieric, Lucken Bénédict                        */
+/*                                                                            */
+/*   Inspired by the Python 'logging' module by Vinay Sajip.                  */
+/*   This implementation was rewritten in C++98 and contains no original      */
+/*   Python source code.                                                      */
+/*                                                                            */
+/*   Permission is hereby granted, free of charge, to any person obtaining    */
+/*   a copy of this software and associated documentation files (the          */
+/*   "Software"), to deal in the Software without restriction, including      */
+/*   without limitation the rights to use, copy, modify, merge, publish,      */
+/*   distribute, sublicense, and/or sell copies of the Software, and to       */
+/*   permit persons to whom the Software is furnished to do so, subject to    */
+/*   the following conditions:                                                */
+/*                                                                            */
+/*   The above copyright notice and this permission notice shall be included  */
+/*   in all copies or substantial portions of the Software.                   */
+/*                                                                            */
+/*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS  */
+/*   OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF               */
+/*   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.   */
+/*   IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY     */
+/*   CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,     */
+/*   TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE        */
+/*   SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                   */
+/*                                                                            */
+/* ************************************************************************** */
@@ -0,0 +1,685 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   bench.cpp                                          :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: pdemont <pdemont@student.42lausanne.ch>    +#+  +:+       +#+        */
+/*   By: blucken <blucken@student.42lausanne.ch>  +#+#+#+#+#+   +#+           */
+/*                                                     #+#    #+#             */
+/*   Created: 2026/10/18                              ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+/**
+ * @file bench.cpp
+ * @brief Single-threaded microbenchmarks of the logging hot paths.
+ *
+ * Usage: log42_bench [filter] [min-seconds]
+ *
+ * Prints one JSON object per benchmark on stdout.
+ */ 
+
+#include "AllocCounter.hpp"
+#include "Bench.hpp"
+#include "NullHandler.hpp"
+#include <log42/JsonStyle.hpp>
+#include <log42/Log42.hpp>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+
+using namespace log42;
+using namespace log42::bench;
+
+namespace
+{
+
+/**
+ * @brief Keeps the optimizer from discarding benchmarked results.
+ */
+volatile std::size_t	sink;
+
+/**
+ * @brief Builds the record used by the record-level benchmarks.
+ *
+ * @return A record with two arguments.
+ */
+logRecord::LogRecord	makeRecord()
+{
+	return (logRecord::LogRecord("bench.filter.child", logRecord::INFO, "bench/bench.cpp", 42, 
+		"processed %d items for %s", Args(1234, "client")));
+}
+
+/**
+ * @brief A DEBUG call on a logger set to WARNING.
+ */
+class DisabledCall : public Benchmark
+{
+	public:
+		DisabledCall() : Benchmark("disabled_call"), _logger(getLogger("bench.disabled")) 
+		{
+			this->_logger->setLevel(logRecord::WARNING);
+		}
+
+		void	run(std::size_t iterations)
+		{
+			for (std::size_t i = 0; i < iterations; ++i)
+				DEBUG(this->_logger, "value %d", static_cast<int>(i));
+		}
+
+	private:
+		common::core::raii::SharedPtr<logger::Logger>	_logger;
+};
+
+/**
+ * @brief A DEBUG call through a call-site handle on a logger set to WARNING.
+ */
+class HandleDisabledCall : public Benchmark
+{
+	public:
+		HandleDisabledCall() : Benchmark("handle_disabled_call") 
+		{
+			getLogger("bench.handle")->setLevel(logRecord::WARNING);
+		}
+
+		void	run(std::size_t iterations)
+		{
+			for (std::size_t i = 0; i < iterations; ++i)
+				LOGGER_DEBUG("bench.handle", "value %d", static_cast<int>(i));
+		}
+};
+
+/**
+ * @brief A ROOT_DEBUG call with the root logger set to WARNING.
+ */
+class RootDisabledCall : public Benchmark
+{
+	public:
+		RootDisabledCall() : Benchmark("root_disabled_call") 
+		{
+			getLogger()->setLevel(logRecord::WARNING);
+		}
+
+		void	run(std::size_t iterations)
+		{
+			for (std::size_t i = 0; i < iterations; ++i)
+				ROOT_DEBUG("value %d", static_cast<int>(i));
+		}
+};
+
+/**
+ * @brief An enabled call with one argument reaching a handler that discards it.
+ */
+class EnabledNullHandler : public Benchmark
+{
+	public:
+		EnabledNullHandler() : Benchmark("enabled_null_handler"), _logger(getLogger("bench.enabled"))
+		{
+			this->_logger->setLevel(logRecord::DEBUG);
+			this->_logger->setPropagate(false);
+			this->_logger->addHandler(common::core::raii::SharedPtr<handler::Handler>(new NullHandler()));
+		}
+
+		void	run(std::size_t iterations)
+		{
+			for (std::size_t i = 0; i < iterations; ++i)
+				INFO(this->_logger, "value %d", static_cast<int>(i));
+		}
+
+	private:
+		common::core::raii::SharedPtr<logger::Logger>	_logger;
+};
+
+/**
+ * @brief Enabled DEBUG call on a logger sampling 1% of its debug records,
+ * most of which are dropped before a record is built.
+ */
+class SampledCall : public Benchmark
+{
+	public:
+		SampledCall() : Benchmark("sampled_call"), _logger(getLogger("bench.sampled"))
+		{
+			this->_logger->setLevel(logRecord::DEBUG);
+			this->_logger->setPropagate(false);
+			this->_logger->addHandler(common::core::raii::SharedPtr<handler::Handler>(new NullHandler()));
+			this->_logger->setSampler(common::core::raii::SharedPtr<filter::Sampler>(new filter::RandomSampler(0.01)));
+		}
+
+		void	run(std::size_t iterations)
+		{
+			for (std::size_t i = 0; i < iterations; ++i)
+				DEBUG(this->_logger, "value %d", static_cast<int>(i));
+		}
+
+	private:
+		common::core::raii::SharedPtr<logger::Logger>	_logger;
+};
+
+/**
+ * @brief LOG_EVERY_N on an enabled logger, skipping all but one call in a
+ * million.
+ */
+class EveryNCall : public Benchmark
+{
+	public:
+		EveryNCall() : Benchmark("every_n_call"), _logger(getLogger("bench.every_n"))
+		{
+			this->_logger->setLevel(logRecord::DEBUG);
+			this->_logger->setPropagate(false);
+			this->_logger->addHandler(common::core::raii::SharedPtr<handler::Handler>(new NullHandler()));
+		}
+
+		void	run(std::size_t iterations)
+		{
+			for (std::size_t i = 0; i < iterations; ++i)
+				LOG_EVERY_N(this->_logger, logRecord::INFO, 1000000, "value %d", static_cast<int>(i));
+		}
+
+	private:
+		common::core::raii::SharedPtr<logger::Logger>	_logger;
+};
+
+/**
+ * @brief Enabled LOG_STREAM call with one insertion reaching a handler that
+ * discards it.
+ */
+class StreamCall : public Benchmark
+{
+	public:
+		StreamCall() : Benchmark("stream_call"), _logger(getLogger("bench.stream"))
+		{
+			this->_logger->setLevel(logRecord::DEBUG);
+			this->_logger->setPropagate(false);
+			this->_logger->addHandler(common::core::raii::SharedPtr<handler::Handler>(new NullHandler()));
+		}
+
+		void	run(std::size_t iterations)
+		{
+			for (std::size_t i = 0; i < iterations; ++i)
+				LOG_STREAM(this->_logger, logRecord::INFO) << "value " << static_cast<int>(i);
+		}
+
+	private:
+		common::core::raii::SharedPtr<logger::Logger>	_logger;
+};
+
+/**
+ * @brief Enabled LOG_FIELDS call with three fields, on a logger with a field
+ * of its own, reaching a handler that discards it.
+ */
+class FieldsCall : public Benchmark
+{
+	public:
+		FieldsCall() : Benchmark("fields_call"), _logger(getLogger("bench.fields"))
+		{
+			this->_logger->setLevel(logRecord::DEBUG);
+			this->_logger->setPropagate(false);
+			this->_logger->setField("region", "eu-west");
+			this->_logger->addHandler(common::core::raii::SharedPtr<handler::Handler>(new NullHandler()));
+		}
+
+		void	run(std::size_t iterations)
+		{
+			for (std::size_t i = 0; i < iterations; ++i)
+				LOG_FIELDS(this->_logger, logRecord::INFO, Fields().add("request", static_cast<int>(i)).add("ms", 12.5).add("ok", true),
+					"value %d", static_cast<int>(i));
+		}
+
+	private:
+		common::core::raii::SharedPtr<logger::Logger>	_logger;
+};
+
+/**
+ * @brief PercentStyle rendering of a record into a dispatch buffer.
+ */
+class PercentStyleFormat : public Benchmark
+{
+	public:
+		PercentStyleFormat() : Benchmark("percent_style_format"), 
+			_style("[%(levelname)] %(name) %(filename):%(lineno) %(funcName) - %(message)"), _record(makeRecord()) {}
+
+		void	run(std::size_t iterations)
+		{
+			for (std::size_t i = 0; i < iterations; ++i)
+			{
+				arena::Scope scope;
+				arena::t_string out;
+				this->_style.format(this->_record, StringRef("2025-01-01 00:00:00,000"), out);
+				sink = out.size();
+			}
+		}
+
+	private:
+		style::PercentStyle		_style;
+		logRecord::LogRecord	_record;
+};
+
+/**
+ * @brief JsonStyle rendering of a record with three structured fields and a
+ * quoted argument into a dispatch buffer.
+ */
+class JsonStyleFormat : public Benchmark
+{
+	public:
+		JsonStyleFormat() : Benchmark("json_style_format"), 
+			_style("%(asctime) %(levelname) %(name) %(filename) %(lineno) %(funcName) %(message)"),
+			_record("bench.filter.child", logRecord::INFO, logRecord::CallSite::get("bench/bench.cpp", 42, "run"),
+				"processed %d items for \"%s\"", Args(1234, "client"),
+				Fields().add("user", "alice").add("ms", 12.5).add("ok", true)) {}
+
+		void	run(std::size_t iterations)
+		{
+			for (std::size_t i = 0; i < iterations; ++i)
+			{
+				arena::Scope scope;
+				arena::t_string out;
+				this->_style.format(this->_record, StringRef("2025-01-01T00:00:00.000+0000"), out);
+				sink = out.size();
+			}
+		}
+
+	private:
+		style::JsonStyle		_style;
+		logRecord::LogRecord	_record;
+};
+
+/**
+ * @brief Formatter::formatTime with the default date format.
+ */
+class FormatTime : public Benchmark
+{
+	public:
+		FormatTime() : Benchmark("format_time"), _formatter("%(asctime) %(message)"), _record(makeRecord()) {}
+
+		void	run(std::size_t iterations)
+		{
+			for (std::size_t i = 0; i < iterations; ++i)
+				sink = this->_formatter.formatTime(this->_record).size();
+		}
+
+	private:
+		formatter::Formatter	_formatter;
+		logRecord::LogRecord	_record;
+};
+
+/**
+ * @brief Lookup of an existing logger by name.
+ */
+class GetLogger : public Benchmark
+{
+	public:
+		GetLogger() : Benchmark("get_logger"), _name("bench.lookup.deep.child")
+		{
+			getLogger(this->_name);
+		}
+
+		void	run(std::size_t iterations)
+		{
+			for (std::size_t i = 0; i < iterations; ++i)
+				sink = getLogger(this->_name).get() != NULL;
+		}
+
+	private:
+		std::string	_name;
+};
+
+/**
+ * @brief Creation of a new logger four levels deep, under placeholders
+ * shared with the other loggers created by the benchmark.
+ */
+class CreateLogger : public Benchmark
+{
+	public:
+		CreateLogger() : Benchmark("create_logger"), _created(0) {}
+
+		void	run(std::size_t iterations)
+		{
+			char name[64];
+			for (std::size_t i = 0; i < iterations; ++i, ++this->_created)
+			{
+				std::sprintf(name, "bench.create.t%lu.w%lu", this->_created % 64, this->_created);
+				sink = getLoggerPtr(name) != NULL;
+			}
+		}
+
+	private:
+		unsigned long	_created;
+};
+
+/**
+ * @brief Listing of the 16 children of a logger.
+ */
+class GetChildren : public Benchmark
+{
+	public:
+		GetChildren() : Benchmark("get_children"), _logger(getLogger("bench.children"))
+		{
+			char name[64];
+			for (int i = 0; i < 16; ++i)
+			{
+				std::sprintf(name, "bench.children.c%d", i);
+				getLoggerPtr(name);
+			}
+		}
+
+		void	run(std::size_t iterations)
+		{
+			for (std::size_t i = 0; i < iterations; ++i)
+				sink = this->_logger->getChildren().size();
+		}
+
+	private:
+		common::core::raii::SharedPtr<logger::Logger>	_logger;
+};
+
+/**
+ * @brief Effective level and handler lookup from a logger eight levels
+ * below its nearest configured ancestor.
+ */
+class HierarchyWalk : public Benchmark
+{
+	public:
+		HierarchyWalk() : Benchmark("hierarchy_walk"), _logger(getLogger("bench.walk.a.b.c.d.e.f.g"))
+		{
+			const std::string &name = this->_logger->getName();
+			for (std::size_t pos = name.find('.', 6); pos != std::string::npos; pos = name.find('.', pos + 1))
+				getLoggerPtr(name.substr(0, pos));
+			getLogger("bench.walk")->setLevel(logRecord::INFO);
+			getLogger("bench.walk")->addHandler(common::core::raii::SharedPtr<handler::Handler>(new NullHandler()));
+		}
+
+		void	run(std::size_t iterations)
+		{
+			for (std::size_t i = 0; i < iterations; ++i)
+				sink = this->_logger->getEffectiveLevel() + this->_logger->hasHandler();
+		}
+
+	private:
+		common::core::raii::SharedPtr<logger::Logger>	_logger;
+};
+
+/**
+ * @brief Evaluation of three name filters that all accept the record.
+ */
+class FiltererEval : public Benchmark
+{
+	public:
+		FiltererEval() : Benchmark("filterer"), _filterer(), _record(makeRecord())
+		{
+			this->_filterer.addFilter(filter::Filter("bench"));
+			this->_filterer.addFilter(filter::Filter("bench.filter"));
+			this->_filterer.addFilter(filter::Filter("bench.filter.child"));
+		}
+
+		void	run(std::size_t iterations)
+		{
+			for (std::size_t i = 0; i < iterations; ++i)
+				sink = this->_filterer.filter(this->_record);
+		}
+
+	private:
+		filterer::Filterer		_filterer;
+		logRecord::LogRecord	_record;
+};
+
+/**
+ * @brief Evaluation of an allow-list of 32 subsystem filters, the last of
+ * which accepts the record.
+ */
+class FiltererAllowList : public Benchmark
+{
+	public:
+		FiltererAllowList() : Benchmark("filterer_allow_list"), _filterer(), _record(makeRecord())
+		{
+			char name[64];
+			this->_filterer.setMatch(filter::ANY);
+			for (int i = 0; i < 31; ++i)
+			{
+				std::sprintf(name, "bench.subsystem%d", i);
+				this->_filterer.addFilter(filter::Filter(name));
+			}
+			this->_filterer.addFilter(filter::Filter("bench.filter"));
+		}
+
+		void	run(std::size_t iterations)
+		{
+			for (std::size_t i = 0; i < iterations; ++i)
+				sink = this->_filterer.filter(this->_record);
+		}
+
+	private:
+		filterer::Filterer		_filterer;
+		logRecord::LogRecord	_record;
+};
+
+/**
+ * @brief Static callback matching on the function of the call site.
+ *
+ * @param record The log record.
+ * @return True unless the record comes from a test function.
+ */
+bool	notFromTest(const logRecord::LogRecord &record, void *)
+{
+	return (std::strncmp(record.getFuncName(), "test", 4) != 0);
+}
+
+/**
+ * @brief Evaluation of a level range and a static callback, whose decision
+ * is cached per call site, followed by a message test.
+ */
+class FiltererPredicates : public Benchmark
+{
+	public:
+		FiltererPredicates() : Benchmark("filterer_predicates"), _filterer(), _record(makeRecord())
+		{
+			this->_filterer.addFilter(common::core::raii::SharedPtr<filter::Predicate>(new filter::MessageContains("heartbeat", false)));
+			this->_filterer.addFilter(common::core::raii::SharedPtr<filter::Predicate>(new filter::CallbackPredicate(notFromTest, NULL, 200, true)));
+			this->_filterer.addFilter(common::core::raii::SharedPtr<filter::Predicate>(new filter::LevelRange(logRecord::INFO, logRecord::WARNING)));
+		}
+
+		void	run(std::size_t iterations)
+		{
+			for (std::size_t i = 0; i < iterations; ++i)
+				sink = this->_filterer.filter(this->_record);
+		}
+
+	private:
+		filterer::Filterer		_filterer;
+		logRecord::LogRecord	_record;
+};
+
+/**
+ * @brief Rate limit of 1000 records per second dropping a flood from a
+ * single call site.
+ */
+class RateLimited : public Benchmark
+{
+	public:
+		RateLimited() : Benchmark("rate_limit"), _filterer(), _record(makeRecord())
+		{
+			this->_filterer.addFilter(common::core::raii::SharedPtr<filter::Predicate>(new filter::RateLimit(1000, 10)));
+		}
+
+		void	run(std::size_t iterations)
+		{
+			for (std::size_t i = 0; i < iterations; ++i)
+				sink = this->_filterer.filter(this->_record);
+		}
+
+	private:
+		filterer::Filterer		_filterer;
+		logRecord::LogRecord	_record;
+};
+
+/**
+ * @brief Deduplicator collapsing the repeats of a single message.
+ */
+class Deduplicated : public Benchmark
+{
+	public:
+		Deduplicated() : Benchmark("deduplicator"), _filterer(), _record(makeRecord())
+		{
+			this->_filterer.addFilter(common::core::raii::SharedPtr<filter::Predicate>(new filter::Deduplicator()));
+		}
+
+		void	run(std::size_t iterations)
+		{
+			for (std::size_t i = 0; i < iterations; ++i)
+				sink = this->_filterer.filter(this->_record);
+		}
+
+	private:
+		filterer::Filterer		_filterer;
+		logRecord::LogRecord	_record;
+};
+
+/**
+ * @brief StreamHandler writing formatted records to /dev/null.
+ */
+class StreamHandlerThroughput : public Benchmark
+{
+	public:
+		StreamHandlerThroughput() : Benchmark("stream_handler"), _devNull("/dev/null"), 
+			_handler(_devNull), _record(makeRecord())
+		{
+			this->_handler.setFormatter(formatter::Formatter("%(asctime) [%(levelname)] %(name) - %(message)"));
+		}
+
+		void	run(std::size_t iterations)
+		{
+			for (std::size_t i = 0; i < iterations; ++i)
+				this->_handler.handle(this->_record);
+		}
+
+	private:
+		std::ofstream			_devNull;
+		handler::StreamHandler	_handler;
+		logRecord::LogRecord	_record;
+};
+
+/**
+ * @brief FileHandler writing formatted records to a temporary file.
+ */
+class FileHandlerThroughput : public Benchmark
+{
+	public:
+		FileHandlerThroughput() : Benchmark("file_handler"), _path(tempPath()), _handler(NULL), _record(makeRecord()) {}
+
+		void	setUp()
+		{
+			this->_handler = new handler::FileHandler(this->_path, std::ios_base::out);
+			this->_handler->setFormatter(formatter::Formatter("%(asctime) [%(levelname)] %(name) - %(message)"));
+		}
+
+		void	run(std::size_t iterations)
+		{
+			for (std::size_t i = 0; i < iterations; ++i)
+				this->_handler->handle(this->_record);
+		}
+
+		void	tearDown()
+		{
+			delete this->_handler;
+			this->_handler = NULL;
+			std::remove(this->_path.c_str());
+		}
+
+	private:
+		std::string				_path;
+		handler::FileHandler	*_handler;
+		logRecord::LogRecord	_record;
+
+		static std::string	tempPath()
+		{
+			const char *dir = std::getenv("TMPDIR");
+			return (std::string(dir && *dir ? dir : "/tmp") + "/log42_bench.log");
+		}
+};
+
+} // !namespace
+
+int main(int argc, char **argv)
+{
+	Runner runner(argc > 2 ? std::atof(argv[2]) : 0.2, argc > 1 ? argv[1] : "");
+
+	DisabledCall disabledCall;
+	HandleDisabledCall handleDisabledCall;
+	RootDisabledCall rootDisabledCall;
+	EnabledNullHandler enabledNullHandler;
+	SampledCall sampledCall;
+	EveryNCall everyNCall;
+	StreamCall streamCall;
+	FieldsCall fieldsCall;
+	PercentStyleFormat percentStyleFormat;
+	JsonStyleFormat jsonStyleFormat;
+	FormatTime formatTime;
+	GetLogger getLoggerBench;
+	CreateLogger createLogger;
+	GetChildren getChildren;
+	HierarchyWalk hierarchyWalk;
+	FiltererEval filtererEval;
+	FiltererAllowList filtererAllowList;
+	FiltererPredicates filtererPredicates;
+	RateLimited rateLimited;
+	Deduplicated deduplicated;
+	StreamHandlerThroughput streamHandler;
+	FileHandlerThroughput fileHandler;
+
+	runner.run(disabledCall);
+	runner.run(handleDisabledCall);
+	runner.run(rootDisabledCall);
+	runner.run(enabledNullHandler);
+	runner.run(sampledCall);
+	runner.run(everyNCall);
+	runner.run(streamCall);
+	runner.run(fieldsCall);
+	runner.run(percentStyleFormat);
+	runner.run(jsonStyleFormat);
+	runner.run(formatTime);
+	runner.run(getLoggerBench);
+	runner.run(createLogger);
+	runner.run(getChildren);
+	runner.run(hierarchyWalk);
+	runner.run(filtererEval);
+	runner.run(filtererAllowList);
+	runner.run(filtererPredicates);
+	runner.run(rateLimited);
+	runner.run(deduplicated);
+	runner.run(streamHandler);
+	runner.run(fileHandler);
+
+	shutdown();
+	return (0);
+}
+
+/* ************************************************************************** */
+/*                                                                            */
+/*                                MIT License                                 */
+/*                                                                            */
+/*   Copyright (c) 2025 Demont Pieric, Lucken Bénédict                        */
+/*                                                                            */
+/*   Inspired by the Python 'logging' module by Vinay Sajip.                  */
+/*   This implementation was rewritten in C++98 and contains no original      */
+/*   Python source code.                                                      */
+/*                                                                            */
+/*   Permission is hereby granted, free of charge, to any person obtaining    */
+/*   a copy of this software and associated documentation files (the          */
+/*   "Software"), to deal in the Software without restriction, including      */
+/*   without limitation the rights to use, copy, modify, merge, publish,      */
+/*   distribute, sublicense, and/or sell copies of the Software, and to       */
+/*   permit persons to whom the Software is furnished to do so, subject to    */
+/*   the following conditions:                                                */
+/*                                                                            */
+/*   The above copyright notice and this permission notice shall be included  */
+/*   in all copies or substantial portions of the Software.                   */
+/*                                                                            */
+/*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS  */
+/*   OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF               */
+/*   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.   */
+/*   IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY     */
+/*   CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,     */
+/*   TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE        */
+/*   SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                   */
+/*                                                                            */
+/* ************************************************************************** */
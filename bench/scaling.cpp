@@ -0,0 +1,298 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   scaling.cpp                                        :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: pdemont <pdemont@student.42lausanne.ch>    +#+  +:+       +#+        */
+/*   By: blucken <blucken@student.42lausanne.ch>  +#+#+#+#+#+   +#+           */
+/*                                                     #+#    #+#             */
+/*   Created: 2026/10/18                              ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+/**
+ * @file scaling.cpp
+ * @brief Multi-threaded scaling and tail-latency benchmark.
+ *
+ * Usage: log42_scaling [handlers] [max-threads] [calls-per-thread]
+ *
+ * For each handler kind of the comma-separated list (null,stream,file by
+ * default) and each thread count 1, 2, 4, ... up to max-threads, producer
+ * threads log through one logger to one shared handler. Every call is timed
+ * on the caller side; one JSON object per run reports the throughput and the
+ * p50, p99, p99.9 and maximum latencies.
+ */ 
+
+#include "Clock.hpp"
+#include "Histogram.hpp"
+#include "NullHandler.hpp"
+#include <log42/Log42.hpp>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <pthread.h>
+#include <sstream>
+#include <unistd.h>
+
+using namespace log42;
+using namespace log42::bench;
+
+namespace
+{
+
+typedef common::core::raii::SharedPtr<handler::Handler>	t_handlerPtr;
+typedef common::core::raii::SharedPtr<logger::Logger>	t_loggerPtr;
+
+/**
+ * @brief State shared by the producers of one run.
+ */
+struct Run
+{
+	t_loggerPtr		logger;
+	unsigned long	calls;
+	volatile int	started;
+	volatile int	go;
+};
+
+/**
+ * @brief State of one producer.
+ */
+struct Producer
+{
+	Run			*run;
+	pthread_t	thread;
+	Histogram	latencies;
+};
+
+/**
+ * @brief Body of a producer thread: waits for the start signal, then logs
+ * and times every call.
+ *
+ * @param arg The Producer.
+ * @return NULL.
+ */
+void	*produce(void *arg)
+{
+	Producer *producer = static_cast<Producer *>(arg);
+	Run *run = producer->run;
+	logger::Logger *logger = run->logger.get();
+
+	__sync_fetch_and_add(&run->started, 1);
+	while (!__sync_fetch_and_add(&run->go, 0))
+		;
+	for (unsigned long i = 0; i < run->calls; ++i)
+	{
+		double start = Clock::nowNs();
+		INFO(logger, "request %d served in %d us", static_cast<int>(i), 42);
+		producer->latencies.record(static_cast<unsigned long>(Clock::nowNs() - start));
+	}
+	return (NULL);
+}
+
+/**
+ * @brief Gets the directory of the file handler output, preferring tmpfs.
+ *
+ * @return $BENCH_TMPDIR, else /dev/shm if writable, else /tmp.
+ */
+std::string	tempDir()
+{
+	const char *dir = std::getenv("BENCH_TMPDIR");
+	if (dir && *dir)
+		return (dir);
+	if (access("/dev/shm", W_OK) == 0)
+		return ("/dev/shm");
+	return ("/tmp");
+}
+
+/**
+ * @brief Handler kinds the driver knows how to build.
+ */
+struct Target
+{
+	std::string		kind;
+	std::ofstream	devNull;
+	std::string		path;
+
+	/**
+	 * @brief Builds the handler of the kind.
+	 *
+	 * @return The handler, or a null pointer for an unknown kind.
+	 */
+	t_handlerPtr	make()
+	{
+		handler::Handler *target = NULL;
+		if (this->kind == "null")
+			target = new NullHandler();
+		else if (this->kind == "stream")
+		{
+			this->devNull.open("/dev/null");
+			target = new handler::StreamHandler(this->devNull);
+		}
+		else if (this->kind == "file")
+		{
+			this->path = tempDir() + "/log42_scaling.log";
+			target = new handler::FileHandler(this->path, std::ios_base::out);
+		}
+		if (!target)
+			return (t_handlerPtr());
+		target->setFormatter(formatter::Formatter("%(asctime) [%(levelname)] %(name) - %(message)"));
+		return (t_handlerPtr(target));
+	}
+
+	/**
+	 * @brief Removes what make() left behind.
+	 */
+	void	cleanUp()
+	{
+		if (this->devNull.is_open())
+			this->devNull.close();
+		if (!this->path.empty())
+			std::remove(this->path.c_str());
+	}
+};
+
+/**
+ * @brief Runs the producers once and prints the result.
+ *
+ * @param kind The handler kind, for the report.
+ * @param logger The logger shared by the producers.
+ * @param threads The number of producers.
+ * @param calls The number of calls per producer.
+ */
+void	runOnce(const std::string &kind, const t_loggerPtr &logger, unsigned long threads, unsigned long calls)
+{
+	Run run;
+	run.logger = logger;
+	run.calls = calls;
+	run.started = 0;
+	run.go = 0;
+
+	std::vector<Producer> producers(threads);
+	unsigned long created = 0;
+	for (; created < threads; ++created)
+	{
+		producers[created].run = &run;
+		if (pthread_create(&producers[created].thread, NULL, produce, &producers[created]) != 0)
+			break;
+	}
+	while (static_cast<unsigned long>(__sync_fetch_and_add(&run.started, 0)) < created)
+		;
+
+	double start = Clock::nowNs();
+	__sync_lock_test_and_set(&run.go, 1);
+	for (unsigned long i = 0; i < created; ++i)
+		pthread_join(producers[i].thread, NULL);
+	double elapsed = Clock::nowNs() - start;
+
+	if (created < threads)
+	{
+		std::cerr << "log42_scaling: could only start " << created << " of " << threads << " threads" << std::endl;
+		return;
+	}
+
+	Histogram latencies;
+	for (unsigned long i = 0; i < threads; ++i)
+		latencies.merge(producers[i].latencies);
+
+	std::cout << "{\"bench\":\"scaling\",\"handler\":\"" << kind << "\""
+		<< ",\"threads\":" << threads
+		<< ",\"ops\":" << latencies.count()
+		<< ",\"ops_per_sec\":" << static_cast<unsigned long>(latencies.count() / (elapsed / 1e9))
+		<< ",\"p50_ns\":" << latencies.percentile(50)
+		<< ",\"p99_ns\":" << latencies.percentile(99)
+		<< ",\"p999_ns\":" << latencies.percentile(99.9)
+		<< ",\"max_ns\":" << latencies.max()
+		<< "}" << std::endl;
+}
+
+/**
+ * @brief Runs every thread count against one handler kind.
+ *
+ * @param kind The handler kind.
+ * @param maxThreads The largest number of producers.
+ * @param calls The number of calls per producer.
+ */
+void	runKind(const std::string &kind, unsigned long maxThreads, unsigned long calls)
+{
+	Target target;
+	target.kind = kind;
+	t_handlerPtr handler = target.make();
+	if (!handler.get())
+	{
+		std::cerr << "log42_scaling: no '" << kind << "' handler in this build, skipped" << std::endl;
+		return;
+	}
+
+	t_loggerPtr logger = getLogger("bench.scaling." + kind);
+	logger->setLevel(logRecord::DEBUG);
+	logger->setPropagate(false);
+	logger->addHandler(handler);
+	// Warms up the call site and the level cache before going concurrent.
+	INFO(logger, "request %d served in %d us", 0, 42);
+
+	for (unsigned long threads = 1; ; threads *= 2)
+	{
+		if (threads > maxThreads)
+			threads = maxThreads;
+		runOnce(kind, logger, threads, calls);
+		if (threads == maxThreads)
+			break;
+	}
+
+	logger->removeHandler(handler);
+	handler->close();
+	target.cleanUp();
+}
+
+} // !namespace
+
+int main(int argc, char **argv)
+{
+	std::string kinds = argc > 1 ? argv[1] : "null,stream,file";
+	long nprocs = sysconf(_SC_NPROCESSORS_ONLN);
+	unsigned long maxThreads = argc > 2 ? std::strtoul(argv[2], NULL, 10) : (nprocs > 0 ? nprocs : 1);
+	unsigned long calls = argc > 3 ? std::strtoul(argv[3], NULL, 10) : 100000;
+	if (maxThreads == 0)
+		maxThreads = 1;
+
+	std::istringstream list(kinds);
+	std::string kind;
+	while (std::getline(list, kind, ','))
+		if (!kind.empty())
+			runKind(kind, maxThreads, calls);
+
+	shutdown();
+	return (0);
+}
+
+/* ************************************************************************** */
+/*                                                                            */
+/*                                MIT License                                 */
+/*                                                                            */
+/*   Copyright (c) 2025 Demont Pieric, Lucken Bénédict                        */
+/*                                                                            */
+/*   Inspired by the Python 'logging' module by Vinay Sajip.                  */
+/*   This implementation was rewritten in C++98 and contains no original      */
+/*   Python source code.                                                      */
+/*                                                                            */
+/*   Permission is hereby granted, free of charge, to any person obtaining    */
+/*   a copy of this software and associated documentation files (the          */
+/*   "Software"), to deal in the Software without restriction, including      */
+/*   without limitation the rights to use, copy, modify, merge, publish,      */
+/*   distribute, sublicense, and/or sell copies of the Software, and to       */
+/*   permit persons to whom the Software is furnished to do so, subject to    */
+/*   the following conditions:                                                */
+/*                                                                            */
+/*   The above copyright notice and this permission notice shall be included  */
+/*   in all copies or substantial portions of the Software.                   */
+/*                                                                            */
+/*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS  */
+/*   OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF               */
+/*   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.   */
+/*   IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY     */
+/*   CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,     */
+/*   TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE        */
+/*   SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                   */
+/*                                                                            */
+/* ************************************************************************** */
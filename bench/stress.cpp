@@ -0,0 +1,234 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   stress.cpp                                         :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: pdemont <pdemont@student.42lausanne.ch>    +#+  +:+       +#+        */
+/*   By: blucken <blucken@student.42lausanne.ch>  +#+#+#+#+#+   +#+           */
+/*                                                     #+#    #+#             */
+/*   Created: 2026/10/18                              ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+/**
+ * @file stress.cpp
+ * @brief Concurrency stress test of the logging core, meant to run under
+ * ThreadSanitizer.
+ *
+ * Usage: log42_stress [producers] [calls-per-producer]
+ *
+ * Producer threads log through a small hierarchy while a configuration
+ * thread changes levels, adds and removes handlers and filters, swaps
+ * formatters, toggles propagation, creates loggers that reparent the ones
+ * in use and reclaims the transient loggers the producers release. Exits with a failure status if a record that must always reach the
+ * root handler got lost; data races are reported by ThreadSanitizer.
+ */ 
+
+#include <log42/Log42.hpp>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <pthread.h>
+#include <sstream>
+
+using namespace log42;
+
+namespace
+{
+
+typedef common::core::raii::SharedPtr<handler::Handler>	t_handlerPtr;
+typedef common::core::raii::SharedPtr<logger::Logger>	t_loggerPtr;
+
+/**
+ * @brief Handler counting the records it emits.
+ */
+class CountingHandler : public handler::Handler
+{
+	public:
+		explicit CountingHandler(logRecord::e_LogLevel level) : handler::Handler(level), _count(0) {}
+
+		void	emit(logRecord::LogRecord &record)
+		{
+			arena::t_string out;
+			this->format(record, out);
+			++this->_count;
+		}
+
+		void	flush() {}
+
+		unsigned long	getCount()
+		{
+			this->acquire();
+			unsigned long count = this->_count;
+			this->release();
+			return (count);
+		}
+
+	private:
+		unsigned long	_count;
+};
+
+/**
+ * @brief State shared by the threads.
+ */
+struct Shared
+{
+	logger::Logger	*leaf;
+	logger::Logger	*side;
+	unsigned long	calls;
+	int				done;
+};
+
+/**
+ * @brief Body of a producer: logs at every level through the leaf logger,
+ * the side logger, a call-site handle and the root, looks up the leaf
+ * without locking, and retains and releases transient loggers, some of
+ * which the configuration thread creates for good.
+ *
+ * @param arg The Shared state.
+ * @return NULL.
+ */
+void	*produce(void *arg)
+{
+	Shared *shared = static_cast<Shared *>(arg);
+
+	for (unsigned long i = 0; i < shared->calls; ++i)
+	{
+		int n = static_cast<int>(i);
+		DEBUG(shared->leaf, "debug %d", n);
+		INFO(shared->leaf, "info %d from %s", n, "producer");
+		WARNING(shared->side, "warning %d", n);
+		CRITICAL(shared->leaf, "critical %d at %f", n, 0.5);
+		LOGGER_INFO("stress.a.b.c", "handle info %d", n);
+		if (i % 64 == 0)
+			ROOT_WARNING("root warning %d", n);
+		if (i % 16 == 0)
+		{
+			char name[32];
+			std::sprintf(name, "stress.a.b.c.d%lu", (i / 16) % 48);
+			logger::Logger *transient = retainLogger(name);
+			INFO(transient, "looked up %s", name);
+			transient->release();
+			INFO(getLoggerPtr("stress.a.b.c"), "looked up %s", "stress.a.b.c");
+		}
+	}
+	return (NULL);
+}
+
+/**
+ * @brief Body of the configuration thread: reconfigures the hierarchy until
+ * the producers are done.
+ *
+ * @param arg The Shared state.
+ * @return NULL.
+ */
+void	*configure(void *arg)
+{
+	Shared *shared = static_cast<Shared *>(arg);
+	std::ofstream devNull("/dev/null");
+	t_handlerPtr stream(new handler::StreamHandler(devNull));
+	t_handlerPtr file(new handler::FileHandler("/dev/null", std::ios_base::out));
+	const logRecord::e_LogLevel levels[] = { logRecord::DEBUG, logRecord::INFO, logRecord::ERROR, logRecord::NOTSET };
+
+	getLogger("stress.side")->addHandler(file);
+	for (unsigned long round = 0; !__atomic_load_n(&shared->done, __ATOMIC_ACQUIRE); ++round)
+	{
+		std::ostringstream name;
+		name << "stress.a.b.c.d" << round % 32;
+		getLogger(name.str());
+		if (round == 16)
+			getLogger("stress.a.b");
+		if (round == 64)
+			getLogger("stress.a");
+
+		shared->leaf->setLevel(levels[round % 4]);
+		shared->side->setPropagate(round % 2);
+		if (round % 3 == 0)
+			shared->leaf->addHandler(stream);
+		else
+			shared->leaf->removeHandler(stream);
+		if (round % 5 == 0)
+			stream->addFilter(filter::Filter("stress.a"));
+		else
+			stream->clearFilters();
+		stream->setFormatter(formatter::Formatter(round % 2 ? "%(asctime) %(name) %(message)" : "%(levelname): %(message)"));
+		file->setLevel(levels[round % 4]);
+		disable(round % 7 == 0 ? logRecord::DEBUG : logRecord::NOTSET);
+		reclaimLoggers();
+	}
+	shared->leaf->removeHandler(stream);
+	disable(logRecord::NOTSET);
+	return (NULL);
+}
+
+} // !namespace
+
+int main(int argc, char **argv)
+{
+	unsigned long producers = argc > 1 ? std::strtoul(argv[1], NULL, 10) : 4;
+	unsigned long calls = argc > 2 ? std::strtoul(argv[2], NULL, 10) : 20000;
+
+	CountingHandler *counter = new CountingHandler(logRecord::CRITICAL);
+	t_handlerPtr counterPtr(counter);
+	getLogger()->addHandler(counterPtr);
+
+	t_loggerPtr leaf = getLogger("stress.a.b.c");
+	t_loggerPtr side = getLogger("stress.side");
+	Shared shared;
+	shared.leaf = leaf.get();
+	shared.side = side.get();
+	shared.calls = calls;
+	shared.done = 0;
+
+	pthread_t configurator;
+	pthread_create(&configurator, NULL, configure, &shared);
+	std::vector<pthread_t> threads(producers);
+	for (unsigned long i = 0; i < producers; ++i)
+		pthread_create(&threads[i], NULL, produce, &shared);
+	for (unsigned long i = 0; i < producers; ++i)
+		pthread_join(threads[i], NULL);
+	__atomic_store_n(&shared.done, 1, __ATOMIC_RELEASE);
+	pthread_join(configurator, NULL);
+
+	unsigned long expected = producers * calls;
+	unsigned long received = counter->getCount();
+	std::cout << "log42_stress: " << producers << " producers, " << received << "/" << expected 
+		<< " critical records reached the root" << std::endl;
+
+	shutdown();
+	std::size_t pending = sync::Epoch::pending();
+	std::cout << "log42_stress: " << pending << " retired snapshots pending after shutdown" << std::endl;
+	return (received == expected && pending == 0 ? 0 : 1);
+}
+
+/* ************************************************************************** */
+/*                                                                            */
+/*                                MIT License                                 */
+/*                                                                            */
+/*   Copyright (c) 2025 Demont Pieric, Lucken Bénédict                        */
+/*                                                                            */
+/*   Inspired by the Python 'logging' module by Vinay Sajip.                  */
+/*   This implementation was rewritten in C++98 and contains no original      */
+/*   Python source code.                                                      */
+/*                                                                            */
+/*   Permission is hereby granted, free of charge, to any person obtaining    */
+/*   a copy of this software and associated documentation files (the          */
+/*   "Software"), to deal in the Software without restriction, including      */
+/*   without limitation the rights to use, copy, modify, merge, publish,      */
+/*   distribute, sublicense, and/or sell copies of the Software, and to       */
+/*   permit persons to whom the Software is furnished to do so, subject to    */
+/*   the following conditions:                                                */
+/*                                                                            */
+/*   The above copyright notice and this permission notice shall be included  */
+/*   in all copies or substantial portions of the Software.                   */
+/*                                                                            */
+/*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS  */
+/*   OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF               */
+/*   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.   */
+/*   IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY     */
+/*   CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,     */
+/*   TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE        */
+/*   SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                   */
+/*                                                                            */
+/* ************************************************************************** */
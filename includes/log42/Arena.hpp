@@ -0,0 +1,263 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   Arena.hpp                                          :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: pdemont <pdemont@student.42lausanne.ch>    +#+  +:+       +#+        */
+/*   By: blucken <blucken@student.42lausanne.ch>  +#+#+#+#+#+   +#+           */
+/*                                                     #+#    #+#             */
+/*   Created: 2026/10/18                              ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef LOG42_ARENA_HPP
+#define LOG42_ARENA_HPP
+
+/**
+ * @file Arena.hpp
+ * @brief Declares the per-thread arena, its scopes and the global pool used for
+ * transient per-record allocations.
+ */ 
+
+#include <cstddef>
+#include <new>
+#include <string>
+
+namespace log42
+{
+namespace arena
+{
+
+/**
+ * @class Arena
+ * @brief Thread-local bump allocator for the memory a record needs while it is
+ * being dispatched.
+ *
+ * Memory is carved out of retained chunks and handed back in bulk when the
+ * enclosing Scope ends, so a steady stream of log statements does not reach
+ * malloc once the chunks are warm. Each thread owns its arena; memory from an
+ * arena must neither cross threads nor outlive the Scope it was allocated in.
+ *
+ * @startuml
+ * class "Arena" as Arena {
+		+ {static} chunkSize : size_t
+		- _first : Chunk
+		- _current : Chunk
+		- _depth : size_t
+		--
+		+ {static} local() : Arena
+		+ allocate(size : size_t) : void
+		+ deallocate(ptr : void, size : size_t) : void
+		+ owns(ptr : void) : bool
+		+ isActive() : bool
+		- _grow(size : size_t) : void
+	}
+ * @enduml
+ */
+class Arena
+{
+	public:
+		static const std::size_t	chunkSize = 16384;
+		static const std::size_t	alignment = 16;
+
+		static Arena	&local();
+
+		void	*allocate(std::size_t size);
+		void	deallocate(void *ptr, std::size_t size);
+		bool	owns(const void *ptr) const;
+		bool	isActive() const;
+
+	private:
+		struct Chunk
+		{
+			Chunk		*next;
+			std::size_t	size;
+			std::size_t	used;
+			char		*data;
+		};
+
+		Chunk		*_first;
+		Chunk		*_current;
+		std::size_t	_depth;
+
+		Arena();
+		~Arena();
+
+		Arena(const Arena &rhs);
+		Arena &operator=(const Arena &rhs);
+
+		void	_grow(std::size_t size);
+
+		static void	_destroy(void *arena);
+		static void	_createKey();
+
+		friend class Scope;
+};
+
+/**
+ * @class Scope
+ * @brief RAII marker releasing everything allocated from the thread's arena
+ * since its construction.
+ *
+ * Scopes nest: an inner scope only rewinds to the point it was opened at, so a
+ * handler logging from inside emit() cannot release memory still in use by
+ * the outer dispatch.
+ *
+ * @startuml
+ * class "Scope" as Scope {
+		- _arena : Arena
+		- _chunk : Chunk
+		- _used : size_t
+		--
+		+ Scope()
+	}
+ * @enduml
+ */
+class Scope
+{
+	public:
+		Scope();
+		~Scope();
+
+	private:
+		Arena			&_arena;
+		Arena::Chunk	*_chunk;
+		std::size_t		_used;
+
+		Scope(const Scope &rhs);
+		Scope &operator=(const Scope &rhs);
+};
+
+/**
+ * @class Pool
+ * @brief Process-wide size-class allocator for payloads that may cross threads
+ * or outlive a dispatch, such as copied records.
+ *
+ * Freed blocks are kept on per-class free lists and reused, so records copied
+ * into buffers do not hit malloc in steady state either.
+ *
+ * @startuml
+ * class "Pool" as Pool {
+		+ {static} minBlock : size_t
+		+ {static} maxBlock : size_t
+		--
+		+ {static} allocate(size : size_t) : void
+		+ {static} deallocate(ptr : void, size : size_t) : void
+	}
+ * @enduml
+ */
+class Pool
+{
+	public:
+		static const std::size_t	minBlock = 64;
+		static const std::size_t	maxBlock = 65536;
+
+		static void	*allocate(std::size_t size);
+		static void	deallocate(void *ptr, std::size_t size);
+
+	private:
+		Pool();
+		~Pool();
+
+		Pool(const Pool &rhs);
+		Pool &operator=(const Pool &rhs);
+};
+
+/**
+ * @class Allocator
+ * @brief Standard allocator drawing from the thread's arena while a Scope is
+ * active and from the Pool otherwise.
+ *
+ * Used for the transient strings built while formatting a record.
+ */
+template <typename T>
+class Allocator
+{
+	public:
+		typedef T				value_type;
+		typedef T				*pointer;
+		typedef const T			*const_pointer;
+		typedef T				&reference;
+		typedef const T			&const_reference;
+		typedef std::size_t		size_type;
+		typedef std::ptrdiff_t	difference_type;
+
+		template <typename U>
+		struct rebind
+		{
+			typedef Allocator<U> other;
+		};
+
+		Allocator() {}
+		Allocator(const Allocator &) {}
+		template <typename U>
+		Allocator(const Allocator<U> &) {}
+		~Allocator() {}
+
+		pointer			address(reference x) const { return (&x); }
+		const_pointer	address(const_reference x) const { return (&x); }
+		size_type		max_size() const { return (static_cast<size_type>(-1) / sizeof(T)); }
+		void			construct(pointer p, const T &val) { new (static_cast<void *>(p)) T(val); }
+		void			destroy(pointer p) { p->~T(); }
+
+		pointer	allocate(size_type n, const void * = 0)
+		{
+			Arena &arena = Arena::local();
+			if (arena.isActive())
+				return (static_cast<pointer>(arena.allocate(n * sizeof(T))));
+			return (static_cast<pointer>(Pool::allocate(n * sizeof(T))));
+		}
+
+		void	deallocate(pointer p, size_type n)
+		{
+			Arena &arena = Arena::local();
+			if (arena.owns(p))
+				arena.deallocate(p, n * sizeof(T));
+			else
+				Pool::deallocate(p, n * sizeof(T));
+		}
+
+		bool	operator==(const Allocator &) const { return (true); }
+		bool	operator!=(const Allocator &) const { return (false); }
+};
+
+/**
+ * @brief String type for text built while a record is being dispatched.
+ */
+typedef std::basic_string<char, std::char_traits<char>, Allocator<char> >	t_string;
+
+} // !arena
+} // !log42
+
+#endif // !LOG42_ARENA_HPP
+
+/* ************************************************************************** */
+/*                                                                            */
+/*                                MIT License                                 */
+/*                                                                            */
+/*   Copyright (c) 2025 Demont Pieric, Lucken Bénédict                        */
+/*                                                                            */
+/*   Inspired by the Python 'logging' module by Vinay Sajip.                  */
+/*   This implementation was rewritten in C++98 and contains no original      */
+/*   Python source code.                                                      */
+/*                                                                            */
+/*   Permission is hereby granted, free of charge, to any person obtaining    */
+/*   a copy of this software and associated documentation files (the          */
+/*   "Software"), to deal in the Software without restriction, including      */
+/*   without limitation the rights to use, copy, modify, merge, publish,      */
+/*   distribute, sublicense, and/or sell copies of the Software, and to       */
+/*   permit persons to whom the Software is furnished to do so, subject to    */
+/*   the following conditions:                                                */
+/*                                                                            */
+/*   The above copyright notice and this permission notice shall be included  */
+/*   in all copies or substantial portions of the Software.                   */
+/*                                                                            */
+/*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS  */
+/*   OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF               */
+/*   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.   */
+/*   IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY     */
+/*   CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,     */
+/*   TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE        */
+/*   SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                   */
+/*                                                                            */
+/* ************************************************************************** */
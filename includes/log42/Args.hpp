@@ -0,0 +1,199 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   Args.hpp                                           :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: pdemont <pdemont@student.42lausanne.ch>    +#+  +:+       +#+        */
+/*   By: blucken <blucken@student.42lausanne.ch>  +#+#+#+#+#+   +#+           */
+/*                                                     #+#    #+#             */
+/*   Created: 2026/10/18                              ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef LOG42_ARGS_HPP
+#define LOG42_ARGS_HPP
+
+/**
+ * @file Args.hpp
+ * @brief Declares the Arg and Args classes, typed message arguments.
+ */ 
+
+#include <log42/Arena.hpp>
+#include <log42/StringRef.hpp>
+#include <cstddef>
+#include <string>
+#include <vector>
+
+namespace log42
+{
+
+/**
+ * @class Arg
+ * @brief A single message argument, captured by value with its type.
+ *
+ * Integers, floating point values, booleans, strings and pointers are
+ * stored as they are; they are only turned into text when the record is emitted, so a
+ * filtered record never pays for the conversion. String arguments are
+ * borrowed and must outlive the logging call, which the logging macros
+ * guarantee.
+ *
+ * @startuml
+ * class "Arg" as Arg {
+		- _type : e_Type
+		- _value : union
+		- _len : size_t
+		--
+		+ Arg(value : int)
+		+ Arg(value : long)
+		+ Arg(value : unsigned int)
+		+ Arg(value : unsigned long)
+		+ Arg(value : double)
+		+ Arg(value : bool)
+		+ Arg(value : char[])
+		+ Arg(value : string)
+		+ Arg(value : void)
+		+ getType() : e_Type
+		+ getString() : StringRef
+		+ encodedSize() : size_t
+		+ encode(dst : char[]) : char[]
+		+ {static} decode(src : char[], arg : Arg) : char[]
+		+ append(out : string, conversion : char) : void
+	}
+ * @enduml
+ */
+class Arg
+{
+	public:
+		/**
+		 * @brief Kind of value held by an argument.
+		 */
+		enum e_Type { NONE, INT, UINT, DOUBLE, STRING, POINTER, BOOL };
+
+		Arg();
+		Arg(int value);
+		Arg(long value);
+		Arg(unsigned int value);
+		Arg(unsigned long value);
+		Arg(double value);
+		Arg(bool value);
+		Arg(const char *value);
+		Arg(const std::string &value);
+		Arg(const void *value);
+		~Arg();
+
+		Arg(const Arg &rhs);
+		Arg &operator=(const Arg &rhs);
+
+		e_Type				getType() const;
+		StringRef			getString() const;
+		std::size_t			encodedSize() const;
+		char				*encode(char *dst) const;
+		static const char	*decode(const char *src, Arg &arg);
+		void				append(arena::t_string &out, char conversion) const;
+
+	private:
+		e_Type	_type;
+		union
+		{
+			long			i;
+			unsigned long	u;
+			double			d;
+			const char		*s;
+			const void		*p;
+			bool			b;
+		}		_value;
+		std::size_t	_len;
+};
+
+/**
+ * @class Args
+ * @brief The arguments of a logging call, up to maxArgs typed values.
+ *
+ * The logging macros wrap their trailing arguments in an Args, so
+ * `INFO(logger, "%d items in %s", count, name)` captures count and name
+ * without converting them. A pointer to a vector of strings is still
+ * accepted for callers of the former API.
+ *
+ * @startuml
+ * class "Args" as Args {
+		+ {static} maxArgs : size_t
+		- _args : Arg[maxArgs]
+		- _size : size_t
+		- _legacy : vector<string>
+		--
+		+ Args(a0 : Arg, ..., a7 : Arg)
+		+ Args(args : vector<string>)
+		+ size() : size_t
+		+ operator[](index : size_t) : Arg
+	}
+ * @enduml
+ */
+class Args
+{
+	public:
+		static const std::size_t	maxArgs = 8;
+
+		Args(const Arg &a0 = Arg(), const Arg &a1 = Arg(), const Arg &a2 = Arg(), const Arg &a3 = Arg(),
+			const Arg &a4 = Arg(), const Arg &a5 = Arg(), const Arg &a6 = Arg(), const Arg &a7 = Arg());
+		template <typename Alloc>
+		Args(const std::vector<std::string, Alloc> *args);
+		~Args();
+
+		Args(const Args &rhs);
+		Args &operator=(const Args &rhs);
+
+		std::size_t	size() const;
+		Arg			operator[](std::size_t index) const;
+
+	private:
+		Arg								_args[maxArgs];
+		std::size_t						_size;
+		const std::vector<std::string>	*_legacy;
+};
+
+/**
+ * @brief Wraps a vector of pre-formatted string arguments.
+ *
+ * A template so that a literal 0 passed as a message argument is captured as
+ * an integer rather than taken for a null vector.
+ *
+ * @param args The arguments, or NULL for none.
+ */
+template <typename Alloc>
+Args::Args(const std::vector<std::string, Alloc> *args) 
+	: _size(args ? args->size() : 0), _legacy(args) {}
+
+} // !log42
+
+#endif // !LOG42_ARGS_HPP
+
+/* ************************************************************************** */
+/*                                                                            */
+/*                                MIT License                                 */
+/*                                                                            */
+/*   Copyright (c) 2025 Demont Pieric, Lucken Bénédict                        */
+/*                                                                            */
+/*   Inspired by the Python 'logging' module by Vinay Sajip.                  */
+/*   This implementation was rewritten in C++98 and contains no original      */
+/*   Python source code.                                                      */
+/*                                                                            */
+/*   Permission is hereby granted, free of charge, to any person obtaining    */
+/*   a copy of this software and associated documentation files (the          */
+/*   "Software"), to deal in the Software without restriction, including      */
+/*   without limitation the rights to use, copy, modify, merge, publish,      */
+/*   distribute, sublicense, and/or sell copies of the Software, and to       */
+/*   permit persons to whom the Software is furnished to do so, subject to    */
+/*   the following conditions:                                                */
+/*                                                                            */
+/*   The above copyright notice and this permission notice shall be included  */
+/*   in all copies or substantial portions of the Software.                   */
+/*                                                                            */
+/*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS  */
+/*   OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF               */
+/*   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.   */
+/*   IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY     */
+/*   CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,     */
+/*   TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE        */
+/*   SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                   */
+/*                                                                            */
+/* ************************************************************************** */
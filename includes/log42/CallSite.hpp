@@ -0,0 +1,126 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   CallSite.hpp                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: pdemont <pdemont@student.42lausanne.ch>    +#+  +:+       +#+        */
+/*   By: blucken <blucken@student.42lausanne.ch>  +#+#+#+#+#+   +#+           */
+/*                                                     #+#    #+#             */
+/*   Created: 2026/10/18                              ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef LOG42_CALLSITE_HPP
+#define LOG42_CALLSITE_HPP
+
+/**
+ * @file CallSite.hpp
+ * @brief Declares the CallSite class holding the static source metadata of a
+ * logging statement.
+ */ 
+
+#include <log42/MessageTemplate.hpp>
+#include <log42/StringRef.hpp>
+#include <string>
+
+namespace log42
+{
+namespace logRecord
+{
+
+/**
+ * @class CallSite
+ * @brief Interned source location of a logging statement.
+ *
+ * Everything a record knows about where it was emitted from (path, file,
+ * module, function and line) is identical for every record of a given call
+ * site, so it is computed once, stored here and shared by pointer. Call sites
+ * are never destroyed; pointers returned by get() stay valid for the lifetime
+ * of the program.
+ *
+ * A call site also keeps the parsed template of the first message it logs,
+ * which is reused for as long as the statement logs the same text.
+ *
+ * @startuml
+ * class "CallSite" as CallSite {
+		- _pathname : string
+		- _filename : string
+		- _module : string
+		- _funcName : string
+		- _lineNo : int
+		- _template : MessageTemplate
+		--
+		+ {static} get(pathname : string, lineNo : int, funcName : string) : CallSite
+		+ getPathname() : string
+		+ getFilename() : string
+		+ getModule() : string
+		+ getFuncName() : string
+		+ getLineNo() : int
+		+ getTemplate(msg : string) : MessageTemplate
+	}
+ * @enduml
+ */
+class CallSite
+{
+	public:
+		static const CallSite	*get(const char *pathname, int lineNo, const char *funcName);
+
+		const char	*getPathname() const;
+		const char	*getFilename() const;
+		const char	*getModule() const;
+		const char	*getFuncName() const;
+		const int	&getLineNo() const;
+
+		const MessageTemplate	*getTemplate(const StringRef &msg) const;
+
+	private:
+		std::string	_pathname;
+		std::string	_filename;
+		std::string	_module;
+		std::string	_funcName;
+		int			_lineNo;
+
+		mutable const MessageTemplate	*_template;
+
+		CallSite(const char *pathname, int lineNo, const char *funcName);
+		~CallSite();
+
+		CallSite(const CallSite &rhs);
+		CallSite &operator=(const CallSite &rhs);
+};
+
+} // !logRecord
+} // !log42
+
+#endif // !LOG42_CALLSITE_HPP
+
+/* ************************************************************************** */
+/*                                                                            */
+/*                                MIT License                                 */
+/*                                                                            */
+/*   Copyright (c) 2025 Demont Pieric, Lucken Bénédict                        */
+/*                                                                            */
+/*   Inspired by the Python 'logging' module by Vinay Sajip.                  */
+/*   This implementation was rewritten in C++98 and contains no original      */
+/*   Python source code.                                                      */
+/*                                                                            */
+/*   Permission is hereby granted, free of charge, to any person obtaining    */
+/*   a copy of this software and associated documentation files (the          */
+/*   "Software"), to deal in the Software without restriction, including      */
+/*   without limitation the rights to use, copy, modify, merge, publish,      */
+/*   distribute, sublicense, and/or sell copies of the Software, and to       */
+/*   permit persons to whom the Software is furnished to do so, subject to    */
+/*   the following conditions:                                                */
+/*                                                                            */
+/*   The above copyright notice and this permission notice shall be included  */
+/*   in all copies or substantial portions of the Software.                   */
+/*                                                                            */
+/*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS  */
+/*   OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF               */
+/*   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.   */
+/*   IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY     */
+/*   CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,     */
+/*   TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE        */
+/*   SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                   */
+/*                                                                            */
+/* ************************************************************************** */
@@ -0,0 +1,108 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   CallbackPredicate.hpp                              :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: pdemont <pdemont@student.42lausanne.ch>    +#+  +:+       +#+        */
+/*   By: blucken <blucken@student.42lausanne.ch>  +#+#+#+#+#+   +#+           */
+/*                                                     #+#    #+#             */
+/*   Created: 2026/10/18                              ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+#ifndef LOG42_CALLBACKPREDICATE_HPP
+#define LOG42_CALLBACKPREDICATE_HPP
+
+/**
+ * @file CallbackPredicate.hpp
+ * @brief Declares the CallbackPredicate class wrapping a user function as a
+ * filter.
+ */ 
+
+#include <log42/LogRecord.hpp>
+#include <log42/Predicate.hpp>
+
+namespace log42
+{
+namespace filter
+{
+
+/**
+ * @class CallbackPredicate
+ * @brief Predicate delegating its decision to a user function.
+ *
+ * The function receives the record and an opaque context pointer. Its cost
+ * and whether it only reads the level and call site are declared by the
+ * caller; a callback declared static is only called once per call site and
+ * level.
+ *
+ * @startuml
+ * class "CallbackPredicate" as CallbackPredicate {
+		- _callback : t_callback
+		- _context : void
+		- _cost : unsigned int
+		- _static : bool
+		--
+		+ CallbackPredicate(callback : t_callback, context : void, cost : unsigned int, isStatic : bool)
+		+ test(record : LogRecord, owner : Filterer) : bool
+		+ getCost() : unsigned int
+		+ isStatic() : bool
+	}
+ * @enduml
+ */
+class CallbackPredicate : public Predicate
+{
+	public:
+		/**
+		 * @brief Decision function: returns true to pass the record.
+		 */
+		typedef bool	(*t_callback)(const logRecord::LogRecord &record, void *context);
+
+		CallbackPredicate(t_callback callback, void *context = NULL, const unsigned int cost = 50, const bool isStatic = false);
+		~CallbackPredicate();
+
+		bool			test(const logRecord::LogRecord &record, filterer::Filterer &owner) const;
+		unsigned int	getCost() const;
+		bool			isStatic() const;
+
+	private:
+		t_callback		_callback;
+		void			*_context;
+		unsigned int	_cost;
+		bool			_static;
+};
+
+} // !filter
+} // !log42
+
+#endif // !LOG42_CALLBACKPREDICATE_HPP
+
+/* ************************************************************************** */
+/*                                                                            */
+/*                                MIT License                                 */
+/*                                                                            */
+/*   Copyright (c) 2025 Demont Pieric, Lucken Bénédict                        */
+/*                                                                            */
+/*   Inspired by the Python 'logging' module by Vinay Sajip.                  */
+/*   This implementation was rewritten in C++98 and contains no original      */
+/*   Python source code.                                                      */
+/*                                                                            */
+/*   Permission is hereby granted, free of charge, to any person obtaining    */
+/*   a copy of this software and associated documentation files (the          */
+/*   "Software"), to deal in the Software without restriction, including      */
+/*   without limitation the rights to use, copy, modify, merge, publish,      */
+/*   distribute, sublicense, and/or sell copies of the Software, and to       */
+/*   permit persons to whom the Software is furnished to do so, subject to    */
+/*   the following conditions:                                                */
+/*                                                                            */
+/*   The above copyright notice and this permission notice shall be included  */
+/*   in all copies or substantial portions of the Software.                   */
+/*                                                                            */
+/*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS  */
+/*   OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF               */
+/*   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.   */
+/*   IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY     */
+/*   CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,     */
+/*   TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE        */
+/*   SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                   */
+/*                                                                            */
+/* ************************************************************************** */
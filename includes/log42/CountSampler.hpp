@@ -0,0 +1,99 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   CountSampler.hpp                                   :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: pdemont <pdemont@student.42lausanne.ch>    +#+  +:+       +#+        */
+/*   By: blucken <blucken@student.42lausanne.ch>  +#+#+#+#+#+   +#+           */
+/*                                                     #+#    #+#             */
+/*   Created: 2026/10/18                              ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+#ifndef LOG42_COUNTSAMPLER_HPP
+#define LOG42_COUNTSAMPLER_HPP
+
+/**
+ * @file CountSampler.hpp
+ * @brief Declares the CountSampler keeping one record in N per call site.
+ */ 
+
+#include <log42/Sampler.hpp>
+#include <cstddef>
+
+namespace log42
+{
+namespace filter
+{
+
+/**
+ * @class CountSampler
+ * @brief Keeps the first record of each call site, then one in N.
+ *
+ * Each call site counts its records in a fixed, direct-mapped table of
+ * counters; sites sharing a counter are sampled together, still keeping one
+ * record in N overall. A decision is one atomic increment.
+ *
+ * @startuml
+ * class "CountSampler" as CountSampler {
+		- _every : unsigned long
+		- _counts : unsigned long[]
+		- _mask : size_t
+		--
+		+ CountSampler(every : unsigned long, capacity : size_t)
+		+ getCost() : unsigned int
+		# _sample(site : CallSite) : bool
+	}
+ * @enduml
+ */
+class CountSampler : public Sampler
+{
+	public:
+		explicit CountSampler(const unsigned long every, const std::size_t capacity = 256);
+		~CountSampler();
+
+		unsigned int	getCost() const;
+
+	protected:
+		bool	_sample(const logRecord::CallSite *site) const;
+
+	private:
+		unsigned long			_every;
+		mutable unsigned long	*_counts;
+		std::size_t				_mask;
+};
+
+} // !filter
+} // !log42
+
+#endif // !LOG42_COUNTSAMPLER_HPP
+
+/* ************************************************************************** */
+/*                                                                            */
+/*                                MIT License                                 */
+/*                                                                            */
+/*   Copyright (c) 2025 Demont Pieric, Lucken Bénédict                        */
+/*                                                                            */
+/*   Inspired by the Python 'logging' module by Vinay Sajip.                  */
+/*   This implementation was rewritten in C++98 and contains no original      */
+/*   Python source code.                                                      */
+/*                                                                            */
+/*   Permission is hereby granted, free of charge, to any person obtaining    */
+/*   a copy of this software and associated documentation files (the          */
+/*   "Software"), to deal in the Software without restriction, including      */
+/*   without limitation the rights to use, copy, modify, merge, publish,      */
+/*   distribute, sublicense, and/or sell copies of the Software, and to       */
+/*   permit persons to whom the Software is furnished to do so, subject to    */
+/*   the following conditions:                                                */
+/*                                                                            */
+/*   The above copyright notice and this permission notice shall be included  */
+/*   in all copies or substantial portions of the Software.                   */
+/*                                                                            */
+/*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS  */
+/*   OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF               */
+/*   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.   */
+/*   IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY     */
+/*   CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,     */
+/*   TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE        */
+/*   SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                   */
+/*                                                                            */
+/* ************************************************************************** */
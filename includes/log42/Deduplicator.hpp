@@ -0,0 +1,157 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   Deduplicator.hpp                                   :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: pdemont <pdemont@student.42lausanne.ch>    +#+  +:+       +#+        */
+/*   By: blucken <blucken@student.42lausanne.ch>  +#+#+#+#+#+   +#+           */
+/*                                                     #+#    #+#             */
+/*   Created: 2026/10/18                              ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+#ifndef LOG42_DEDUPLICATOR_HPP
+#define LOG42_DEDUPLICATOR_HPP
+
+/**
+ * @file Deduplicator.hpp
+ * @brief Declares the Deduplicator predicate collapsing repeated messages.
+ */ 
+
+#include <log42/LogRecord.hpp>
+#include <log42/Predicate.hpp>
+#include <cstddef>
+
+namespace log42
+{
+namespace filter
+{
+
+/**
+ * @class Deduplicator
+ * @brief Collapses the repeats of a message logged within a time window
+ * into a single line and a repeat count.
+ *
+ * A record is identified by a hash of its logger name, level and rendered
+ * message. A run is the sequence of consecutive occurrences of a message
+ * from a logger: the first occurrence passes and opens a window, and
+ * repeats within the window are dropped and counted. The run ends when the
+ * window expires, when the logger logs a different message or when another
+ * message takes its slot; if it dropped repeats, a summary, "message
+ * repeated N times between <first> and <last>: <message>", is then logged
+ * at the level of the run through the logger or handler the Deduplicator
+ * is attached to, before the record that ended it.
+ *
+ * The window is measured from the first occurrence of the run, not from
+ * the last repeat, so a message repeated without pause passes and is
+ * summarized once per window rather than being held back for as long as
+ * it repeats.
+ *
+ * Occurrences are kept in a fixed, direct-mapped table, each slot guarded by
+ * its stripe lock, along with a table of the last message of each logger,
+ * so memory does not grow with the number of messages or loggers. A slot
+ * copies the logger name and the message into fixed buffers, cut with
+ * "..." past their capacity, so the filter does not allocate.
+ *
+ * @startuml
+ * class "Deduplicator" as Deduplicator {
+		- _window : long
+		- _slots : Slot[]
+		- _lasts : Last[]
+		- _mask : size_t
+		- _collapsed : unsigned long
+		--
+		+ Deduplicator(window : real, capacity : size_t)
+		+ test(record : LogRecord, owner : Filterer) : bool
+		+ getCost() : unsigned int
+		+ isStatic() : bool
+		+ getCollapsed() : unsigned long
+		- _flush(hash : unsigned long, owner : Filterer) : void
+		- _report(run : Slot, owner : Filterer) : void
+	}
+ * @enduml
+ */
+class Deduplicator : public Predicate
+{
+	public:
+		explicit Deduplicator(const double window = 10.0, const std::size_t capacity = 256);
+		~Deduplicator();
+
+		bool			test(const logRecord::LogRecord &record, filterer::Filterer &owner) const;
+		unsigned int	getCost() const;
+		bool			isStatic() const;
+		unsigned long	getCollapsed() const;
+
+	private:
+		/**
+		 * @brief Run of a message: its hash, the creation times, in
+		 * milliseconds, of its first and last occurrences, the number of
+		 * repeats dropped, and the level, call site, logger name and text
+		 * of its first occurrence. A null hash marks a free slot.
+		 */
+		struct Slot
+		{
+			unsigned long				hash;
+			long						first;
+			long						last;
+			unsigned long				repeats;
+			logRecord::e_LogLevel		level;
+			const logRecord::CallSite	*site;
+			char						name[64];
+			char						message[192];
+		};
+
+		/**
+		 * @brief Last message of a logger: the hash of its name and of the
+		 * message. A null logger hash marks a free entry.
+		 */
+		struct Last
+		{
+			unsigned long	logger;
+			unsigned long	hash;
+		};
+
+		long					_window;
+		Slot					*_slots;
+		Last					*_lasts;
+		std::size_t				_mask;
+		mutable unsigned long	_collapsed;
+
+		void	_flush(const unsigned long hash, filterer::Filterer &owner) const;
+		void	_report(const Slot &run, filterer::Filterer &owner) const;
+};
+
+} // !filter
+} // !log42
+
+#endif // !LOG42_DEDUPLICATOR_HPP
+
+/* ************************************************************************** */
+/*                                                                            */
+/*                                MIT License                                 */
+/*                                                                            */
+/*   Copyright (c) 2025 Demont Pieric, Lucken Bénédict                        */
+/*                                                                            */
+/*   Inspired by the Python 'logging' module by Vinay Sajip.                  */
+/*   This implementation was rewritten in C++98 and contains no original      */
+/*   Python source code.                                                      */
+/*                                                                            */
+/*   Permission is hereby granted, free of charge, to any person obtaining    */
+/*   a copy of this software and associated documentation files (the          */
+/*   "Software"), to deal in the Software without restriction, including      */
+/*   without limitation the rights to use, copy, modify, merge, publish,      */
+/*   distribute, sublicense, and/or sell copies of the Software, and to       */
+/*   permit persons to whom the Software is furnished to do so, subject to    */
+/*   the following conditions:                                                */
+/*                                                                            */
+/*   The above copyright notice and this permission notice shall be included  */
+/*   in all copies or substantial portions of the Software.                   */
+/*                                                                            */
+/*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS  */
+/*   OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF               */
+/*   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.   */
+/*   IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY     */
+/*   CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,     */
+/*   TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE        */
+/*   SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                   */
+/*                                                                            */
+/* ************************************************************************** */
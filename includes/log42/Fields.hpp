@@ -0,0 +1,137 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   Fields.hpp                                         :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: pdemont <pdemont@student.42lausanne.ch>    +#+  +:+       +#+        */
+/*   By: blucken <blucken@student.42lausanne.ch>  +#+#+#+#+#+   +#+           */
+/*                                                     #+#    #+#             */
+/*   Created: 2026/10/18                              ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef LOG42_FIELDS_HPP
+#define LOG42_FIELDS_HPP
+
+/**
+ * @file Fields.hpp
+ * @brief Declares the Fields class, the structured fields of a record.
+ */ 
+
+#include <log42/Args.hpp>
+#include <log42/StringRef.hpp>
+#include <cstddef>
+
+namespace log42
+{
+
+/**
+ * @class Fields
+ * @brief Typed key/value fields attached to a record, up to maxFields per
+ * call plus the fields of the logger.
+ *
+ * Keys and values are borrowed, like the arguments of a call, and copied
+ * once into the record's payload as a flat run of entries: the key,
+ * NUL-terminated, followed by the value in the Arg encoding. There is no
+ * map; a lookup walks the few entries of the record.
+ *
+ * @code
+ * LOG_FIELDS(logger, log42::logRecord::INFO,
+ *     log42::Fields().add("user", name).add("ms", 12.5).add("ok", true),
+ *     "login done");
+ * @endcode
+ *
+ * @startuml
+ * class "Fields" as Fields {
+		+ {static} maxFields : size_t
+		- _entries : Entry[maxFields]
+		- _size : size_t
+		- _encoded : StringRef
+		- _encodedCount : size_t
+		--
+		+ Fields()
+		+ add(key : string, value : Arg) : Fields
+		+ extend(encoded : string, count : size_t) : Fields
+		+ size() : size_t
+		+ encodedSize() : size_t
+		+ encode(dst : char[]) : char[]
+		+ {static} encodedSize(key : string, value : Arg) : size_t
+		+ {static} encode(dst : char[], key : string, value : Arg) : char[]
+		+ {static} decode(src : char[], key : char[], value : Arg) : char[]
+		+ {static} find(src : char[], count : size_t, key : string, value : Arg) : bool
+	}
+ * @enduml
+ */
+class Fields
+{
+	public:
+		static const std::size_t	maxFields = 8;
+
+		Fields();
+		~Fields();
+
+		Fields(const Fields &rhs);
+		Fields &operator=(const Fields &rhs);
+
+		Fields		&add(const StringRef &key, const Arg &value);
+		Fields		&extend(const StringRef &encoded, std::size_t count);
+		std::size_t	size() const;
+		std::size_t	encodedSize() const;
+		char		*encode(char *dst) const;
+
+		static std::size_t	encodedSize(const StringRef &key, const Arg &value);
+		static char			*encode(char *dst, const StringRef &key, const Arg &value);
+		static const char	*decode(const char *src, const char *&key, Arg &value);
+		static bool			find(const char *src, std::size_t count, const StringRef &key, Arg &value);
+
+	private:
+		/**
+		 * @brief A borrowed key and its value.
+		 */
+		struct Entry
+		{
+			const char	*key;
+			std::size_t	keyLen;
+			Arg			value;
+		};
+
+		Entry		_entries[maxFields];
+		std::size_t	_size;
+		StringRef	_encoded;
+		std::size_t	_encodedCount;
+};
+
+} // !log42
+
+#endif // !LOG42_FIELDS_HPP
+
+/* ************************************************************************** */
+/*                                                                            */
+/*                                MIT License                                 */
+/*                                                                            */
+/*   Copyright (c) 2025 Demont Pieric, Lucken Bénédict                        */
+/*                                                                            */
+/*   Inspired by the Python 'logging' module by Vinay Sajip.                  */
+/*   This implementation was rewritten in C++98 and contains no original      */
+/*   Python source code.                                                      */
+/*                                                                            */
+/*   Permission is hereby granted, free of charge, to any person obtaining    */
+/*   a copy of this software and associated documentation files (the          */
+/*   "Software"), to deal in the Software without restriction, including      */
+/*   without limitation the rights to use, copy, modify, merge, publish,      */
+/*   distribute, sublicense, and/or sell copies of the Software, and to       */
+/*   permit persons to whom the Software is furnished to do so, subject to    */
+/*   the following conditions:                                                */
+/*                                                                            */
+/*   The above copyright notice and this permission notice shall be included  */
+/*   in all copies or substantial portions of the Software.                   */
+/*                                                                            */
+/*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS  */
+/*   OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF               */
+/*   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.   */
+/*   IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY     */
+/*   CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,     */
+/*   TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE        */
+/*   SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                   */
+/*                                                                            */
+/* ************************************************************************** */
@@ -37,6 +37,7 @@ namespace filter
 		- _len : int
 		--
 		+ Filter(name : string)
+		+ getName() : string
 		+ filter(record : LogRecord) : bool
 	}
  * @enduml
@@ -53,7 +54,8 @@ class Filter
 		bool	operator<(const Filter &rhs) const;
 		bool	operator==(const Filter &rhs) const;
 
-		bool	filter(const logRecord::LogRecord &record) const;
+		const std::string	&getName() const;
+		bool				filter(const logRecord::LogRecord &record) const;
 
 	private:
 		std::string	_name;
@@ -0,0 +1,160 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   FilterSet.hpp                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: pdemont <pdemont@student.42lausanne.ch>    +#+  +:+       +#+        */
+/*   By: blucken <blucken@student.42lausanne.ch>  +#+#+#+#+#+   +#+           */
+/*                                                     #+#    #+#             */
+/*   Created: 2026/10/18                              ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+#ifndef LOG42_FILTERSET_HPP
+#define LOG42_FILTERSET_HPP
+
+/**
+ * @file FilterSet.hpp
+ * @brief Declares the FilterSet class holding the name filters and the
+ * predicates of a Filterer.
+ */ 
+
+#include <log42/Filter.hpp>
+#include <log42/FilterTrie.hpp>
+#include <log42/LogRecord.hpp>
+#include <log42/Predicate.hpp>
+#include <log42/types.hpp>
+#include <cstddef>
+
+namespace log42
+{
+namespace filter
+{
+
+/**
+ * @enum e_Match
+ * @brief How the filters of a set combine.
+ *
+ * ALL - A record passes if it passes every filter (the default).
+ * ANY - A record passes if it passes at least one filter.
+ *
+ * @startuml
+ * enum "e_Match" as e_Match {
+		ALL
+		ANY
+	}
+ * @enduml
+ */
+enum e_Match { ALL, ANY };
+
+/**
+ * @class FilterSet
+ * @brief Name filters and predicates applied together by a Filterer.
+ *
+ * Filters are applied cheapest first: the name filters, compiled into one
+ * FilterTrie, then the static predicates, then the dynamic ones, each group
+ * in increasing order of reported cost, stopping as soon as the outcome is
+ * known.
+ *
+ * The combined decision of the static predicates only depends on the
+ * record's call site and level. It is cached per thread in a direct-mapped
+ * table keyed by the set's version, the call site and the level, so it is
+ * computed once per call site rather than once per record. Every change to
+ * a set gives it a new, never reused version, which invalidates the
+ * entries of the previous one.
+ *
+ * @startuml
+ * class "FilterSet" as FilterSet {
+		- _names : FilterTrie
+		- _static : vector<Predicate>
+		- _dynamic : vector<Predicate>
+		- _match : e_Match
+		- _version : unsigned long
+		--
+		+ FilterSet()
+		+ insert(filter : Filter) : void
+		+ erase(filter : Filter) : void
+		+ insert(predicate : Predicate) : void
+		+ erase(predicate : Predicate) : void
+		+ clear() : void
+		+ setMatch(match : e_Match) : void
+		+ getMatch() : e_Match
+		+ size() : size_t
+		+ empty() : bool
+		+ filter(record : LogRecord, owner : Filterer) : bool
+		+ getFootprint() : size_t
+		- _changed() : void
+		- _testStatic(record : LogRecord, owner : Filterer) : bool
+		- _evaluate(predicates : vector<Predicate>, record : LogRecord, owner : Filterer) : bool
+	}
+ * @enduml
+ */
+class FilterSet
+{
+	public:
+		FilterSet();
+		~FilterSet();
+
+		FilterSet(const FilterSet &rhs);
+		FilterSet &operator=(const FilterSet &rhs);
+
+		void		insert(const Filter &filter);
+		void		erase(const Filter &filter);
+		void		insert(const common::core::raii::SharedPtr<Predicate> &predicate);
+		void		erase(const common::core::raii::SharedPtr<Predicate> &predicate);
+		void		clear();
+		void		setMatch(const e_Match match);
+		e_Match		getMatch() const;
+		std::size_t	size() const;
+		bool		empty() const;
+
+		bool		filter(const logRecord::LogRecord &record, filterer::Filterer &owner) const;
+		std::size_t	getFootprint() const;
+
+	private:
+		FilterTrie		_names;
+		t_predicates	_static;
+		t_predicates	_dynamic;
+		e_Match			_match;
+		unsigned long	_version;
+
+		void	_changed();
+		bool	_testStatic(const logRecord::LogRecord &record, filterer::Filterer &owner) const;
+		bool	_evaluate(const t_predicates &predicates, const logRecord::LogRecord &record,
+					filterer::Filterer &owner) const;
+};
+
+} // !filter
+} // !log42
+
+#endif // !LOG42_FILTERSET_HPP
+
+/* ************************************************************************** */
+/*                                                                            */
+/*                                MIT License                                 */
+/*                                                                            */
+/*   Copyright (c) 2025 Demont Pieric, Lucken Bénédict                        */
+/*                                                                            */
+/*   Inspired by the Python 'logging' module by Vinay Sajip.                  */
+/*   This implementation was rewritten in C++98 and contains no original      */
+/*   Python source code.                                                      */
+/*                                                                            */
+/*   Permission is hereby granted, free of charge, to any person obtaining    */
+/*   a copy of this software and associated documentation files (the          */
+/*   "Software"), to deal in the Software without restriction, including      */
+/*   without limitation the rights to use, copy, modify, merge, publish,      */
+/*   distribute, sublicense, and/or sell copies of the Software, and to       */
+/*   permit persons to whom the Software is furnished to do so, subject to    */
+/*   the following conditions:                                                */
+/*                                                                            */
+/*   The above copyright notice and this permission notice shall be included  */
+/*   in all copies or substantial portions of the Software.                   */
+/*                                                                            */
+/*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS  */
+/*   OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF               */
+/*   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.   */
+/*   IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY     */
+/*   CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,     */
+/*   TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE        */
+/*   SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                   */
+/*                                                                            */
+/* ************************************************************************** */
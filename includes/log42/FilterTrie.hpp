@@ -0,0 +1,139 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   FilterTrie.hpp                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: pdemont <pdemont@student.42lausanne.ch>    +#+  +:+       +#+        */
+/*   By: blucken <blucken@student.42lausanne.ch>  +#+#+#+#+#+   +#+           */
+/*                                                     #+#    #+#             */
+/*   Created: 2026/10/18                              ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+#ifndef LOG42_FILTERTRIE_HPP
+#define LOG42_FILTERTRIE_HPP
+
+/**
+ * @file FilterTrie.hpp
+ * @brief Declares the FilterTrie class compiling a set of name filters into
+ * one prefix trie.
+ */ 
+
+#include <log42/Filter.hpp>
+#include <log42/types.hpp>
+#include <cstddef>
+#include <vector>
+
+namespace log42
+{
+namespace filter
+{
+
+/**
+ * @class FilterTrie
+ * @brief Set of name filters compiled into a character trie.
+ *
+ * Every filter with a non-empty name marks the trie node its name ends on.
+ * Evaluating the whole set is one walk over the record's logger name,
+ * counting the marked nodes met at the end of a dotted component: the
+ * filters passed are exactly those counted. The walk stops at the first
+ * character with no edge, allocates nothing and does not depend on the
+ * number of filters.
+ *
+ * The trie is rebuilt by every change to the set, which is meant to be
+ * rare; it is published as part of a FilterSet.
+ *
+ * @startuml
+ * class "FilterTrie" as FilterTrie {
+		- _filters : set<Filter>
+		- _nodes : vector<TrieNode>
+		- _prefixes : size_t
+		--
+		+ FilterTrie()
+		+ insert(filter : Filter) : void
+		+ erase(filter : Filter) : void
+		+ clear() : void
+		+ size() : size_t
+		+ empty() : bool
+		+ passesAll(name : char[]) : bool
+		+ passesAny(name : char[]) : bool
+		+ getFootprint() : size_t
+		- _compile() : void
+		- _count(name : char[], limit : size_t) : size_t
+	}
+ * @enduml
+ */
+class FilterTrie
+{
+	public:
+		FilterTrie();
+		~FilterTrie();
+
+		FilterTrie(const FilterTrie &rhs);
+		FilterTrie &operator=(const FilterTrie &rhs);
+
+		void		insert(const Filter &filter);
+		void		erase(const Filter &filter);
+		void		clear();
+		std::size_t	size() const;
+		bool		empty() const;
+
+		bool		passesAll(const char *name) const;
+		bool		passesAny(const char *name) const;
+		std::size_t	getFootprint() const;
+
+	private:
+		/**
+		 * @brief Trie node reached by one character. Children are a list
+		 * linked through their indexes; index 0, the root, ends a list.
+		 */
+		struct TrieNode
+		{
+			unsigned int	child;
+			unsigned int	sibling;
+			char			c;
+			bool			terminal;
+		};
+
+		t_filters				_filters;
+		std::vector<TrieNode>	_nodes;
+		std::size_t				_prefixes;
+
+		void		_compile();
+		std::size_t	_count(const char *name, std::size_t limit) const;
+};
+
+} // !filter
+} // !log42
+
+#endif // !LOG42_FILTERTRIE_HPP
+
+/* ************************************************************************** */
+/*                                                                            */
+/*                                MIT License                                 */
+/*                                                                            */
+/*   Copyright (c) 2025 Demont Pieric, Lucken Bénédict                        */
+/*                                                                            */
+/*   Inspired by the Python 'logging' module by Vinay Sajip.                  */
+/*   This implementation was rewritten in C++98 and contains no original      */
+/*   Python source code.                                                      */
+/*                                                                            */
+/*   Permission is hereby granted, free of charge, to any person obtaining    */
+/*   a copy of this software and associated documentation files (the          */
+/*   "Software"), to deal in the Software without restriction, including      */
+/*   without limitation the rights to use, copy, modify, merge, publish,      */
+/*   distribute, sublicense, and/or sell copies of the Software, and to       */
+/*   permit persons to whom the Software is furnished to do so, subject to    */
+/*   the following conditions:                                                */
+/*                                                                            */
+/*   The above copyright notice and this permission notice shall be included  */
+/*   in all copies or substantial portions of the Software.                   */
+/*                                                                            */
+/*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS  */
+/*   OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF               */
+/*   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.   */
+/*   IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY     */
+/*   CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,     */
+/*   TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE        */
+/*   SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                   */
+/*                                                                            */
+/* ************************************************************************** */
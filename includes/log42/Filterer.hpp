@@ -20,7 +20,10 @@
  */ 
 
 #include <log42/Filter.hpp>
+#include <log42/FilterSet.hpp>
+#include <log42/Predicate.hpp>
 #include <log42/LogRecord.hpp>
+#include <log42/Sync.hpp>
 #include <log42/types.hpp>
 
 namespace log42
@@ -32,15 +35,35 @@ namespace filterer
  * @class Filterer
  * @brief Manages a set of filters and applies them to log records.
  *
+ * The set is copy-on-write: filter() reads the current version without
+ * locking while filters are added or removed from other threads. Each
+ * version is compiled into a prefix trie, so applying any number of name
+ * filters is one walk over the record's logger name. Predicates (level
+ * ranges, message tests, callbacks, ...) are applied after it, cheapest
+ * first, and the decisions of those that only read the call site and level
+ * are cached per call site. By default a record must pass every filter;
+ * setMatch(filter::ANY) makes the filters an allow-list instead.
+ *
+ * A predicate that reports the records it held back hands its summary to
+ * the filterer applying it, through _handleSummary(), so the summary goes
+ * only where the records it stands for would have gone.
+ *
  * @startuml
  * class "Filterer" as Filterer {
-		- _filters : set<Filter>
+		- _filters : Published<FilterSet>
 		--
 		+ Filterer()
 		+ addFilter(filter : Filter) : void
+		+ addFilter(predicate : Predicate) : void
 		+ removeFilter(filter : Filter) : void
+		+ removeFilter(predicate : Predicate) : void
 		+ clearFilters() : void
+		+ setMatch(match : e_Match) : void
+		+ getMatch() : e_Match
+		+ getFilterCount() : size_t
+		+ getFilterFootprint() : size_t
 		+ filter(record : LogRecord) : bool
+		# _handleSummary(record : LogRecord) : void
 	}
  * @enduml
  */
@@ -54,13 +77,24 @@ class Filterer
 		Filterer &operator=(const Filterer &rhs);
 
 		void			addFilter(const filter::Filter &filter);
+		void			addFilter(const common::core::raii::SharedPtr<filter::Predicate> &predicate);
 		void			removeFilter(const filter::Filter &filter);
+		void			removeFilter(const common::core::raii::SharedPtr<filter::Predicate> &predicate);
 		void			clearFilters();
+		void			setMatch(const filter::e_Match match);
+		filter::e_Match	getMatch() const;
+		std::size_t		getFilterCount() const;
+		std::size_t		getFilterFootprint() const;
 
-		virtual bool	filter(const logRecord::LogRecord &record) const;
+		virtual bool	filter(const logRecord::LogRecord &record);
+
+	protected:
+		virtual void	_handleSummary(logRecord::LogRecord &record);
 
 	private:
-		t_filters	_filters;
+		sync::Published<filter::FilterSet>	_filters;
+
+		friend class filter::Predicate;
 };
 
 } // !filterer
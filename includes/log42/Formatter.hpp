@@ -19,7 +19,9 @@
  * customizable formats and time handling.
  */ 
 
+#include <log42/Arena.hpp>
 #include <log42/PercentStyle.hpp>
+#include <log42/StringRef.hpp>
 #include <log42/types.hpp>
 #include <ctime>
 
@@ -33,11 +35,15 @@ namespace formatter
  * @brief Formats log records using percent-style formatting and optional time
  * formatting.
  *
+ * The compiled style is immutable and shared by the copies of a formatter,
+ * so a subclass that installs its own style, such as JsonFormatter, keeps
+ * its output once copied into a handler.
+ *
  * @startuml
  * class "Formatter" as Formatter {
 		+ defaultPercentFormat : string
 		+ defaultTimeFormat : string
-		- _style : PercentStyle
+		- _style : SharedPtr<PercentStyle>
 		- _fmt : string
 		- _datefmt : string
 		--
@@ -46,7 +52,10 @@ namespace formatter
 		+ formatTime(record : LogRecord, datefmt : string) : string
 		+ formatMessage(record : LogRecord) : string
 		+ format(record : LogRecord) : string
-		- {static} _converter(time_t) : time
+		+ format(record : LogRecord, out : string) : void
+		# Formatter(style : PercentStyle, datefmt : string, validate : bool)
+		- {static} _converter(time_t, tm) : tm
+		- _formatTime(record : LogRecord, datefmt : string, buffer : char*) : size_t
 	}
  * @enduml
  */
@@ -60,7 +69,7 @@ class Formatter
 			const std::string &datefmt = defaultTimeFormat, 
 			bool validate = true,
 			const t_defaults defaults = std::map<std::string, std::string>());
-		~Formatter();
+		virtual ~Formatter();
 
 		Formatter(const Formatter &rhs);
 		Formatter &operator=(const Formatter &rhs);
@@ -68,14 +77,21 @@ class Formatter
 		bool		useTime() const;
 		std::string	formatTime(const logRecord::LogRecord &record, const std::string &datefmt = "") const;
 		std::string	formatMessage(const logRecord::LogRecord &record) const;
-		std::string	format(logRecord::LogRecord &record) const;
+		std::string	format(const logRecord::LogRecord &record) const;
+		void		format(const logRecord::LogRecord &record, arena::t_string &out) const;
 
+	protected:
+		Formatter(const common::core::raii::SharedPtr<style::PercentStyle> &style, const std::string &datefmt, bool validate);
 
 	private:
-		static struct std::tm		*(*_converter)(const time_t *);
-		style::PercentStyle			_style;
+		static const std::size_t	timeBufferSize = 128;
+
+		static struct std::tm		*(*_converter)(const time_t *, struct std::tm *);
+		common::core::raii::SharedPtr<style::PercentStyle>	_style;
 		std::string					_fmt;
 		std::string					_datefmt;
+
+		std::size_t	_formatTime(const logRecord::LogRecord &record, const std::string &datefmt, char *buffer) const;
 };
 
 } // !formatter
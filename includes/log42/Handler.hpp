@@ -18,9 +18,11 @@
  * @brief Declares the Handler base class for processing and emitting log records.
  */ 
 
+#include <log42/Arena.hpp>
 #include <log42/Filterer.hpp>
 #include <log42/Formatter.hpp>
 #include <log42/LogRecord.hpp>
+#include <log42/Sync.hpp>
 #include <log42/types.hpp>
 
 namespace log42
@@ -33,6 +35,9 @@ namespace handler
  * @brief Abstract base class for log handlers that process and emit log records.
  *        Supports filtering, formatting, and error handling.
  *
+ * Records are filtered concurrently and emitted under a per-handler recursive
+ * lock, so subclasses implement emit() as if it were single-threaded.
+ *
  * @startuml
  * class "FileHandler" as FileHandler {
 		- _baseFilename : string
@@ -62,7 +67,10 @@ class Handler : public filterer::Filterer
 		logRecord::e_LogLevel		getLevel() const;
 		void						setLevel(const logRecord::e_LogLevel level);
 		std::string					format(logRecord::LogRecord &record) const;
+		void						format(const logRecord::LogRecord &record, arena::t_string &out) const;
 		virtual void				emit(logRecord::LogRecord &record) = 0;
+		void						acquire();
+		void						release();
 		bool						handle(logRecord::LogRecord &record);
 		const formatter::Formatter	&getFormatter() const;
 		void						setFormatter(const formatter::Formatter &fmt);
@@ -76,6 +84,9 @@ class Handler : public filterer::Filterer
 		logRecord::e_LogLevel	_level;
 		formatter::Formatter	_formatter;
 		bool					_closed;
+		sync::Mutex				_lock;
+
+		virtual void	_handleSummary(logRecord::LogRecord &record);
 };
 
 } // !handler
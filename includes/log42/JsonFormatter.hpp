@@ -0,0 +1,103 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   JsonFormatter.hpp                                  :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: pdemont <pdemont@student.42lausanne.ch>    +#+  +:+       +#+        */
+/*   By: blucken <blucken@student.42lausanne.ch>  +#+#+#+#+#+   +#+           */
+/*                                                     #+#    #+#             */
+/*   Created: 2026/10/18                              ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef LOG42_JSONFORMATTER_HPP
+#define LOG42_JSONFORMATTER_HPP
+
+/**
+ * @file JsonFormatter.hpp
+ * @brief Declares the JsonFormatter class for JSON lines output.
+ */ 
+
+#include <log42/Formatter.hpp>
+#include <log42/types.hpp>
+#include <string>
+
+namespace log42
+{
+namespace formatter
+{
+
+/**
+ * @class JsonFormatter
+ * @brief Formats each log record as one JSON object, for JSON lines output.
+ *
+ * The format string names the members, as placeholders (see JsonStyle);
+ * the structured fields of the record are added after them. The default
+ * gives:
+ *
+ * @code
+ * {"asctime":"2025-01-01T12:00:00.042+0100","levelname":"INFO","name":"app","message":"login done","filename":"main.cpp","lineno":42,"funcName":"run","user":"alice","ms":12.5}
+ * @endcode
+ *
+ * A JsonFormatter copied into a handler as a Formatter keeps formatting
+ * JSON, since the copy shares its style.
+ *
+ * @startuml
+ * class "JsonFormatter" as JsonFormatter [[classlog42_1_1formatter_1_1_json_formatter.html]] {
+		+ {static} defaultJsonFormat : string
+		+ {static} defaultJsonTimeFormat : string
+		--
+		+ JsonFormatter(fmt : string, datefmt : string, defaults : map<string, string>)
+	}
+ * @enduml
+ */
+class JsonFormatter : public Formatter
+{
+	public:
+		static const std::string	defaultJsonFormat;
+		static const std::string	defaultJsonTimeFormat;
+
+		explicit JsonFormatter(const std::string &fmt = defaultJsonFormat,
+			const std::string &datefmt = defaultJsonTimeFormat,
+			const t_defaults defaults = std::map<std::string, std::string>());
+		virtual ~JsonFormatter();
+
+		JsonFormatter(const JsonFormatter &rhs);
+		JsonFormatter &operator=(const JsonFormatter &rhs);
+};
+
+} // !formatter
+} // !log42
+
+#endif // !LOG42_JSONFORMATTER_HPP
+
+/* ************************************************************************** */
+/*                                                                            */
+/*                                MIT License                                 */
+/*                                                                            */
+/*   Copyright (c) 2025 Demont Pieric, Lucken Bénédict                        */
+/*                                                                            */
+/*   Inspired by the Python 'logging' module by Vinay Sajip.                  */
+/*   This implementation was rewritten in C++98 and contains no original      */
+/*   Python source code.                                                      */
+/*                                                                            */
+/*   Permission is hereby granted, free of charge, to any person obtaining    */
+/*   a copy of this software and associated documentation files (the          */
+/*   "Software"), to deal in the Software without restriction, including      */
+/*   without limitation the rights to use, copy, modify, merge, publish,      */
+/*   distribute, sublicense, and/or sell copies of the Software, and to       */
+/*   permit persons to whom the Software is furnished to do so, subject to    */
+/*   the following conditions:                                                */
+/*                                                                            */
+/*   The above copyright notice and this permission notice shall be included  */
+/*   in all copies or substantial portions of the Software.                   */
+/*                                                                            */
+/*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS  */
+/*   OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF               */
+/*   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.   */
+/*   IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY     */
+/*   CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,     */
+/*   TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE        */
+/*   SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                   */
+/*                                                                            */
+/* ************************************************************************** */
@@ -0,0 +1,119 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   JsonStyle.hpp                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: pdemont <pdemont@student.42lausanne.ch>    +#+  +:+       +#+        */
+/*   By: blucken <blucken@student.42lausanne.ch>  +#+#+#+#+#+   +#+           */
+/*                                                     #+#    #+#             */
+/*   Created: 2026/10/18                              ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef LOG42_JSONSTYLE_HPP
+#define LOG42_JSONSTYLE_HPP
+
+/**
+ * @file JsonStyle.hpp
+ * @brief Declares the JsonStyle class for JSON formatting of log records.
+ */ 
+
+#include <log42/Arena.hpp>
+#include <log42/Args.hpp>
+#include <log42/LogRecord.hpp>
+#include <log42/PercentStyle.hpp>
+#include <log42/StringRef.hpp>
+#include <log42/types.hpp>
+#include <string>
+#include <vector>
+
+namespace log42
+{
+namespace style
+{
+
+/**
+ * @class JsonStyle
+ * @brief Formats a log record as a single-line JSON object.
+ *
+ * The format string only selects the members: each placeholder becomes a
+ * member named after it, in order, and literal text is ignored. Numeric
+ * attributes are JSON numbers and the others strings. A placeholder naming
+ * a structured field takes its typed value, or the default of that name,
+ * and is left out when neither exists; the remaining fields of the record
+ * follow, the first of each key only.
+ *
+ * Strings are escaped straight into the output buffer by a scan that tests
+ * a machine word at a time and only looks at single bytes in words holding
+ * a quote, a backslash or a control character. Other bytes, UTF-8 included,
+ * are copied as they are. The quoted member names are built once, when the
+ * format string is compiled.
+ *
+ * @startuml
+ * class "JsonStyle" as JsonStyle [[classlog42_1_1style_1_1_json_style.html]] {
+		- _keys : vector<string>
+		--
+		+ JsonStyle(fmt : string, defaults : map<string, string>)
+		# _format(record : LogRecord, asctime : string, out : string) : void
+		- _appendAttribute(record : LogRecord, field : e_Field, asctime : string, out : string) : void
+		- _isNamed(key : char[]) : bool
+		- {static} _appendValue(value : Arg, out : string) : void
+	}
+ * @enduml
+ */
+class JsonStyle : public PercentStyle
+{
+	public:
+		explicit JsonStyle(const std::string &fmt,
+			const t_defaults defaults = std::map<std::string, std::string>());
+		virtual ~JsonStyle();
+
+		JsonStyle(const JsonStyle &rhs);
+		JsonStyle &operator=(const JsonStyle &rhs);
+
+	protected:
+		virtual void	_format(const logRecord::LogRecord &record, const StringRef &asctime, arena::t_string &out) const;
+
+	private:
+		std::vector<std::string>	_keys;
+
+		void		_appendAttribute(const logRecord::LogRecord &record, e_Field field, const StringRef &asctime, arena::t_string &out) const;
+		bool		_isNamed(const char *key) const;
+		static void	_appendValue(const Arg &value, arena::t_string &out);
+};
+
+} // !style
+} // !log42
+
+#endif // !LOG42_JSONSTYLE_HPP
+
+/* ************************************************************************** */
+/*                                                                            */
+/*                                MIT License                                 */
+/*                                                                            */
+/*   Copyright (c) 2025 Demont Pieric, Lucken Bénédict                        */
+/*                                                                            */
+/*   Inspired by the Python 'logging' module by Vinay Sajip.                  */
+/*   This implementation was rewritten in C++98 and contains no original      */
+/*   Python source code.                                                      */
+/*                                                                            */
+/*   Permission is hereby granted, free of charge, to any person obtaining    */
+/*   a copy of this software and associated documentation files (the          */
+/*   "Software"), to deal in the Software without restriction, including      */
+/*   without limitation the rights to use, copy, modify, merge, publish,      */
+/*   distribute, sublicense, and/or sell copies of the Software, and to       */
+/*   permit persons to whom the Software is furnished to do so, subject to    */
+/*   the following conditions:                                                */
+/*                                                                            */
+/*   The above copyright notice and this permission notice shall be included  */
+/*   in all copies or substantial portions of the Software.                   */
+/*                                                                            */
+/*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS  */
+/*   OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF               */
+/*   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.   */
+/*   IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY     */
+/*   CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,     */
+/*   TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE        */
+/*   SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                   */
+/*                                                                            */
+/* ************************************************************************** */
@@ -0,0 +1,98 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   LevelRange.hpp                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: pdemont <pdemont@student.42lausanne.ch>    +#+  +:+       +#+        */
+/*   By: blucken <blucken@student.42lausanne.ch>  +#+#+#+#+#+   +#+           */
+/*                                                     #+#    #+#             */
+/*   Created: 2026/10/18                              ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+#ifndef LOG42_LEVELRANGE_HPP
+#define LOG42_LEVELRANGE_HPP
+
+/**
+ * @file LevelRange.hpp
+ * @brief Declares the LevelRange predicate passing the records within a
+ * range of levels.
+ */ 
+
+#include <log42/LogRecord.hpp>
+#include <log42/Predicate.hpp>
+
+namespace log42
+{
+namespace filter
+{
+
+/**
+ * @class LevelRange
+ * @brief Static predicate passing the records whose level lies within a
+ * range, bounds included.
+ *
+ * Unlike a handler's level, which is only a lower bound, a range can keep
+ * for instance the WARNING records out of a handler that only wants INFO.
+ *
+ * @startuml
+ * class "LevelRange" as LevelRange {
+		- _min : e_LogLevel
+		- _max : e_LogLevel
+		--
+		+ LevelRange(min : e_LogLevel, max : e_LogLevel)
+		+ test(record : LogRecord, owner : Filterer) : bool
+		+ getCost() : unsigned int
+		+ isStatic() : bool
+	}
+ * @enduml
+ */
+class LevelRange : public Predicate
+{
+	public:
+		LevelRange(const logRecord::e_LogLevel min, const logRecord::e_LogLevel max = logRecord::CRITICAL);
+		~LevelRange();
+
+		bool			test(const logRecord::LogRecord &record, filterer::Filterer &owner) const;
+		unsigned int	getCost() const;
+		bool			isStatic() const;
+
+	private:
+		logRecord::e_LogLevel	_min;
+		logRecord::e_LogLevel	_max;
+};
+
+} // !filter
+} // !log42
+
+#endif // !LOG42_LEVELRANGE_HPP
+
+/* ************************************************************************** */
+/*                                                                            */
+/*                                MIT License                                 */
+/*                                                                            */
+/*   Copyright (c) 2025 Demont Pieric, Lucken Bénédict                        */
+/*                                                                            */
+/*   Inspired by the Python 'logging' module by Vinay Sajip.                  */
+/*   This implementation was rewritten in C++98 and contains no original      */
+/*   Python source code.                                                      */
+/*                                                                            */
+/*   Permission is hereby granted, free of charge, to any person obtaining    */
+/*   a copy of this software and associated documentation files (the          */
+/*   "Software"), to deal in the Software without restriction, including      */
+/*   without limitation the rights to use, copy, modify, merge, publish,      */
+/*   distribute, sublicense, and/or sell copies of the Software, and to       */
+/*   permit persons to whom the Software is furnished to do so, subject to    */
+/*   the following conditions:                                                */
+/*                                                                            */
+/*   The above copyright notice and this permission notice shall be included  */
+/*   in all copies or substantial portions of the Software.                   */
+/*                                                                            */
+/*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS  */
+/*   OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF               */
+/*   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.   */
+/*   IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY     */
+/*   CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,     */
+/*   TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE        */
+/*   SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                   */
+/*                                                                            */
+/* ************************************************************************** */
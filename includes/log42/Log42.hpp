@@ -20,54 +20,73 @@
  */ 
 
 #include <log42/BufferingFormatter.hpp>
+#include <log42/CallbackPredicate.hpp>
+#include <log42/CountSampler.hpp>
+#include <log42/Deduplicator.hpp>
+#include <log42/Fields.hpp>
 #include <log42/FileHandler.hpp>
 #include <log42/Filter.hpp>
 #include <log42/Filterer.hpp>
 #include <log42/Formatter.hpp>
 #include <log42/Handler.hpp>
+#include <log42/JsonFormatter.hpp>
+#include <log42/LevelRange.hpp>
 #include <log42/Logger.hpp>
+#include <log42/LoggerHandle.hpp>
+#include <log42/LogStream.hpp>
 #include <log42/Manager.hpp>
+#include <log42/MessageContains.hpp>
+#include <log42/RandomSampler.hpp>
+#include <log42/RateLimit.hpp>
+#include <log42/ReservoirSampler.hpp>
 #include <log42/StreamHandler.hpp>
 #include <log42/types.hpp>
 #include <fstream>
 #include <set>
 #include <string>
 
+/**
+ * The ROOT_* macros log through a root handle kept at the call site (see
+ * LoggerHandle.hpp): the root is configured on first use, then a disabled
+ * call is a cached level check and its arguments are not evaluated. They
+ * are statements, not expressions.
+ */
+
 /**
  * @def ROOT_DEBUG(msg, ...)
  * @brief Logs a debug message using the root logger, including file, line, and function info.
  */
-#define ROOT_DEBUG(msg, ...)	log42::ensureRootReady()->debug((msg), __FILE__, __LINE__, __FUNCTION__, ##__VA_ARGS__)
+#define ROOT_DEBUG(msg, ...)		LOGGER_LOG("", log42::logRecord::DEBUG, msg, __VA_ARGS__)
 /**
  * @def ROOT_INFO(msg, ...)
  * @brief Logs an info message using the root logger, including file, line, and function info.
  */
-#define ROOT_INFO(msg, ...)		log42::ensureRootReady()->info((msg), __FILE__, __LINE__, __FUNCTION__, ##__VA_ARGS__)
+#define ROOT_INFO(msg, ...)			LOGGER_LOG("", log42::logRecord::INFO, msg, __VA_ARGS__)
 /**
  * @def ROOT_WARNING(msg, ...)
  * @brief Logs a warning message using the root logger, including file, line, and function info.
  */
-#define ROOT_WARNING(msg, ...)	log42::ensureRootReady()->warning((msg), __FILE__, __LINE__, __FUNCTION__, ##__VA_ARGS__)
+#define ROOT_WARNING(msg, ...)		LOGGER_LOG("", log42::logRecord::WARNING, msg, __VA_ARGS__)
 /**
  * @def ROOT_ERROR(msg, ...)
  * @brief Logs an error message using the root logger, including file, line, and function info.
  */
-#define ROOT_ERROR(msg, ...)	log42::ensureRootReady()->error((msg), __FILE__, __LINE__, __FUNCTION__, ##__VA_ARGS__)
+#define ROOT_ERROR(msg, ...)		LOGGER_LOG("", log42::logRecord::ERROR, msg, __VA_ARGS__)
 /**
  * @def ROOT_CRITICAL(msg, ...)
  * @brief Logs a critical message using the root logger, including file, line, and function info.
  */
-#define ROOT_CRITICAL(msg, ...)	log42::ensureRootReady()->critical((msg), __FILE__, __LINE__, __FUNCTION__, ##__VA_ARGS__)
+#define ROOT_CRITICAL(msg, ...)		LOGGER_LOG("", log42::logRecord::CRITICAL, msg, __VA_ARGS__)
 /**
  * @def ROOT_EXCEPTION(msg, ...)
  * @brief Logs an exception message using the root logger, including file, line, and function info.
  */
-#define ROOT_EXCEPTION(msg, ...)log42::ensureRootReady()->exception((msg), __FILE__, __LINE__, __FUNCTION__, ##__VA_ARGS__)
+#define ROOT_EXCEPTION(msg, ...)	LOGGER_LOG("", log42::logRecord::ERROR, msg, __VA_ARGS__)
 /**
- * @def ROOT_LOG(msg, ...)
+ * @def ROOT_LOG(level, msg, ...)
  * @brief Logs a message at a custom level using the root logger, including file, line, and function info.
  */
-#define ROOT_LOG(msg, ...)		log42::ensureRootReady()->log((msg), __FILE__, __LINE__, __FUNCTION__, ##__VA_ARGS__)
+#define ROOT_LOG(level, msg, ...)	LOGGER_LOG("", level, msg, __VA_ARGS__)
 
 namespace log42
 {
@@ -84,16 +103,19 @@ void	basicConfig(
 );
 
 common::core::raii::SharedPtr<logger::Logger> getLogger(const std::string &name = "");
-common::core::raii::SharedPtr<logger::Logger> ensureRootReady();
+logger::Logger *getLoggerPtr(const StringRef &name = "");
+logger::Logger *retainLogger(const StringRef &name = "");
+std::size_t reclaimLoggers();
+logger::Logger *ensureRootReady();
 
-void debug(const std::string &msg, const std::string filename = "", int lineNo = 0, const std::string funcName = "", const t_args *args = NULL);
-void info(const std::string &msg, const std::string filename = "", int lineNo = 0, const std::string funcName = "", const t_args *args = NULL);
-void warning(const std::string &msg, const std::string filename = "", int lineNo = 0, const std::string funcName = "", const t_args *args = NULL);
-void error(const std::string &msg, const std::string filename = "", int lineNo = 0, const std::string funcName = "", const t_args *args = NULL);
-void exception(const std::string &msg, const std::string filename = "", int lineNo = 0, const std::string funcName = "", const t_args *args = NULL);
-void critical(const std::string &msg, const std::string filename = "", int lineNo = 0, const std::string funcName = "", const t_args *args = NULL);
+void debug(const StringRef &msg, const char *filename = "", int lineNo = 0, const char *funcName = "", const Args &args = Args());
+void info(const StringRef &msg, const char *filename = "", int lineNo = 0, const char *funcName = "", const Args &args = Args());
+void warning(const StringRef &msg, const char *filename = "", int lineNo = 0, const char *funcName = "", const Args &args = Args());
+void error(const StringRef &msg, const char *filename = "", int lineNo = 0, const char *funcName = "", const Args &args = Args());
+void exception(const StringRef &msg, const char *filename = "", int lineNo = 0, const char *funcName = "", const Args &args = Args());
+void critical(const StringRef &msg, const char *filename = "", int lineNo = 0, const char *funcName = "", const Args &args = Args());
 
-void log(const logRecord::e_LogLevel level, const std::string &msg, const std::string filename = "", int lineNo = 0, const std::string funcName = "", const t_args *args = NULL);
+void log(const logRecord::e_LogLevel level, const StringRef &msg, const char *filename = "", int lineNo = 0, const char *funcName = "", const Args &args = Args());
 
 void disable(logRecord::e_LogLevel level = logRecord::CRITICAL);
 
@@ -18,7 +18,12 @@
  * @brief Defines the LogRecord class and related logging utilities.
  */ 
 
+#include <log42/Arena.hpp>
+#include <log42/Args.hpp>
+#include <log42/CallSite.hpp>
+#include <log42/Fields.hpp>
 #include <log42/logLevel.hpp>
+#include <log42/StringRef.hpp>
 #include <log42/types.hpp>
 #include <ctime>
 #include <string>
@@ -32,29 +37,49 @@ namespace logRecord
  * @class LogRecord
  * @brief Represents a single log entry with metadata.
  *
+ * The record is laid out as a fixed 64-byte header followed by an inline
+ * buffer. Source metadata is shared through an interned CallSite, numeric
+ * fields are stored by value and the variable-length payload (message, logger
+ * name, structured fields and arguments, in that order) is packed into the
+ * inline buffer,
+ * spilling only when it does not fit: a record built while dispatching spills
+ * into the thread's arena, a copy (which may be queued or handed to another
+ * thread) into the global pool. Copying a record therefore costs a single
+ * memcpy of the used bytes in the common case and never touches malloc once
+ * the pool is warm.
+ *
+ * The arguments are substituted the first time the message is needed; the
+ * rendered message then replaces the message and arguments in the payload.
+ * The structured fields keep their place after the name and are decoded on
+ * lookup.
+ *
  * @startuml
  * class "LogRecord" as LogRecord {
+		+ {static} inlineCapacity : size_t
 		- {static} _startTime : clock
-		- _name : string
-		- _msg : string
-		- _args : vector<string>
-		- _levelNo : e_LogLevel
-		- _levelName : string
-		- _pathname : string
-		- _filename : string
-		- _module : string
-		- _lineNo : int
-		- _funcName : string
+		- _site : CallSite
+		- _data : char[]
 		- _created : time
-		- _msecs : int
 		- _relativeCreated : real
-		- _asctime : string
+		- _msecs : int
+		- _size : size_t
+		- _capacity : size_t
+		- _levelNo : e_LogLevel
+		- _msgLen : size_t
+		- _argc : size_t
+		- _fieldc : size_t
+		- _storage : e_Storage
+		- _inline : char[inlineCapacity]
 		--
-		+ LogRecord(name : string, level : e_LogLevel, pathname : string, lineno : int, msg : string, args : vector<string>, func : string)
+		+ LogRecord(name : string, level : e_LogLevel, site : CallSite, msg : string, args : Args, fields : Fields)
+		+ LogRecord(name : string, level : e_LogLevel, pathname : string, lineno : int, msg : string, args : Args, func : string)
 		+ getStartTime() : clock
 		+ toString() : string
+		+ getCallSite() : CallSite
 		+ getName() : string
 		+ getMessage() : string
+		+ getMessageRef() : StringRef
+		+ appendMessage(out : string) : void
 		+ getLevelNo() : e_LogLevel
 		+ getLevelName() : string
 		+ getPathname() : string
@@ -65,8 +90,14 @@ namespace logRecord
 		+ getCreated() : time
 		+ getMsecs() : int
 		+ getRelativeCreated() : real
-		+ getAsctime() : string
-		+ setAsctime(asctime : string) : void
+		+ getFieldCount() : size_t
+		+ getFields() : char[]
+		+ getField(key : string, value : Arg) : bool
+		- _init(name : string, msg : string, args : Args, fields : Fields) : void
+		- _append(data : char[], len : size_t) : char[]
+		- _reserve(len : size_t, transient : bool) : void
+		- _release() : void
+		- _render() : void
 	}
 }
  * @enduml
@@ -74,12 +105,20 @@ namespace logRecord
 class LogRecord
 {
 	public:
-		LogRecord(const std::string &name,
+		static const std::size_t	inlineCapacity = 192;
+
+		LogRecord(const StringRef &name,
+					 const e_LogLevel level,
+					 const CallSite *site,
+					 const StringRef &msg, 
+					 const Args &args,
+					 const Fields &fields = Fields());
+		LogRecord(const StringRef &name,
 					 const e_LogLevel level,
 					 const std::string &pathname, 
 					 const int lineno, 
-					 const std::string &msg, 
-					 const t_args *args, 
+					 const StringRef &msg, 
+					 const Args &args, 
 					 const std::string &func = "");
 		~LogRecord();
 
@@ -90,40 +129,56 @@ class LogRecord
 
 		std::string	toString() const;
 
-		const std::string	&getName() const;
+		const CallSite		*getCallSite() const;
+		const char			*getName() const;
 		std::string			getMessage() const;
+		StringRef			getMessageRef() const;
+		void				appendMessage(arena::t_string &out) const;
 		const e_LogLevel	&getLevelNo() const;
-		const std::string	&getLevelName() const;
-		const std::string	&getPathname() const;
-		const std::string	&getFilename() const;
-		const std::string	&getModule() const;
+		const char			*getLevelName() const;
+		const char			*getPathname() const;
+		const char			*getFilename() const;
+		const char			*getModule() const;
 		const int			&getLineNo() const;
-		const std::string	&getFuncName() const;
+		const char			*getFuncName() const;
 		const std::time_t	&getCreated() const;
 		const long			&getMsecs() const;
 		const double		&getRelativeCreated() const;
-		const std::string	&getAsctime() const;
-
-		void		setAsctime(const std::string &asctime);
+		std::size_t			getFieldCount() const;
+		const char			*getFields() const;
+		bool				getField(const StringRef &key, Arg &value) const;
 
 	private:
-		static clock_t	_startTime;
+		/**
+		 * @brief Where the payload currently lives.
+		 */
+		enum e_Storage { STORAGE_INLINE, STORAGE_ARENA, STORAGE_POOL };
 
-		std::string		_name;
-		std::string		_msg;
-		t_args			_args;
-		e_LogLevel		_levelNo;
-		std::string		_levelName;
-		std::string		_pathname;
-		std::string		_filename;
-		std::string		_module;
-		int				_lineNo;
-		std::string		_funcName;
-		std::time_t		_created; 
-		long			_msecs;
-		double			_relativeCreated;
-		std::string		_asctime;
+		static clock_t	_startTime;
 
+		const CallSite			*_site;
+		mutable char			*_data;
+		std::time_t				_created; 
+		double					_relativeCreated;
+		long					_msecs;
+		mutable unsigned int	_size;
+		mutable unsigned int	_capacity;
+		e_LogLevel				_levelNo;
+		mutable unsigned int	_msgLen;
+		mutable unsigned short	_argc;
+		unsigned short			_fieldc;
+		mutable unsigned char	_storage;
+		/**
+		 * @brief Inline payload; kept last, the header size being checked as
+		 * the record size less this buffer.
+		 */
+		mutable char			_inline[inlineCapacity];
+
+		void	_init(const StringRef &name, const StringRef &msg, const Args &args, const Fields &fields);
+		void	_render() const;
+		char	*_append(const char *data, std::size_t len);
+		void	_reserve(std::size_t len, bool transient = false);
+		void	_release();
 };
 
 } // !logRecord
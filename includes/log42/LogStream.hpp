@@ -0,0 +1,141 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   LogStream.hpp                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: pdemont <pdemont@student.42lausanne.ch>    +#+  +:+       +#+        */
+/*   By: blucken <blucken@student.42lausanne.ch>  +#+#+#+#+#+   +#+           */
+/*                                                     #+#    #+#             */
+/*   Created: 2026/10/18                              ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+#ifndef LOG42_LOGSTREAM_HPP
+#define LOG42_LOGSTREAM_HPP
+
+/**
+ * @file LogStream.hpp
+ * @brief Declares the LogStream class building a log message with stream
+ * insertions, only once the call is known to be logged.
+ */ 
+
+#include <log42/Arena.hpp>
+#include <log42/CallSite.hpp>
+#include <log42/LogRecord.hpp>
+#include <log42/Logger.hpp>
+#include <ostream>
+
+/**
+ * @def LOG_STREAM(logger, level)
+ * @brief Logs the message inserted into the statement's stream, as in
+ * `LOG_STREAM(logger, INFO) << "took " << ms << " ms";`.
+ *
+ * The insertions are only evaluated if the level is enabled and the
+ * logger's sampler keeps the call. This is a statement, not an expression.
+ */
+#define LOG_STREAM(logger, level) \
+	for (log42::LogStream log42Stream(&*(logger), (level), __FILE__, __LINE__, __FUNCTION__); \
+		log42Stream.isOpen(); log42Stream.flush()) \
+		log42Stream.stream()
+/**
+ * @def LOG_WITH(logger, level, writer)
+ * @brief Logs the message a callable writes into the stream it is passed.
+ *
+ * The writer is called with a std::ostream & only if the level is enabled
+ * and the logger's sampler keeps the call. This is a statement, not an
+ * expression.
+ */
+#define LOG_WITH(logger, level, writer) \
+	for (log42::LogStream log42Stream(&*(logger), (level), __FILE__, __LINE__, __FUNCTION__); \
+		log42Stream.isOpen(); log42Stream.flush()) \
+		(writer)(log42Stream.stream())
+
+namespace log42
+{
+
+/**
+ * @class LogStream
+ * @brief Scoped builder of a single log message, backing LOG_STREAM and
+ * LOG_WITH.
+ *
+ * The level and the sampler are checked on construction; the stream is
+ * only created if the call is logged. Its buffer grows in the thread's
+ * arena, which is rewound when the LogStream ends, so building messages
+ * does not reach malloc once the arena is warm. flush() logs the text as
+ * it is, without substituting arguments.
+ *
+ * @startuml
+ * class "LogStream" as LogStream {
+		- _logger : Logger
+		- _level : e_LogLevel
+		- _site : CallSite
+		- _scope : Scope
+		- _buffer : streambuf
+		- _stream : ostream
+		--
+		+ LogStream(logger : Logger, level : e_LogLevel, filename : string, lineNo : int, funcName : string)
+		+ isOpen() : bool
+		+ stream() : ostream
+		+ flush() : void
+		- _close() : void
+	}
+ * @enduml
+ */
+class LogStream
+{
+	public:
+		LogStream(logger::Logger *logger, const logRecord::e_LogLevel level,
+					const char *filename, int lineNo, const char *funcName);
+		~LogStream();
+
+		bool			isOpen() const;
+		std::ostream	&stream();
+		void			flush();
+
+	private:
+		logger::Logger				*_logger;
+		logRecord::e_LogLevel		_level;
+		const logRecord::CallSite	*_site;
+		arena::Scope				_scope;
+		std::streambuf				*_buffer;
+		std::ostream				*_stream;
+
+		LogStream(const LogStream &rhs);
+		LogStream &operator=(const LogStream &rhs);
+
+		void	_close();
+};
+
+} // !log42
+
+#endif // !LOG42_LOGSTREAM_HPP
+
+/* ************************************************************************** */
+/*                                                                            */
+/*                                MIT License                                 */
+/*                                                                            */
+/*   Copyright (c) 2025 Demont Pieric, Lucken Bénédict                        */
+/*                                                                            */
+/*   Inspired by the Python 'logging' module by Vinay Sajip.                  */
+/*   This implementation was rewritten in C++98 and contains no original      */
+/*   Python source code.                                                      */
+/*                                                                            */
+/*   Permission is hereby granted, free of charge, to any person obtaining    */
+/*   a copy of this software and associated documentation files (the          */
+/*   "Software"), to deal in the Software without restriction, including      */
+/*   without limitation the rights to use, copy, modify, merge, publish,      */
+/*   distribute, sublicense, and/or sell copies of the Software, and to       */
+/*   permit persons to whom the Software is furnished to do so, subject to    */
+/*   the following conditions:                                                */
+/*                                                                            */
+/*   The above copyright notice and this permission notice shall be included  */
+/*   in all copies or substantial portions of the Software.                   */
+/*                                                                            */
+/*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS  */
+/*   OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF               */
+/*   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.   */
+/*   IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY     */
+/*   CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,     */
+/*   TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE        */
+/*   SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                   */
+/*                                                                            */
+/* ************************************************************************** */
@@ -19,80 +19,171 @@
  * handler, and propagation control.
  */ 
 
+#include <log42/Fields.hpp>
 #include <log42/Filterer.hpp>
 #include <log42/Handler.hpp>
 #include <log42/LogRecord.hpp>
 #include <log42/Node.hpp>
+#include <log42/Sampler.hpp>
+#include <log42/StringRef.hpp>
+#include <log42/Sync.hpp>
 #include <log42/types.hpp>
 
 namespace log42
 {
-namespace manager
-{
-class Manager;
-} // !manager
+
+class LogStream;
+
+namespace manager { class Manager; }
+
 namespace logger
 {
 
+/**
+ * The trailing arguments of the logging macros are captured by value into a
+ * log42::Args and substituted for the "%d", "%f", "%x" and "%s" conversions
+ * of the message when the record is emitted.
+ */
+
 /**
  * @def DEBUG(logger, msg, ...)
  * @brief Logs a debug message with file, line, and function info.
  */
-#define DEBUG(logger, msg, ...)			(logger)->debug((msg), __FILE__, __LINE__, __FUNCTION__, ##__VA_ARGS__)
+#define DEBUG(logger, msg, ...)			(logger)->debug((msg), __FILE__, __LINE__, __FUNCTION__, log42::Args(__VA_ARGS__))
 /**
  * @def INFO(logger, msg, ...)
  * @brief Logs an info message with file, line, and function info.
  */
-#define INFO(logger, msg, ...)			(logger)->info((msg), __FILE__, __LINE__, __FUNCTION__, ##__VA_ARGS__)
+#define INFO(logger, msg, ...)			(logger)->info((msg), __FILE__, __LINE__, __FUNCTION__, log42::Args(__VA_ARGS__))
 /**
  * @def WARNING(logger, msg, ...)
  * @brief Logs a warning message with file, line, and function info.
  */
-#define WARNING(logger, msg, ...)		(logger)->warning((msg), __FILE__, __LINE__, __FUNCTION__, ##__VA_ARGS__)
+#define WARNING(logger, msg, ...)		(logger)->warning((msg), __FILE__, __LINE__, __FUNCTION__, log42::Args(__VA_ARGS__))
 /**
  * @def ERROR(logger, msg, ...)
  * @brief Logs an error message with file, line, and function info.
  */
-#define ERROR(logger, msg, ...)			(logger)->error((msg), __FILE__, __LINE__, __FUNCTION__, ##__VA_ARGS__)
+#define ERROR(logger, msg, ...)			(logger)->error((msg), __FILE__, __LINE__, __FUNCTION__, log42::Args(__VA_ARGS__))
 /**
  * @def CRITICAL(logger, msg, ...)
  * @brief Logs a critical message with file, line, and function info.
  */
-#define CRITICAL(logger, msg, ...)		(logger)->critical((msg), __FILE__, __LINE__, __FUNCTION__, ##__VA_ARGS__)
+#define CRITICAL(logger, msg, ...)		(logger)->critical((msg), __FILE__, __LINE__, __FUNCTION__, log42::Args(__VA_ARGS__))
 /**
  * @def EXCEPTION(logger, msg, ...)
  * @brief Logs an exception message with file, line, and function info.
  */
-#define EXCEPTION(logger, msg, ...)		(logger)->exception((msg), __FILE__, __LINE__, __FUNCTION__, ##__VA_ARGS__)
+#define EXCEPTION(logger, msg, ...)		(logger)->exception((msg), __FILE__, __LINE__, __FUNCTION__, log42::Args(__VA_ARGS__))
 /**
  * @def LOG(logger, level, msg, ...)
  * @brief Logs a message at the specified level with file, line, and function info.
  */
-#define LOG(logger, level, msg, ...)	(logger)->log((level), (msg), __FILE__, __LINE__, __FUNCTION__, ##__VA_ARGS__)
+#define LOG(logger, level, msg, ...)	(logger)->log((level), (msg), __FILE__, __LINE__, __FUNCTION__, log42::Args(__VA_ARGS__))
+/**
+ * @def LOG_FIELDS(logger, level, fields, msg, ...)
+ * @brief Logs a message at the specified level with structured fields, a
+ * log42::Fields, and file, line, and function info.
+ */
+#define LOG_FIELDS(logger, level, fields, msg, ...)	(logger)->log((level), (msg), __FILE__, __LINE__, __FUNCTION__, (fields), log42::Args(__VA_ARGS__))
+
+/**
+ * The conditional macros below are statements, not expressions. They keep
+ * their state in a static at the call site and skip the call, including the
+ * evaluation of its arguments, when the condition fails or the level is
+ * disabled. The logger expression is evaluated once, as in the other macros.
+ * The counting macros count every execution, logged or not.
+ */
+
+/**
+ * @def LOG_IF(logger, level, condition, msg, ...)
+ * @brief Logs a message at the specified level if the condition holds.
+ */
+#define LOG_IF(alogger, level, condition, msg, ...) \
+	do { \
+		log42::logger::Logger &log42Logger = *(alogger); \
+		const log42::logRecord::e_LogLevel log42Level = (level); \
+		if ((condition) && log42Logger.isEnabledFor(log42Level)) \
+			log42Logger.log(log42Level, (msg), __FILE__, __LINE__, __FUNCTION__, log42::Args(__VA_ARGS__)); \
+	} while (0)
+/**
+ * @def LOG_EVERY_N(logger, level, n, msg, ...)
+ * @brief Logs the first execution of the statement and every n-th after it;
+ * every execution when n is 1 or less.
+ */
+#define LOG_EVERY_N(logger, level, n, msg, ...) \
+	do { \
+		static unsigned long log42Count = 0; \
+		const long log42Every = (n); \
+		LOG_IF(logger, level, log42::sync::fetchAdd(log42Count, 1UL) \
+			% (log42Every > 1 ? static_cast<unsigned long>(log42Every) : 1UL) == 0, msg, __VA_ARGS__); \
+	} while (0)
+/**
+ * @def LOG_FIRST_N(logger, level, n, msg, ...)
+ * @brief Logs the first n executions of the statement.
+ */
+#define LOG_FIRST_N(logger, level, n, msg, ...) \
+	do { \
+		static unsigned long log42Count = 0; \
+		LOG_IF(logger, level, log42::sync::load(log42Count) < static_cast<unsigned long>(n) \
+			&& log42::sync::fetchAdd(log42Count, 1UL) < static_cast<unsigned long>(n), msg, __VA_ARGS__); \
+	} while (0)
+/**
+ * @def LOG_EVERY_MS(logger, level, ms, msg, ...)
+ * @brief Logs the first execution of the statement, then at most one every
+ * ms milliseconds.
+ */
+#define LOG_EVERY_MS(logger, level, ms, msg, ...) \
+	do { \
+		static unsigned long log42Last = 0; \
+		LOG_IF(logger, level, log42::sync::everyMillis(log42Last, (ms)), msg, __VA_ARGS__); \
+	} while (0)
 
 /**
  * @class Logger
  * @brief Provides hierarchical logging with level, handler, filter, and propagation support.
  *
+ * The emit path (level check, filtering and dispatch to the handlers) takes
+ * no lock: settings are read atomically and the handler set is a snapshot
+ * replaced as a whole by addHandler() and removeHandler(). Walks up the
+ * hierarchy follow the raw parent links, checked by node kind.
+ *
+ * A sampler set with setSampler() keeps a share of the enabled records up to
+ * a level; it decides from the call site before the record is built.
+ *
+ * Fields set with setField() are added to every record the logger builds,
+ * after the fields of the call; they are kept encoded, ready to be copied
+ * into the record. Records propagated from a child do not get them.
+ *
  * @startuml
  * class "Logger" as Logger {
 		- _level : e_LogLevel
 		- _propagate : bool
-		- _handlers : set<Handler>
+		- _handlers : Published<set<Handler>>
+		- _sampling : Published<Sampling>
+		- _extra : Published<Extra>
 		- _disabled : bool
-		- _cache : map<e_LogLevel, bool>
-		- _manager : Manager
+		- _cache : unsigned long
+		- _references : unsigned long
+		- _reclaimState : e_ReclaimState
 		--
 		+ Logger(name : string, level : e_LogLevel)
 		+ setLevel(level : e_LogLevel) : void
 		+ setPropagate(propagate : bool) : void
-		+ debug(msg : string, filename : string, lineNo : int, funcName : string, args : vector<string>) : void
-		+ info(msg : string, filename : string, lineNo : int, funcName : string, args : vector<string>) : void
-		+ warning(msg : string, filename : string, lineNo : int, funcName : string, args : vector<string>) : void
-		+ error(msg : string, filename : string, lineNo : int, funcName : string, args : vector<string>) : void
-		+ exception(msg : string, filename : string, lineNo : int, funcName : string, args : vector<string>) : void
-		+ critical(msg : string, filename : string, lineNo : int, funcName : string, args : vector<string>) : void
-		+ log(level : e_LogLevel, msg : string, filename : string, lineNo : int, funcName : string, args : vector<string>) : void
+		+ setSampler(sampler : Sampler, upTo : e_LogLevel) : void
+		+ getSampler() : Sampler
+		+ setField(key : string, value : Arg) : void
+		+ removeField(key : string) : void
+		+ clearFields() : void
+		+ getFieldCount() : size_t
+		+ debug(msg : string, filename : string, lineNo : int, funcName : string, args : Args) : void
+		+ info(msg : string, filename : string, lineNo : int, funcName : string, args : Args) : void
+		+ warning(msg : string, filename : string, lineNo : int, funcName : string, args : Args) : void
+		+ error(msg : string, filename : string, lineNo : int, funcName : string, args : Args) : void
+		+ exception(msg : string, filename : string, lineNo : int, funcName : string, args : Args) : void
+		+ critical(msg : string, filename : string, lineNo : int, funcName : string, args : Args) : void
+		+ log(level : e_LogLevel, msg : string, filename : string, lineNo : int, funcName : string, args : Args) : void
+		+ log(level : e_LogLevel, msg : string, filename : string, lineNo : int, funcName : string, fields : Fields, args : Args) : void
 		+ handle(record : LogRecord) : void
 		+ addHandler(handler : Handler) : void
 		+ removeHandler(handler : Handler) : void
@@ -100,13 +191,23 @@ namespace logger
 		+ callHandlers(record : LogRecord) : void
 		+ getHandler() : set<Handler>
 		+ getEffectiveLevel() : e_LogLevel
+		+ getParentLogger() : Logger
 		+ isEnabledFor(level : e_LogLevel) : bool
 		+ getChild(suffix : string)
 		+ getChildren() : set<Logger>
 		+ toString() : string
+		+ getFootprint() : size_t
+		+ retain() : void
+		+ release() : void
+		+ isReclaimable() : bool
 		+ clearCache() : void
 		+ cacheClear() : void
-		- _log(level : e_LogLevel, msg : string, filename : string, lineNo : int, funcName : string, args : vector<string>) : void
+		# _handleSummary(record : LogRecord) : void
+		- _touch() : bool
+		- _sample(level : e_LogLevel, site : CallSite) : bool
+		- _emit(level : e_LogLevel, site : CallSite, msg : string, args : Args, fields : Fields) : void
+		- _log(level : e_LogLevel, msg : string, filename : string, lineNo : int, funcName : string, args : Args, fields : Fields) : void
+		- {static} _dropField(extra : Extra, key : string) : void
 	}
  * @enduml
  */
@@ -121,46 +222,117 @@ class Logger : public Node, public  filterer::Filterer
 
 		void setLevel(const logRecord::e_LogLevel level);
 		void setPropagate(bool propagate);
+		void setSampler(const common::core::raii::SharedPtr<filter::Sampler> &sampler,
+					const logRecord::e_LogLevel upTo = logRecord::DEBUG);
+		common::core::raii::SharedPtr<filter::Sampler>	getSampler() const;
+		void		setField(const StringRef &key, const Arg &value);
+		void		removeField(const StringRef &key);
+		void		clearFields();
+		std::size_t	getFieldCount() const;
 
-		void debug(const std::string &msg, const std::string filename = "", int lineNo = 0, const std::string funcName = "", const t_args *args = NULL);
-		void info(const std::string &msg, const std::string filename = "", int lineNo = 0, const std::string funcName = "", const t_args *args = NULL);
-		void warning(const std::string &msg, const std::string filename = "", int lineNo = 0, const std::string funcName = "", const t_args *args = NULL);
-		void error(const std::string &msg, const std::string filename = "", int lineNo = 0, const std::string funcName = "", const t_args *args = NULL);
-		void exception(const std::string &msg, const std::string filename = "", int lineNo = 0, const std::string funcName = "", const t_args *args = NULL);
-		void critical(const std::string &msg, const std::string filename = "", int lineNo = 0, const std::string funcName = "", const t_args *args = NULL);
+		void debug(const StringRef &msg, const char *filename = "", int lineNo = 0, const char *funcName = "", const Args &args = Args());
+		void info(const StringRef &msg, const char *filename = "", int lineNo = 0, const char *funcName = "", const Args &args = Args());
+		void warning(const StringRef &msg, const char *filename = "", int lineNo = 0, const char *funcName = "", const Args &args = Args());
+		void error(const StringRef &msg, const char *filename = "", int lineNo = 0, const char *funcName = "", const Args &args = Args());
+		void exception(const StringRef &msg, const char *filename = "", int lineNo = 0, const char *funcName = "", const Args &args = Args());
+		void critical(const StringRef &msg, const char *filename = "", int lineNo = 0, const char *funcName = "", const Args &args = Args());
 
-		void log(const logRecord::e_LogLevel level, const std::string &msg, const std::string filename = "", int lineNo = 0, const std::string funcName = "", const t_args *args = NULL);
+		void log(const logRecord::e_LogLevel level, const StringRef &msg, const char *filename = "", int lineNo = 0, const char *funcName = "", const Args &args = Args());
+		void log(const logRecord::e_LogLevel level, const StringRef &msg, const char *filename, int lineNo, const char *funcName, const Fields &fields, const Args &args = Args());
 
 		void handle(logRecord::LogRecord &record);
 		void addHandler(const common::core::raii::SharedPtr<handler::Handler> &handler);
 		void removeHandler(const common::core::raii::SharedPtr<handler::Handler> &handler);
 		bool hasHandler() const;
 		void callHandlers(logRecord::LogRecord &record);
-		const t_handlers &getHandlers() const;
+		t_handlers getHandlers() const;
 
 		logRecord::e_LogLevel getEffectiveLevel() const;
+		Logger *getParentLogger() const;
 		bool isEnabledFor(const logRecord::e_LogLevel level);
 		
 		common::core::raii::SharedPtr<Logger>    getChild(const std::string &suffix) const;
 		t_loggers	getChildren() const;
 
 		virtual std::string	toString() const;
+		virtual std::size_t	getFootprint() const;
+
+		void retain();
+		void release();
+		bool isReclaimable() const;
 	
 		void clearCache();
 		void cacheClear();
+
+	protected:
+		void _handleSummary(logRecord::LogRecord &record);
 		
 	private:
+		/**
+		 * @brief Sampler of the logger and the highest level it samples.
+		 */
+		struct Sampling
+		{
+			common::core::raii::SharedPtr<filter::Sampler>	sampler;
+			logRecord::e_LogLevel							upTo;
+
+			Sampling() : sampler(), upTo(logRecord::NOTSET) {}
+			bool	empty() const { return (!this->sampler); }
+		};
+
+		/**
+		 * @brief Fields of the logger, encoded back to back.
+		 */
+		struct Extra
+		{
+			std::string		fields;
+			std::size_t		count;
+
+			Extra() : fields(), count(0) {}
+			bool	empty() const { return (this->count == 0); }
+		};
+
+		enum e_ReclaimState { RECLAIM_IN_USE, RECLAIM_IDLE, RECLAIMED };
+
 		logRecord::e_LogLevel					_level;
 		bool									_propagate;
-		t_handlers								_handlers;
+		sync::Published<t_handlers>				_handlers;
+		sync::Published<Sampling>				_sampling;
+		sync::Published<Extra>					_extra;
 		bool									_disabled;
-		std::map<logRecord::e_LogLevel, bool>	_cache;
-		manager::Manager						&_manager;
+		unsigned long							_cache;
+		unsigned long							_references;
+		e_ReclaimState							_reclaimState;
+
+		bool _touch();
+		bool _sample(const logRecord::e_LogLevel level, const logRecord::CallSite *site) const;
+		void _emit(const logRecord::e_LogLevel level, const logRecord::CallSite *site, const StringRef &msg, const Args &args,
+					const Fields &fields = Fields());
+		void _log(const logRecord::e_LogLevel level, const StringRef &msg, const Args &args,
+					const char *filename, int lineNo, const char *funcName, const Fields &fields = Fields());
+
+		static void	_dropField(Extra &extra, const StringRef &key);
 
-		void _log(const logRecord::e_LogLevel level, const std::string &msg, const t_args *args,
-					const std::string filename, int lineNo, const std::string funcName);
+		friend class log42::LogStream;
+		friend class manager::Manager;
 };
 
+/**
+ * @brief Gets the parent logger without taking a reference to it.
+ *
+ * A logger's parent is always a logger; the kind is checked so that a
+ * detached or misplaced link ends the walk instead of being cast.
+ *
+ * @return Pointer to the parent Logger, or NULL for the root.
+ */
+inline Logger	*Logger::getParentLogger() const
+{
+	Node *parent = this->getParent();
+	if (!parent || parent->getKind() != Node::LOGGER)
+		return (NULL);
+	return (static_cast<Logger *>(parent));
+}
+
 } // !logger
 } // !log42
 
@@ -0,0 +1,191 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   LoggerHandle.hpp                                   :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: pdemont <pdemont@student.42lausanne.ch>    +#+  +:+       +#+        */
+/*   By: blucken <blucken@student.42lausanne.ch>  +#+#+#+#+#+   +#+           */
+/*                                                     #+#    #+#             */
+/*   Created: 2026/10/18                              ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+#ifndef LOG42_LOGGERHANDLE_HPP
+#define LOG42_LOGGERHANDLE_HPP
+
+/**
+ * @file LoggerHandle.hpp
+ * @brief Declares the LoggerHandle struct caching a logger and its enabled
+ * level at a call site, and the LOGGER_* macros using it.
+ */ 
+
+#include <log42/Logger.hpp>
+#include <log42/Manager.hpp>
+#include <log42/Sync.hpp>
+
+/**
+ * @def LOG42_HANDLE(name)
+ * @brief Constant initializer of a LoggerHandle for a logger name, which
+ * must be a string literal (empty for the root logger).
+ */
+#define LOG42_HANDLE(name)	{ "" name, NULL, 0 }
+
+/**
+ * @def LOGGER_LOG(name, level, msg, ...)
+ * @brief Logs a message through a handle kept in a static at the call site.
+ *
+ * The arguments are only evaluated if the level is enabled. This is a
+ * statement, not an expression.
+ */
+#define LOGGER_LOG(name, level, msg, ...) \
+	do { \
+		static log42::logger::LoggerHandle log42Handle = LOG42_HANDLE(name); \
+		const log42::logRecord::e_LogLevel log42Level = (level); \
+		if (log42Handle.isEnabledFor(log42Level)) \
+			log42Handle.get()->log(log42Level, (msg), __FILE__, __LINE__, __FUNCTION__, log42::Args(__VA_ARGS__)); \
+	} while (0)
+/**
+ * @def LOGGER_DEBUG(name, msg, ...)
+ * @brief Logs a debug message through a handle cached at the call site.
+ */
+#define LOGGER_DEBUG(name, msg, ...)		LOGGER_LOG(name, log42::logRecord::DEBUG, msg, __VA_ARGS__)
+/**
+ * @def LOGGER_INFO(name, msg, ...)
+ * @brief Logs an info message through a handle cached at the call site.
+ */
+#define LOGGER_INFO(name, msg, ...)			LOGGER_LOG(name, log42::logRecord::INFO, msg, __VA_ARGS__)
+/**
+ * @def LOGGER_WARNING(name, msg, ...)
+ * @brief Logs a warning message through a handle cached at the call site.
+ */
+#define LOGGER_WARNING(name, msg, ...)		LOGGER_LOG(name, log42::logRecord::WARNING, msg, __VA_ARGS__)
+/**
+ * @def LOGGER_ERROR(name, msg, ...)
+ * @brief Logs an error message through a handle cached at the call site.
+ */
+#define LOGGER_ERROR(name, msg, ...)		LOGGER_LOG(name, log42::logRecord::ERROR, msg, __VA_ARGS__)
+/**
+ * @def LOGGER_CRITICAL(name, msg, ...)
+ * @brief Logs a critical message through a handle cached at the call site.
+ */
+#define LOGGER_CRITICAL(name, msg, ...)		LOGGER_LOG(name, log42::logRecord::CRITICAL, msg, __VA_ARGS__)
+/**
+ * @def LOGGER_EXCEPTION(name, msg, ...)
+ * @brief Logs an exception message through a handle cached at the call site.
+ */
+#define LOGGER_EXCEPTION(name, msg, ...)	LOGGER_LOG(name, log42::logRecord::ERROR, msg, __VA_ARGS__)
+
+namespace log42
+{
+namespace logger
+{
+
+/**
+ * @struct LoggerHandle
+ * @brief Trivially copyable reference to a logger by name, caching the
+ * logger and the lowest level it has enabled.
+ *
+ * The cache is tagged with the Manager's cache generation, which changes
+ * with any level, disable or hierarchy change that can affect it. A check
+ * is one load of the generation, one load of the handle and a compare; on a
+ * mismatch the handle resolves its logger again and recomputes the level.
+ *
+ * A handle is an aggregate, so a static one initialized with LOG42_HANDLE
+ * needs no construction guard. It retains its logger once, which is
+ * therefore never reclaimed, and resolves it again without locking when the
+ * generation changes. Threads may share a handle: the logger is published
+ * before the state that validates it.
+ *
+ * @startuml
+ * class "LoggerHandle" as LoggerHandle {
+		+ name : char[]
+		+ alogger : Logger
+		+ state : unsigned long
+		--
+		+ isEnabledFor(level : e_LogLevel) : bool
+		+ get() : Logger
+		- _refresh() : unsigned long
+		- _resolve() : Logger
+	}
+ * @enduml
+ */
+struct LoggerHandle
+{
+	const char		*name;
+	Logger			*alogger;
+	unsigned long	state;
+
+	/**
+	 * @brief Bits of the state holding the lowest enabled level; the cache
+	 * generation fills the remaining bits.
+	 */
+	static const unsigned int	levelBits = 8;
+
+	bool	isEnabledFor(const logRecord::e_LogLevel level);
+	Logger	*get();
+
+	private:
+		unsigned long	_refresh();
+		Logger			*_resolve();
+};
+
+/**
+ * @brief Checks whether the logger is enabled for a level.
+ *
+ * @param level The log level to check.
+ * @return True if enabled, false otherwise.
+ */
+inline bool	LoggerHandle::isEnabledFor(const logRecord::e_LogLevel level)
+{
+	unsigned long current = sync::load(this->state);
+	if ((current >> levelBits) != manager::Manager::getCacheGeneration())
+		current = this->_refresh();
+	return (static_cast<unsigned long>(level) >= (current & ((1UL << levelBits) - 1)));
+}
+
+/**
+ * @brief Gets the logger, resolving it if the handle is not current.
+ *
+ * @return Pointer to the logger, valid until shutdown().
+ */
+inline Logger	*LoggerHandle::get()
+{
+	if ((sync::load(this->state) >> levelBits) != manager::Manager::getCacheGeneration())
+		this->_refresh();
+	return (sync::load(this->alogger));
+}
+
+} // !logger
+} // !log42
+
+#endif // !LOG42_LOGGERHANDLE_HPP
+
+/* ************************************************************************** */
+/*                                                                            */
+/*                                MIT License                                 */
+/*                                                                            */
+/*   Copyright (c) 2025 Demont Pieric, Lucken Bénédict                        */
+/*                                                                            */
+/*   Inspired by the Python 'logging' module by Vinay Sajip.                  */
+/*   This implementation was rewritten in C++98 and contains no original      */
+/*   Python source code.                                                      */
+/*                                                                            */
+/*   Permission is hereby granted, free of charge, to any person obtaining    */
+/*   a copy of this software and associated documentation files (the          */
+/*   "Software"), to deal in the Software without restriction, including      */
+/*   without limitation the rights to use, copy, modify, merge, publish,      */
+/*   distribute, sublicense, and/or sell copies of the Software, and to       */
+/*   permit persons to whom the Software is furnished to do so, subject to    */
+/*   the following conditions:                                                */
+/*                                                                            */
+/*   The above copyright notice and this permission notice shall be included  */
+/*   in all copies or substantial portions of the Software.                   */
+/*                                                                            */
+/*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS  */
+/*   OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF               */
+/*   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.   */
+/*   IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY     */
+/*   CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,     */
+/*   TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE        */
+/*   SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                   */
+/*                                                                            */
+/* ************************************************************************** */
@@ -21,6 +21,9 @@
 #include <log42/Logger.hpp>
 #include <log42/LogRecord.hpp>
 #include <log42/PlaceHolder.hpp>
+#include <log42/Registry.hpp>
+#include <log42/StringRef.hpp>
+#include <log42/Sync.hpp>
 #include <log42/types.hpp>
 
 namespace log42
@@ -33,50 +36,100 @@ namespace manager
  * @brief Singleton class responsible for managing loggers, their hierarchy, 
  * and logging configuration.
  *
+ * Changes to the hierarchy serialize on a recursive lock. The settings read
+ * on the emit path (root logger, disable level, cache generation) are
+ * published atomically and read without it, and existing loggers are found
+ * through a Registry without taking it.
+ *
  * @startuml
  * class "Manager" as Manager {
 		- _root : Logger
+		- _rootLogger : Logger
 		- _disable : e_LogLevel
 		- _emittedNoHandlerWarning : bool
+		- _rootConfigured : bool
 		- _loggerMap : map<string, Node>
+		- _registry : Registry
+		- {static} _cacheGeneration : unsigned long
+		- {static} _resetGeneration : unsigned long
+		- _lock : Mutex
 		--
 		+ getInstance(root : Logger) : Manager
 		+ getRoot() : Logger
+		+ getRootLogger() : Logger
 		+ resetRoot() : void
 		+ getDisable() : e_LogLevel
 		+ setDisable(value : e_LogLevel) : void
 		+ getEmittedNoHandlerWarning() : bool
 		+ setEmittedNoHandlerWarning(value : bool) : void
+		+ getRootConfigured() : bool
+		+ setRootConfigured(value : bool) : void
 		+ getLoggerMap() : map<string, Node>
+		+ getLock() : Mutex
+		+ {static} getCacheGeneration() : unsigned long
+		+ {static} getResetGeneration() : unsigned long
 		+ getLogger(name : string) : Logger
+		+ getLoggerPtr(name : StringRef) : Logger
+		+ retainLogger(name : StringRef) : Logger
+		+ reclaim() : size_t
 		+ clearCache() : void
+		+ getFootprint() : Footprint
 		- Manager(root : Logger)
+		- _getLogger(name : string) : Logger
 		- _fixupParents(alogger : Logger) : void
 		- _fixupChildren(ph : Placeholder, alogger : Logger) : void
+		- _detachNodes() : void
 	}
  * @enduml
  */
 class Manager
 {
 	public:
+		/**
+		 * @brief Memory held by the hierarchy: node counts and an estimate
+		 * of the bytes of the nodes, their names and the indexes.
+		 */
+		struct Footprint
+		{
+			std::size_t	loggers;
+			std::size_t	placeholders;
+			std::size_t	bytes;
+		};
+
 		static    Manager &getInstance(logger::Logger *root = NULL);
 
 		common::core::raii::SharedPtr<logger::Logger>	getRoot();
+		logger::Logger									*getRootLogger();
 		void											resetRoot();
 		logRecord::e_LogLevel							getDisable() const;
 		void											setDisable(const logRecord::e_LogLevel value);
 		bool											getEmittedNoHandlerWarning() const;
 		void											setEmittedNoHandlerWarning(bool value);
+		bool											getRootConfigured() const;
+		void											setRootConfigured(bool value);
 		t_loggerMap										&getLoggerMap();
+		sync::Mutex										&getLock();
+		static unsigned long							getCacheGeneration();
+		static unsigned long							getResetGeneration();
 		common::core::raii::SharedPtr<logger::Logger>	getLogger(const std::string &name);
+		logger::Logger									*getLoggerPtr(const StringRef &name);
+		logger::Logger									*retainLogger(const StringRef &name);
+		std::size_t										reclaim();
 
 		void											clearCache();
+		Footprint										getFootprint();
 
 	private:
 		common::core::raii::SharedPtr<logger::Logger>	_root;
+		logger::Logger									*_rootLogger;
 		logRecord::e_LogLevel							_disable;
 		bool											_emittedNoHandlerWarning;
+		bool											_rootConfigured;
 		t_loggerMap										_loggerMap;    
+		Registry										_registry;
+		static unsigned long							_cacheGeneration;
+		static unsigned long							_resetGeneration;
+		sync::Mutex										_lock;
 
 		explicit Manager(logger::Logger *root);
 		~Manager();
@@ -84,10 +137,38 @@ class Manager
 		Manager(const Manager &rhs);
 		Manager &operator=(const Manager &rhs);
 
+		logger::Logger									*_getLogger(const std::string &name);
 		void	_fixupParents(const common::core::raii::SharedPtr<logger::Logger> &alogger);
 		void	_fixupChildren(const common::core::raii::SharedPtr<placeholder::PlaceHolder> &ph, const common::core::raii::SharedPtr<logger::Logger> &alogger);
+		void	_detachNodes();
 };
 
+/**
+ * @brief Gets the generation of the loggers' level caches.
+ *
+ * A cache entry computed under an older generation is stale. Defined here
+ * so that a level check reads it with a single load, without going through
+ * getInstance().
+ *
+ * @return The current generation.
+ */
+inline unsigned long	Manager::getCacheGeneration()
+{
+	return (sync::load(_cacheGeneration));
+}
+
+/**
+ * @brief Gets the cache generation started by the last resetRoot().
+ *
+ * A logger cached under an older generation was destroyed by the reset.
+ *
+ * @return The generation, 0 if the root was never reset.
+ */
+inline unsigned long	Manager::getResetGeneration()
+{
+	return (sync::load(_resetGeneration));
+}
+
 } // !manager
 } // !log42
 
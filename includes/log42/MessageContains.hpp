@@ -0,0 +1,99 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   MessageContains.hpp                                :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: pdemont <pdemont@student.42lausanne.ch>    +#+  +:+       +#+        */
+/*   By: blucken <blucken@student.42lausanne.ch>  +#+#+#+#+#+   +#+           */
+/*                                                     #+#    #+#             */
+/*   Created: 2026/10/18                              ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+#ifndef LOG42_MESSAGECONTAINS_HPP
+#define LOG42_MESSAGECONTAINS_HPP
+
+/**
+ * @file MessageContains.hpp
+ * @brief Declares the MessageContains predicate passing the records whose
+ * message contains a text.
+ */ 
+
+#include <log42/LogRecord.hpp>
+#include <log42/Predicate.hpp>
+#include <string>
+
+namespace log42
+{
+namespace filter
+{
+
+/**
+ * @class MessageContains
+ * @brief Dynamic predicate passing the records whose rendered message
+ * contains a text, or, inverted, those whose message does not.
+ *
+ * The message is rendered in place, once per record, and searched without
+ * copying it; the rendering is reused by the handlers.
+ *
+ * @startuml
+ * class "MessageContains" as MessageContains {
+		- _text : string
+		- _accept : bool
+		--
+		+ MessageContains(text : string, accept : bool)
+		+ test(record : LogRecord, owner : Filterer) : bool
+		+ getCost() : unsigned int
+		+ isStatic() : bool
+	}
+ * @enduml
+ */
+class MessageContains : public Predicate
+{
+	public:
+		explicit MessageContains(const std::string &text, const bool accept = true);
+		~MessageContains();
+
+		bool			test(const logRecord::LogRecord &record, filterer::Filterer &owner) const;
+		unsigned int	getCost() const;
+		bool			isStatic() const;
+
+	private:
+		std::string	_text;
+		bool		_accept;
+};
+
+} // !filter
+} // !log42
+
+#endif // !LOG42_MESSAGECONTAINS_HPP
+
+/* ************************************************************************** */
+/*                                                                            */
+/*                                MIT License                                 */
+/*                                                                            */
+/*   Copyright (c) 2025 Demont Pieric, Lucken Bénédict                        */
+/*                                                                            */
+/*   Inspired by the Python 'logging' module by Vinay Sajip.                  */
+/*   This implementation was rewritten in C++98 and contains no original      */
+/*   Python source code.                                                      */
+/*                                                                            */
+/*   Permission is hereby granted, free of charge, to any person obtaining    */
+/*   a copy of this software and associated documentation files (the          */
+/*   "Software"), to deal in the Software without restriction, including      */
+/*   without limitation the rights to use, copy, modify, merge, publish,      */
+/*   distribute, sublicense, and/or sell copies of the Software, and to       */
+/*   permit persons to whom the Software is furnished to do so, subject to    */
+/*   the following conditions:                                                */
+/*                                                                            */
+/*   The above copyright notice and this permission notice shall be included  */
+/*   in all copies or substantial portions of the Software.                   */
+/*                                                                            */
+/*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS  */
+/*   OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF               */
+/*   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.   */
+/*   IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY     */
+/*   CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,     */
+/*   TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE        */
+/*   SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                   */
+/*                                                                            */
+/* ************************************************************************** */
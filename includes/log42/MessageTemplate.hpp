@@ -0,0 +1,117 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   MessageTemplate.hpp                                :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: pdemont <pdemont@student.42lausanne.ch>    +#+  +:+       +#+        */
+/*   By: blucken <blucken@student.42lausanne.ch>  +#+#+#+#+#+   +#+           */
+/*                                                     #+#    #+#             */
+/*   Created: 2026/10/18                              ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef LOG42_MESSAGETEMPLATE_HPP
+#define LOG42_MESSAGETEMPLATE_HPP
+
+/**
+ * @file MessageTemplate.hpp
+ * @brief Declares the MessageTemplate class, a pre-parsed log message.
+ */ 
+
+#include <log42/Arena.hpp>
+#include <log42/StringRef.hpp>
+#include <string>
+#include <vector>
+
+namespace log42
+{
+namespace logRecord
+{
+
+/**
+ * @class MessageTemplate
+ * @brief A log message with the position of its conversions resolved once.
+ *
+ * Rendering a record then only copies the literal runs and the arguments,
+ * without scanning the message again. A call site keeps the template of the
+ * message it logs, so hot statements are parsed a single time; a message
+ * without a template is rendered by renderText(), which scans it as it goes
+ * and allocates nothing but the output.
+ *
+ * @startuml
+ * class "MessageTemplate" as MessageTemplate {
+		- _text : string
+		- _conversions : vector<Conversion>
+		--
+		+ MessageTemplate(msg : string)
+		+ matches(msg : string) : bool
+		+ render(args : char[], argc : size_t, out : string) : void
+		+ {static} renderText(msg : string, args : char[], argc : size_t, out : string) : void
+	}
+ * @enduml
+ */
+class MessageTemplate
+{
+	public:
+		explicit MessageTemplate(const StringRef &msg);
+		~MessageTemplate();
+
+		MessageTemplate(const MessageTemplate &rhs);
+		MessageTemplate &operator=(const MessageTemplate &rhs);
+
+		bool	matches(const StringRef &msg) const;
+		void	render(const char *args, std::size_t argc, arena::t_string &out) const;
+
+		static void	renderText(const StringRef &msg, const char *args, std::size_t argc, arena::t_string &out);
+
+	private:
+		/**
+		 * @brief A "%d", "%f", "%x", "%s" or "%%" found in the message.
+		 */
+		struct Conversion
+		{
+			std::size_t	pos;
+			char		spec;
+		};
+
+		typedef std::vector<Conversion>	t_conversions;
+
+		std::string		_text;
+		t_conversions	_conversions;
+};
+
+} // !logRecord
+} // !log42
+
+#endif // !LOG42_MESSAGETEMPLATE_HPP
+
+/* ************************************************************************** */
+/*                                                                            */
+/*                                MIT License                                 */
+/*                                                                            */
+/*   Copyright (c) 2025 Demont Pieric, Lucken Bénédict                        */
+/*                                                                            */
+/*   Inspired by the Python 'logging' module by Vinay Sajip.                  */
+/*   This implementation was rewritten in C++98 and contains no original      */
+/*   Python source code.                                                      */
+/*                                                                            */
+/*   Permission is hereby granted, free of charge, to any person obtaining    */
+/*   a copy of this software and associated documentation files (the          */
+/*   "Software"), to deal in the Software without restriction, including      */
+/*   without limitation the rights to use, copy, modify, merge, publish,      */
+/*   distribute, sublicense, and/or sell copies of the Software, and to       */
+/*   permit persons to whom the Software is furnished to do so, subject to    */
+/*   the following conditions:                                                */
+/*                                                                            */
+/*   The above copyright notice and this permission notice shall be included  */
+/*   in all copies or substantial portions of the Software.                   */
+/*                                                                            */
+/*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS  */
+/*   OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF               */
+/*   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.   */
+/*   IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY     */
+/*   CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,     */
+/*   TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE        */
+/*   SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                   */
+/*                                                                            */
+/* ************************************************************************** */
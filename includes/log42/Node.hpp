@@ -18,7 +18,8 @@
  * @brief Declares the Node base class for representing nodes in the logging hierarchy.
  */ 
 
-#include <common/common.hpp>
+#include <log42/Sync.hpp>
+#include <cstddef>
 #include <string>
 
 namespace log42
@@ -28,29 +29,64 @@ namespace log42
  * @class Node
  * @brief Abstract base class representing a node in the logging hierarchy.
  *
+ * Besides its parent, a node links the nodes whose parent it is as an
+ * intrusive list, so a node's children are enumerated without scanning the
+ * hierarchy. The links are maintained by setParent() and are only changed
+ * and read under the Manager lock.
+ *
+ * The parent link is a plain pointer: the Manager owns every node until
+ * shutdown() and only frees a logger once nothing links to it, so walking
+ * up the hierarchy is pointer chasing only. A node is destroyed where its
+ * last reference is dropped, and its memory is freed through the Epoch, so
+ * a lock-free registry lookup that found it can still read its fields. A node also carries its kind, so
+ * callers tell loggers from placeholders without RTTI.
+ *
  * @startuml
  * class "Node" as Node {
 		# _name : string
 		# _parent : Node
+		# _firstChild : Node
+		# _nextSibling : Node
+		# _prevSibling : Node
+		# _kind : e_Kind
 		--
-		+ Node(name : string)
+		+ Node(name : string, kind : e_Kind)
 		+ getName() : string
-		+ getParent : Node
+		+ getKind() : e_Kind
+		+ getParent() : Node
+		+ getFirstChild() : Node
+		+ getNextSibling() : Node
 		+ setParent(parent : Node)
 		_ toString() : string
+		+ getFootprint() : size_t
+		+ {static} stringFootprint(str : string) : size_t
+		+ {static} operator new(size : size_t) : void
+		+ {static} operator delete(ptr : void) : void
+		- _linkChild(child : Node) : void
+		- _unlinkChild(child : Node) : void
 	}
  * @enduml
  */
 class Node
 {
 	public:
-		explicit Node(const std::string &name);
+		/**
+		 * @brief Kinds of node in the hierarchy.
+		 */
+		enum e_Kind
+		{
+			LOGGER,
+			PLACEHOLDER
+		};
+
+		Node(const std::string &name, const e_Kind kind);
 		virtual ~Node();
 
 		Node(const Node &rhs);
 		Node &operator=(const Node &rhs);
 
 		const std::string	&getName() const;
+		e_Kind				getKind() const;
 		/**
 		 * @brief Get the parent node (non-owning).
 		 *
@@ -58,29 +94,69 @@ class Node
 		 * centrally (for example by `Manager` using `raii::SharedPtr`). Do not
 		 * delete the returned pointer.
 		 */
-		common::core::raii::SharedPtr<Node>    getParent() const;
+		Node				*getParent() const;
+		Node				*getFirstChild() const;
+		Node				*getNextSibling() const;
 		/**
 		 * @brief Set the parent node (non-owning).
 		 *
-		 * @param Parent SharedPtr to the parent node. Ownership is not transferred
-	 * (the Manager typically holds the owning SharedPtr); the child will store
-	 * a WeakPtr reference.
+		 * @param parent Pointer to the parent node. Ownership is not
+		 * transferred (the Manager holds the owning SharedPtr).
 		 */
-		void			setParent(const common::core::raii::SharedPtr<Node> &Parent);
+		void			setParent(Node *parent);
 
 		virtual std::string toString() const = 0;
+		virtual std::size_t	getFootprint() const;
+
+		static std::size_t	stringFootprint(const std::string &str);
+		static void			*operator new(std::size_t size);
+		static void			operator delete(void *ptr);
 
 	protected:
 		std::string _name;
 		/**
 		 * Non-owning pointer to the parent node. Ownership is managed elsewhere
 		 * (e.g. Manager with raii::SharedPtr). This raw pointer must not be
-		 * deleted by the child.
+		 * deleted by the child. It is published atomically, so hierarchy walks
+		 * on the emit path take no lock and touch no refcount.
+		 */
+		Node								*_parent;
+		/**
+		 * Intrusive list of the nodes whose parent this node is.
 		 */
-	common::core::raii::WeakPtr<Node>	_parent;
-		
+		Node								*_firstChild;
+		Node								*_nextSibling;
+		Node								*_prevSibling;
+		e_Kind								_kind;
+
+	private:
+		void	_linkChild(Node *child);
+		void	_unlinkChild(Node *child);
 };
 
+/**
+ * @brief Gets the kind of the node.
+ *
+ * @return LOGGER or PLACEHOLDER.
+ */
+inline Node::e_Kind	Node::getKind() const
+{
+	return (this->_kind);
+}
+
+/**
+ * @brief Gets the parent node without taking a reference to it.
+ *
+ * Safe to call while another thread reparents the node; the parent stays
+ * alive as long as the Manager owns it.
+ *
+ * @return Pointer to the parent Node, or NULL for the root.
+ */
+inline Node	*Node::getParent() const
+{
+	return (sync::load(this->_parent));
+}
+
 } //!log42
 
 #endif // !LOG42_NODE_HPP
@@ -19,10 +19,13 @@
  * percent-style formatting.
  */ 
 
+#include <log42/Arena.hpp>
 #include <log42/LogRecord.hpp>
+#include <log42/StringRef.hpp>
 #include <log42/types.hpp>
 #include <map>
 #include <string>
+#include <vector>
 
 namespace log42
 {
@@ -35,21 +38,34 @@ namespace style
  *
  * This class allows formatting of log messages using a format string
  * with percent-style substitutions, similar to printf-style formatting.
+ * The format string is compiled once into literal and attribute segments, so
+ * formatting a record is a single pass appending into the output buffer.
+ * A placeholder that names no record attribute refers to a structured field
+ * of the record; a record without it gets the default of that name, if any,
+ * or the placeholder verbatim.
  *
  * @startuml
  * class "PercentStyle" as PercentStyle [[classlog42_1_1style_1_1_percent_style.html]] {
 		+ {static} defaultFormat : string
 		+ {static} asctimeFormat : string
 		+ {static} asctimeSearch : string
+		# _defaults : map<string, string>
+		# _segments : vector<Segment>
 		- _fmt : string
-		- _defaults : map<string, string>
+		- _usesTime : bool
 		--
 		+ PercentStyle(fmt : string, defaults : map<string, string>)
 		+ getFmt() : string
 		+ usetTime() : bool
 		+ validate() : void
-		+ format(record : LogRecord) : string
-		# _format(record : LogRecord) : string
+		+ format(record : LogRecord, asctime : string) : string
+		+ format(record : LogRecord, asctime : string, out : string) : void
+		# _format(record : LogRecord, asctime : string, out : string) : void
+		# _appendField(record : LogRecord, field : e_Field, asctime : string, out : string) : void
+		# _appendExpanded(record : LogRecord, text : string, out : string) : void
+		- _compile() : void
+		- _appendExtra(record : LogRecord, segment : Segment, out : string) : void
+		- {static} _lookup(name : string) : e_Field
 	}
  * @enduml
  */
@@ -71,14 +87,47 @@ class PercentStyle
 
 		bool				useTime() const;
 		virtual void		validate() const;
-		virtual std::string	format(const logRecord::LogRecord &record) const;
+		std::string			format(const logRecord::LogRecord &record, const std::string &asctime = "") const;
+		void				format(const logRecord::LogRecord &record, const StringRef &asctime, arena::t_string &out) const;
 	
 	protected:
-		virtual std::string	_format(const logRecord::LogRecord &record) const;
+		/**
+		 * @brief Record attributes a format segment can refer to.
+		 */
+		enum e_Field
+		{
+			LITERAL, ASCTIME, CREATED, FILENAME, FUNCNAME, LEVELNAME, LEVELNO,
+			LINENO, MESSAGE, MODULE, MSECS, NAME, PATHNAME, RELATIVECREATED, EXTRA
+		};
+
+		/**
+		 * @brief Compiled piece of the format: literal text, a record
+		 * attribute named by text, or a structured field named by text with
+		 * the text to use when the record lacks it.
+		 */
+		struct Segment
+		{
+			e_Field		field;
+			std::string	text;
+			std::string	fallback;
+		};
+
+		typedef std::vector<Segment>	t_segments;
+
+		t_defaults	_defaults;
+		t_segments	_segments;
+
+		virtual void	_format(const logRecord::LogRecord &record, const StringRef &asctime, arena::t_string &out) const;
+		void			_appendField(const logRecord::LogRecord &record, e_Field field, const StringRef &asctime, arena::t_string &out) const;
+		void			_appendExpanded(const logRecord::LogRecord &record, const StringRef &text, arena::t_string &out) const;
 
 	private:
 		std::string	_fmt;
-		t_defaults	_defaults;
+		bool		_usesTime;
+
+		void			_compile();
+		void			_appendExtra(const logRecord::LogRecord &record, const Segment &segment, arena::t_string &out) const;
+		static e_Field	_lookup(const char *name, std::size_t len);
 };
 
 } // !style
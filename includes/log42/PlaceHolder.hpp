@@ -18,9 +18,9 @@
  * @brief Declares the PlaceHolder class for managing placeholder loggers in the logging hierarchy.
  */ 
 
-#include <common/common.hpp>
 #include <log42/Node.hpp>
-#include <set>
+#include <log42/types.hpp>
+#include <string>
 
 namespace log42
 {
@@ -34,33 +34,40 @@ namespace placeholder
  * PlaceHolder objects are used to temporarily hold references to loggers
  * that have not yet been fully constructed or attached in the logging hierarchy.
  *
+ * The loggers are referenced by plain pointers, since the Manager owns them,
+ * and a placeholder is freed as soon as a logger takes its name.
+ *
  * @startuml
  * class "PlaceHolder" as PlaceHolder {
-		- _loggerSet : set<Node>
+		- _loggerSet : vector<Node>
 		--
-		+ PlaceHolder(alogger : Node)
+		+ PlaceHolder(name : string, alogger : Node)
 		+ append(alogger : Node) : void
-		+ getLoggerSet() : set<Node>
+		+ remove(nodes : vector<Node>) : void
+		+ getLoggerSet() : vector<Node>
 		+ toString() : string
+		+ getFootprint() : size_t
 	}
  * @enduml
  */
 class PlaceHolder : public Node
 {
 	public:
-		explicit PlaceHolder(const common::core::raii::SharedPtr<Node> &alogger);
+		PlaceHolder(const std::string &name, Node *alogger);
 		~PlaceHolder();
 
 		PlaceHolder(const PlaceHolder &rhs);
 		PlaceHolder &operator=(const PlaceHolder &rhs);
 
-		void append(const common::core::raii::SharedPtr<Node> &alogger);
-		const std::set<common::core::raii::SharedPtr<Node> > &getLoggerSet() const;
+		void append(Node *alogger);
+		void remove(const t_nodes &nodes);
+		const t_nodes &getLoggerSet() const;
 
 		std::string toString() const;
+		std::size_t	getFootprint() const;
 
 	private:
-		std::set<common::core::raii::SharedPtr<Node> > _loggerSet;
+		t_nodes _loggerSet;
 };
 
 } // !placeholder
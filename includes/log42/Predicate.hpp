@@ -0,0 +1,120 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   Predicate.hpp                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: pdemont <pdemont@student.42lausanne.ch>    +#+  +:+       +#+        */
+/*   By: blucken <blucken@student.42lausanne.ch>  +#+#+#+#+#+   +#+           */
+/*                                                     #+#    #+#             */
+/*   Created: 2026/10/18                              ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+#ifndef LOG42_PREDICATE_HPP
+#define LOG42_PREDICATE_HPP
+
+/**
+ * @file Predicate.hpp
+ * @brief Declares the Predicate interface for filters deciding on any part
+ * of a log record.
+ */ 
+
+#include <log42/Args.hpp>
+#include <log42/LogRecord.hpp>
+
+namespace log42
+{
+
+namespace filterer { class Filterer; }
+
+namespace filter
+{
+
+/**
+ * @class Predicate
+ * @brief Abstract filter deciding whether a log record is processed.
+ *
+ * Besides its decision, a predicate reports an estimated cost, in rough
+ * nanoseconds, so that a Filterer evaluates its cheapest predicates first,
+ * and whether it is static: a static predicate only reads the record's
+ * level and call site (file, line, function, module), so its decision is
+ * cached per call site and level and runs once rather than once per record.
+ *
+ * A predicate is shared by the sets it belongs to and may be evaluated by
+ * several threads at once; it must not change its decision, cost or
+ * staticness once added.
+ *
+ * A predicate that holds records back may report them through a summary
+ * record handed with _summarize() to the owner test() receives, the logger
+ * or handler applying it; while it is handled, every predicate passes it.
+ *
+ * @startuml
+ * abstract class "Predicate" as Predicate {
+		--
+		+ Predicate()
+		+ {abstract} test(record : LogRecord, owner : Filterer) : bool
+		+ {abstract} getCost() : unsigned int
+		+ {abstract} isStatic() : bool
+		# {static} _isSummary() : bool
+		# {static} _summarize(record : LogRecord, msg : StringRef, args : Args, owner : Filterer) : void
+		# {static} _summarize(name : StringRef, level : e_LogLevel, site : CallSite, msg : StringRef, args : Args, owner : Filterer) : void
+	}
+ * @enduml
+ */
+class Predicate
+{
+	public:
+		Predicate();
+		virtual ~Predicate();
+
+		virtual bool			test(const logRecord::LogRecord &record, filterer::Filterer &owner) const = 0;
+		virtual unsigned int	getCost() const = 0;
+		virtual bool			isStatic() const = 0;
+
+	protected:
+		static bool	_isSummary();
+		static void	_summarize(const logRecord::LogRecord &record, const StringRef &msg, const Args &args,
+						filterer::Filterer &owner);
+		static void	_summarize(const StringRef &name, const logRecord::e_LogLevel level,
+						const logRecord::CallSite *site, const StringRef &msg, const Args &args,
+						filterer::Filterer &owner);
+
+	private:
+		Predicate(const Predicate &rhs);
+		Predicate &operator=(const Predicate &rhs);
+};
+
+} // !filter
+} // !log42
+
+#endif // !LOG42_PREDICATE_HPP
+
+/* ************************************************************************** */
+/*                                                                            */
+/*                                MIT License                                 */
+/*                                                                            */
+/*   Copyright (c) 2025 Demont Pieric, Lucken Bénédict                        */
+/*                                                                            */
+/*   Inspired by the Python 'logging' module by Vinay Sajip.                  */
+/*   This implementation was rewritten in C++98 and contains no original      */
+/*   Python source code.                                                      */
+/*                                                                            */
+/*   Permission is hereby granted, free of charge, to any person obtaining    */
+/*   a copy of this software and associated documentation files (the          */
+/*   "Software"), to deal in the Software without restriction, including      */
+/*   without limitation the rights to use, copy, modify, merge, publish,      */
+/*   distribute, sublicense, and/or sell copies of the Software, and to       */
+/*   permit persons to whom the Software is furnished to do so, subject to    */
+/*   the following conditions:                                                */
+/*                                                                            */
+/*   The above copyright notice and this permission notice shall be included  */
+/*   in all copies or substantial portions of the Software.                   */
+/*                                                                            */
+/*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS  */
+/*   OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF               */
+/*   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.   */
+/*   IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY     */
+/*   CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,     */
+/*   TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE        */
+/*   SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                   */
+/*                                                                            */
+/* ************************************************************************** */
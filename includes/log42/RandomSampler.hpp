@@ -0,0 +1,94 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   RandomSampler.hpp                                  :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: pdemont <pdemont@student.42lausanne.ch>    +#+  +:+       +#+        */
+/*   By: blucken <blucken@student.42lausanne.ch>  +#+#+#+#+#+   +#+           */
+/*                                                     #+#    #+#             */
+/*   Created: 2026/10/18                              ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+#ifndef LOG42_RANDOMSAMPLER_HPP
+#define LOG42_RANDOMSAMPLER_HPP
+
+/**
+ * @file RandomSampler.hpp
+ * @brief Declares the RandomSampler keeping each record with a fixed
+ * probability.
+ */ 
+
+#include <log42/Sampler.hpp>
+
+namespace log42
+{
+namespace filter
+{
+
+/**
+ * @class RandomSampler
+ * @brief Keeps each record with a fixed probability.
+ *
+ * A decision draws from a thread-local xorshift generator: no shared state
+ * is written, so threads sampling the same logger do not contend.
+ *
+ * @startuml
+ * class "RandomSampler" as RandomSampler {
+		- _threshold : unsigned long
+		--
+		+ RandomSampler(rate : real)
+		+ getCost() : unsigned int
+		# _sample(site : CallSite) : bool
+	}
+ * @enduml
+ */
+class RandomSampler : public Sampler
+{
+	public:
+		explicit RandomSampler(const double rate);
+		~RandomSampler();
+
+		unsigned int	getCost() const;
+
+	protected:
+		bool	_sample(const logRecord::CallSite *site) const;
+
+	private:
+		unsigned long	_threshold;
+};
+
+} // !filter
+} // !log42
+
+#endif // !LOG42_RANDOMSAMPLER_HPP
+
+/* ************************************************************************** */
+/*                                                                            */
+/*                                MIT License                                 */
+/*                                                                            */
+/*   Copyright (c) 2025 Demont Pieric, Lucken Bénédict                        */
+/*                                                                            */
+/*   Inspired by the Python 'logging' module by Vinay Sajip.                  */
+/*   This implementation was rewritten in C++98 and contains no original      */
+/*   Python source code.                                                      */
+/*                                                                            */
+/*   Permission is hereby granted, free of charge, to any person obtaining    */
+/*   a copy of this software and associated documentation files (the          */
+/*   "Software"), to deal in the Software without restriction, including      */
+/*   without limitation the rights to use, copy, modify, merge, publish,      */
+/*   distribute, sublicense, and/or sell copies of the Software, and to       */
+/*   permit persons to whom the Software is furnished to do so, subject to    */
+/*   the following conditions:                                                */
+/*                                                                            */
+/*   The above copyright notice and this permission notice shall be included  */
+/*   in all copies or substantial portions of the Software.                   */
+/*                                                                            */
+/*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS  */
+/*   OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF               */
+/*   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.   */
+/*   IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY     */
+/*   CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,     */
+/*   TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE        */
+/*   SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                   */
+/*                                                                            */
+/* ************************************************************************** */
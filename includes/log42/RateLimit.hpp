@@ -0,0 +1,146 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   RateLimit.hpp                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: pdemont <pdemont@student.42lausanne.ch>    +#+  +:+       +#+        */
+/*   By: blucken <blucken@student.42lausanne.ch>  +#+#+#+#+#+   +#+           */
+/*                                                     #+#    #+#             */
+/*   Created: 2026/10/18                              ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+#ifndef LOG42_RATELIMIT_HPP
+#define LOG42_RATELIMIT_HPP
+
+/**
+ * @file RateLimit.hpp
+ * @brief Declares the RateLimit predicate capping the rate of records per
+ * call site or per logger.
+ */ 
+
+#include <log42/LogRecord.hpp>
+#include <log42/Predicate.hpp>
+#include <cstddef>
+
+namespace log42
+{
+namespace filter
+{
+
+/**
+ * @class RateLimit
+ * @brief Token bucket passing at most a given number of records per second
+ * for each call site, or for each logger, after an initial burst.
+ *
+ * Each key owns a bucket in a fixed open-addressing table. A bucket is the
+ * time at which it will be full again (the generic cell rate algorithm), so
+ * a decision is one clock read and one compare-and-swap, without locking
+ * or allocating. Keys are claimed with a compare-and-swap too; once a few
+ * probes find no free bucket, keys share one.
+ *
+ * A bucket counts the records it drops. The first record it passes again
+ * is preceded by a summary, "suppressed N similar messages", logged at the
+ * same level through the same logger; summaries themselves are never
+ * limited.
+ *
+ * @startuml
+ * class "RateLimit" as RateLimit {
+		- _interval : unsigned long
+		- _tolerance : unsigned long
+		- _key : e_Key
+		- _buckets : Bucket[]
+		- _mask : size_t
+		- _suppressed : unsigned long
+		--
+		+ RateLimit(perSecond : real, burst : unsigned int, key : e_Key, capacity : size_t)
+		+ test(record : LogRecord, owner : Filterer) : bool
+		+ getCost() : unsigned int
+		+ isStatic() : bool
+		+ getSuppressed() : unsigned long
+		- _bucket(key : unsigned long) : Bucket
+		- _report(record : LogRecord, count : unsigned long, owner : Filterer) : void
+	}
+ * @enduml
+ */
+class RateLimit : public Predicate
+{
+	public:
+		/**
+		 * @brief What a bucket is kept for.
+		 */
+		enum e_Key
+		{
+			PER_CALL_SITE,
+			PER_LOGGER
+		};
+
+		explicit RateLimit(const double perSecond, const unsigned int burst = 1,
+			const e_Key key = PER_CALL_SITE, const std::size_t capacity = 1024);
+		~RateLimit();
+
+		bool			test(const logRecord::LogRecord &record, filterer::Filterer &owner) const;
+		unsigned int	getCost() const;
+		bool			isStatic() const;
+		unsigned long	getSuppressed() const;
+
+	private:
+		/**
+		 * @brief State of one key: the time, in nanoseconds, at which the
+		 * bucket is full again, and the records dropped since the last one
+		 * passed. A null key marks a free bucket.
+		 */
+		struct Bucket
+		{
+			unsigned long	key;
+			unsigned long	full;
+			unsigned long	dropped;
+		};
+
+		static const std::size_t	maxProbes = 8;
+
+		unsigned long			_interval;
+		unsigned long			_tolerance;
+		e_Key					_key;
+		Bucket					*_buckets;
+		std::size_t				_mask;
+		mutable unsigned long	_suppressed;
+
+		Bucket	*_bucket(const unsigned long key) const;
+		void	_report(const logRecord::LogRecord &record, const unsigned long count, filterer::Filterer &owner) const;
+};
+
+} // !filter
+} // !log42
+
+#endif // !LOG42_RATELIMIT_HPP
+
+/* ************************************************************************** */
+/*                                                                            */
+/*                                MIT License                                 */
+/*                                                                            */
+/*   Copyright (c) 2025 Demont Pieric, Lucken Bénédict                        */
+/*                                                                            */
+/*   Inspired by the Python 'logging' module by Vinay Sajip.                  */
+/*   This implementation was rewritten in C++98 and contains no original      */
+/*   Python source code.                                                      */
+/*                                                                            */
+/*   Permission is hereby granted, free of charge, to any person obtaining    */
+/*   a copy of this software and associated documentation files (the          */
+/*   "Software"), to deal in the Software without restriction, including      */
+/*   without limitation the rights to use, copy, modify, merge, publish,      */
+/*   distribute, sublicense, and/or sell copies of the Software, and to       */
+/*   permit persons to whom the Software is furnished to do so, subject to    */
+/*   the following conditions:                                                */
+/*                                                                            */
+/*   The above copyright notice and this permission notice shall be included  */
+/*   in all copies or substantial portions of the Software.                   */
+/*                                                                            */
+/*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS  */
+/*   OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF               */
+/*   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.   */
+/*   IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY     */
+/*   CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,     */
+/*   TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE        */
+/*   SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                   */
+/*                                                                            */
+/* ************************************************************************** */
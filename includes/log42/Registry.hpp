@@ -0,0 +1,166 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   Registry.hpp                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: pdemont <pdemont@student.42lausanne.ch>    +#+  +:+       +#+        */
+/*   By: blucken <blucken@student.42lausanne.ch>  +#+#+#+#+#+   +#+           */
+/*                                                     #+#    #+#             */
+/*   Created: 2026/10/18                              ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+#ifndef LOG42_REGISTRY_HPP
+#define LOG42_REGISTRY_HPP
+
+/**
+ * @file Registry.hpp
+ * @brief Declares the Registry class indexing the nodes of the logger
+ * hierarchy by name for lock-free lookups.
+ */ 
+
+#include <log42/StringRef.hpp>
+#include <cstddef>
+#include <string>
+
+namespace log42
+{
+class Node;
+namespace logger { class Logger; }
+
+namespace manager
+{
+
+/**
+ * @class Registry
+ * @brief Open-addressing hash index from names to the loggers and
+ * placeholders of the hierarchy.
+ *
+ * Lookups take no lock: they probe the current table inside an Epoch::Guard
+ * and read each slot with one acquire load. They accept any StringRef, so
+ * the Manager resolves every dotted prefix of a name without building
+ * substrings.
+ *
+ * Bindings are serialized by the caller (the Manager lock). A new entry is
+ * published with a release store, either in a free slot or over the entry of
+ * the same name it replaces (a placeholder becoming a logger), which is
+ * retired to the Epoch. A table past three quarters full is rebuilt at twice
+ * the size and swapped in the same way, and one less than an eighth full
+ * after a removal at half the size. Removing a name shifts the entries
+ * that follow it in its probe sequence back by one slot. A lookup racing
+ * with a binding or a removal may miss an entry, and then falls back to the
+ * locked path.
+ *
+ * @startuml
+ * class "Registry" as Registry {
+		- _table : Table
+		- _size : size_t
+		--
+		+ Registry()
+		+ find(name : StringRef) : Logger
+		+ findNode(name : StringRef) : Node
+		+ bind(name : string, node : Node, alogger : Logger) : void
+		+ unbind(name : StringRef) : void
+		+ clear() : void
+		+ size() : size_t
+		+ getFootprint() : size_t
+		- _lookup(name : StringRef) : Entry
+		- _resize(capacity : size_t) : Table
+		- {static} _hash(name : StringRef) : unsigned long
+		- {static} _probe(table : Table, hash : unsigned long, name : StringRef) : size_t
+	}
+ * @enduml
+ */
+class Registry
+{
+	public:
+		Registry();
+		~Registry();
+
+		logger::Logger	*find(const StringRef &name) const;
+		Node			*findNode(const StringRef &name) const;
+		void			bind(const std::string &name, Node *node, logger::Logger *alogger);
+		void			unbind(const StringRef &name);
+		void			clear();
+		std::size_t		size() const;
+		std::size_t		getFootprint() const;
+
+	private:
+		/**
+		 * @brief Immutable name to node binding, shared by the successive
+		 * tables. alogger is the node as a logger, NULL for a placeholder.
+		 * The name is stored inline, in the same allocation.
+		 */
+		struct Entry
+		{
+			unsigned long	hash;
+			Node			*node;
+			logger::Logger	*alogger;
+			std::size_t		length;
+			char			name[1];
+
+			static Entry	*create(const std::string &name, Node *node, logger::Logger *alogger);
+			static void		operator delete(void *entry);
+		};
+
+		/**
+		 * @brief Power-of-two array of slots, NULL when empty.
+		 */
+		struct Table
+		{
+			std::size_t	mask;
+			Entry		**slots;
+
+			explicit Table(std::size_t capacity);
+			~Table();
+		};
+
+		static const std::size_t	initialCapacity = 64;
+
+		Table		*_table;
+		std::size_t	_size;
+
+		Registry(const Registry &rhs);
+		Registry &operator=(const Registry &rhs);
+
+		const Entry				*_lookup(const StringRef &name) const;
+		Table					*_resize(std::size_t capacity);
+
+		static unsigned long	_hash(const StringRef &name);
+		static std::size_t		_probe(const Table *table, unsigned long hash, const StringRef &name);
+};
+
+} // !manager
+} // !log42
+
+#endif // !LOG42_REGISTRY_HPP
+
+/* ************************************************************************** */
+/*                                                                            */
+/*                                MIT License                                 */
+/*                                                                            */
+/*   Copyright (c) 2025 Demont Pieric, Lucken Bénédict                        */
+/*                                                                            */
+/*   Inspired by the Python 'logging' module by Vinay Sajip.                  */
+/*   This implementation was rewritten in C++98 and contains no original      */
+/*   Python source code.                                                      */
+/*                                                                            */
+/*   Permission is hereby granted, free of charge, to any person obtaining    */
+/*   a copy of this software and associated documentation files (the          */
+/*   "Software"), to deal in the Software without restriction, including      */
+/*   without limitation the rights to use, copy, modify, merge, publish,      */
+/*   distribute, sublicense, and/or sell copies of the Software, and to       */
+/*   permit persons to whom the Software is furnished to do so, subject to    */
+/*   the following conditions:                                                */
+/*                                                                            */
+/*   The above copyright notice and this permission notice shall be included  */
+/*   in all copies or substantial portions of the Software.                   */
+/*                                                                            */
+/*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS  */
+/*   OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF               */
+/*   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.   */
+/*   IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY     */
+/*   CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,     */
+/*   TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE        */
+/*   SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                   */
+/*                                                                            */
+/* ************************************************************************** */
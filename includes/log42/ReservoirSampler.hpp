@@ -0,0 +1,110 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   ReservoirSampler.hpp                               :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: pdemont <pdemont@student.42lausanne.ch>    +#+  +:+       +#+        */
+/*   By: blucken <blucken@student.42lausanne.ch>  +#+#+#+#+#+   +#+           */
+/*                                                     #+#    #+#             */
+/*   Created: 2026/10/18                              ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+#ifndef LOG42_RESERVOIRSAMPLER_HPP
+#define LOG42_RESERVOIRSAMPLER_HPP
+
+/**
+ * @file ReservoirSampler.hpp
+ * @brief Declares the ReservoirSampler keeping a fixed number of records per
+ * time window.
+ */ 
+
+#include <log42/Sampler.hpp>
+
+namespace log42
+{
+namespace filter
+{
+
+/**
+ * @class ReservoirSampler
+ * @brief Keeps at most a fixed number of records per time window, spread
+ * uniformly over the window.
+ *
+ * A record is kept or dropped when it is logged, so unlike a buffering
+ * reservoir it cannot evict one kept earlier. Instead the n-th record of a
+ * window is kept with probability size / max(n, previous window's count):
+ * in the first window this is the inclusion probability of reservoir
+ * sampling, and once the volume is known the kept records are spread over
+ * the whole window instead of bunched at its start. At most size records
+ * are kept per window.
+ *
+ * @startuml
+ * class "ReservoirSampler" as ReservoirSampler {
+		- _size : unsigned long
+		- _seconds : long
+		- _window : long
+		- _seen : unsigned long
+		- _kept : unsigned long
+		- _previous : unsigned long
+		--
+		+ ReservoirSampler(size : unsigned long, seconds : unsigned int)
+		+ getCost() : unsigned int
+		# _sample(site : CallSite) : bool
+	}
+ * @enduml
+ */
+class ReservoirSampler : public Sampler
+{
+	public:
+		explicit ReservoirSampler(const unsigned long size, const unsigned int seconds = 1);
+		~ReservoirSampler();
+
+		unsigned int	getCost() const;
+
+	protected:
+		bool	_sample(const logRecord::CallSite *site) const;
+
+	private:
+		unsigned long			_size;
+		long					_seconds;
+		mutable long			_window;
+		mutable unsigned long	_seen;
+		mutable unsigned long	_kept;
+		mutable unsigned long	_previous;
+};
+
+} // !filter
+} // !log42
+
+#endif // !LOG42_RESERVOIRSAMPLER_HPP
+
+/* ************************************************************************** */
+/*                                                                            */
+/*                                MIT License                                 */
+/*                                                                            */
+/*   Copyright (c) 2025 Demont Pieric, Lucken Bénédict                        */
+/*                                                                            */
+/*   Inspired by the Python 'logging' module by Vinay Sajip.                  */
+/*   This implementation was rewritten in C++98 and contains no original      */
+/*   Python source code.                                                      */
+/*                                                                            */
+/*   Permission is hereby granted, free of charge, to any person obtaining    */
+/*   a copy of this software and associated documentation files (the          */
+/*   "Software"), to deal in the Software without restriction, including      */
+/*   without limitation the rights to use, copy, modify, merge, publish,      */
+/*   distribute, sublicense, and/or sell copies of the Software, and to       */
+/*   permit persons to whom the Software is furnished to do so, subject to    */
+/*   the following conditions:                                                */
+/*                                                                            */
+/*   The above copyright notice and this permission notice shall be included  */
+/*   in all copies or substantial portions of the Software.                   */
+/*                                                                            */
+/*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS  */
+/*   OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF               */
+/*   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.   */
+/*   IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY     */
+/*   CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,     */
+/*   TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE        */
+/*   SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                   */
+/*                                                                            */
+/* ************************************************************************** */
@@ -0,0 +1,107 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   Sampler.hpp                                        :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: pdemont <pdemont@student.42lausanne.ch>    +#+  +:+       +#+        */
+/*   By: blucken <blucken@student.42lausanne.ch>  +#+#+#+#+#+   +#+           */
+/*                                                     #+#    #+#             */
+/*   Created: 2026/10/18                              ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+#ifndef LOG42_SAMPLER_HPP
+#define LOG42_SAMPLER_HPP
+
+/**
+ * @file Sampler.hpp
+ * @brief Declares the Sampler interface for policies keeping a share of the
+ * records of a logger.
+ */ 
+
+#include <log42/CallSite.hpp>
+#include <log42/LogRecord.hpp>
+#include <log42/Predicate.hpp>
+
+namespace log42
+{
+namespace filter
+{
+
+/**
+ * @class Sampler
+ * @brief Abstract predicate keeping a share of the records, deciding from
+ * the call site alone.
+ *
+ * Set on a Logger with setSampler(), a sampler decides before the record is
+ * built, so a call it samples out costs little more than a disabled one.
+ * Added as a filter to a Handler, it decides on the records that reach it.
+ * Either way it counts the records it samples out.
+ *
+ * @startuml
+ * abstract class "Sampler" as Sampler {
+		- _sampledOut : unsigned long
+		--
+		+ Sampler()
+		+ keep(site : CallSite) : bool
+		+ test(record : LogRecord, owner : Filterer) : bool
+		+ isStatic() : bool
+		+ getSampledOut() : unsigned long
+		# {abstract} _sample(site : CallSite) : bool
+		# {static} _random() : unsigned long
+	}
+ * @enduml
+ */
+class Sampler : public Predicate
+{
+	public:
+		Sampler();
+		virtual ~Sampler();
+
+		bool			keep(const logRecord::CallSite *site) const;
+		bool			test(const logRecord::LogRecord &record, filterer::Filterer &owner) const;
+		bool			isStatic() const;
+		unsigned long	getSampledOut() const;
+
+	protected:
+		virtual bool		_sample(const logRecord::CallSite *site) const = 0;
+		static unsigned long	_random();
+
+	private:
+		mutable unsigned long	_sampledOut;
+};
+
+} // !filter
+} // !log42
+
+#endif // !LOG42_SAMPLER_HPP
+
+/* ************************************************************************** */
+/*                                                                            */
+/*                                MIT License                                 */
+/*                                                                            */
+/*   Copyright (c) 2025 Demont Pieric, Lucken Bénédict                        */
+/*                                                                            */
+/*   Inspired by the Python 'logging' module by Vinay Sajip.                  */
+/*   This implementation was rewritten in C++98 and contains no original      */
+/*   Python source code.                                                      */
+/*                                                                            */
+/*   Permission is hereby granted, free of charge, to any person obtaining    */
+/*   a copy of this software and associated documentation files (the          */
+/*   "Software"), to deal in the Software without restriction, including      */
+/*   without limitation the rights to use, copy, modify, merge, publish,      */
+/*   distribute, sublicense, and/or sell copies of the Software, and to       */
+/*   permit persons to whom the Software is furnished to do so, subject to    */
+/*   the following conditions:                                                */
+/*                                                                            */
+/*   The above copyright notice and this permission notice shall be included  */
+/*   in all copies or substantial portions of the Software.                   */
+/*                                                                            */
+/*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS  */
+/*   OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF               */
+/*   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.   */
+/*   IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY     */
+/*   CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,     */
+/*   TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE        */
+/*   SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                   */
+/*                                                                            */
+/* ************************************************************************** */
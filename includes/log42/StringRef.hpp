@@ -0,0 +1,104 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   StringRef.hpp                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: pdemont <pdemont@student.42lausanne.ch>    +#+  +:+       +#+        */
+/*   By: blucken <blucken@student.42lausanne.ch>  +#+#+#+#+#+   +#+           */
+/*                                                     #+#    #+#             */
+/*   Created: 2026/10/18                              ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef LOG42_STRINGREF_HPP
+#define LOG42_STRINGREF_HPP
+
+/**
+ * @file StringRef.hpp
+ * @brief Declares the StringRef class, a non-owning reference to a string.
+ */ 
+
+#include <cstddef>
+#include <string>
+
+namespace log42
+{
+
+/**
+ * @class StringRef
+ * @brief Non-owning view over a character sequence.
+ *
+ * Lets the logging entry points accept both string literals and std::string
+ * without building a temporary std::string (and allocating) for every call.
+ * A StringRef never outlives the expression it was created in.
+ *
+ * @startuml
+ * class "StringRef" as StringRef {
+		- _data : char[]
+		- _size : size_t
+		--
+		+ StringRef(str : char[])
+		+ StringRef(str : string)
+		+ StringRef(data : char[], size : size_t)
+		+ data() : char[]
+		+ size() : size_t
+		+ empty() : bool
+		+ str() : string
+	}
+ * @enduml
+ */
+class StringRef
+{
+	public:
+		StringRef(const char *str);
+		StringRef(const std::string &str);
+		StringRef(const char *data, std::size_t size);
+		~StringRef();
+
+		StringRef(const StringRef &rhs);
+		StringRef &operator=(const StringRef &rhs);
+
+		const char	*data() const;
+		std::size_t	size() const;
+		bool		empty() const;
+		std::string	str() const;
+
+	private:
+		const char	*_data;
+		std::size_t	_size;
+};
+
+} // !log42
+
+#endif // !LOG42_STRINGREF_HPP
+
+/* ************************************************************************** */
+/*                                                                            */
+/*                                MIT License                                 */
+/*                                                                            */
+/*   Copyright (c) 2025 Demont Pieric, Lucken Bénédict                        */
+/*                                                                            */
+/*   Inspired by the Python 'logging' module by Vinay Sajip.                  */
+/*   This implementation was rewritten in C++98 and contains no original      */
+/*   Python source code.                                                      */
+/*                                                                            */
+/*   Permission is hereby granted, free of charge, to any person obtaining    */
+/*   a copy of this software and associated documentation files (the          */
+/*   "Software"), to deal in the Software without restriction, including      */
+/*   without limitation the rights to use, copy, modify, merge, publish,      */
+/*   distribute, sublicense, and/or sell copies of the Software, and to       */
+/*   permit persons to whom the Software is furnished to do so, subject to    */
+/*   the following conditions:                                                */
+/*                                                                            */
+/*   The above copyright notice and this permission notice shall be included  */
+/*   in all copies or substantial portions of the Software.                   */
+/*                                                                            */
+/*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS  */
+/*   OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF               */
+/*   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.   */
+/*   IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY     */
+/*   CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,     */
+/*   TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE        */
+/*   SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                   */
+/*                                                                            */
+/* ************************************************************************** */
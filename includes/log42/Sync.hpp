@@ -0,0 +1,494 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   Sync.hpp                                           :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: pdemont <pdemont@student.42lausanne.ch>    +#+  +:+       +#+        */
+/*   By: blucken <blucken@student.42lausanne.ch>  +#+#+#+#+#+   +#+           */
+/*                                                     #+#    #+#             */
+/*   Created: 2026/10/18                              ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef LOG42_SYNC_HPP
+#define LOG42_SYNC_HPP
+
+/**
+ * @file Sync.hpp
+ * @brief Declares the synchronization primitives of the logging core: atomic
+ * accessors, mutexes, epoch-based reclamation and copy-on-write published
+ * values.
+ */ 
+
+#include <pthread.h>
+#include <cstddef>
+
+namespace log42
+{
+namespace sync
+{
+
+/**
+ * The accessors below wrap the compiler's __atomic builtins. Acquire loads and
+ * release stores compile to plain moves on x86, so reading configuration on
+ * the emit path costs no more than before, while ThreadSanitizer still sees
+ * the accesses as synchronized.
+ */
+
+/**
+ * @brief Reads a value published by another thread.
+ *
+ * Reads made after the load see the writes the publisher made before its store.
+ *
+ * @param value The shared value.
+ * @return The current value.
+ */
+template <typename T>
+inline T	load(const T &value)
+{
+	return (__atomic_load_n(&value, __ATOMIC_ACQUIRE));
+}
+
+/**
+ * @brief Publishes a value to other threads.
+ *
+ * @param target The shared value.
+ * @param value The new value.
+ */
+template <typename T>
+inline void	store(T &target, T value)
+{
+	__atomic_store_n(&target, value, __ATOMIC_RELEASE);
+}
+
+/**
+ * @brief Atomically adds to a value.
+ *
+ * @param target The shared value.
+ * @param delta The amount to add.
+ * @return The value before the addition.
+ */
+template <typename T>
+inline T	fetchAdd(T &target, T delta)
+{
+	return (__atomic_fetch_add(&target, delta, __ATOMIC_ACQ_REL));
+}
+
+/**
+ * @brief Atomically replaces a value if it still holds the expected one.
+ *
+ * @param target The shared value.
+ * @param expected The value the target must hold.
+ * @param desired The value to store.
+ * @return True if the value was replaced.
+ */
+template <typename T>
+inline bool	compareAndSwap(T &target, T expected, T desired)
+{
+	return (__atomic_compare_exchange_n(&target, &expected, desired, false, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE));
+}
+
+/**
+ * @class Mutex
+ * @brief Non-copyable wrapper of a pthread mutex.
+ *
+ * A recursive mutex may be locked again by the thread holding it, which lets
+ * a handler call its own locked methods, such as flush(), from emit().
+ *
+ * @startuml
+ * class "Mutex" as Mutex {
+		- _mutex : pthread_mutex_t
+		--
+		+ Mutex(recursive : bool)
+		+ lock() : void
+		+ unlock() : void
+	}
+ * @enduml
+ */
+class Mutex
+{
+	public:
+		explicit Mutex(bool recursive = false);
+		~Mutex();
+
+		void	lock();
+		void	unlock();
+
+	private:
+		pthread_mutex_t	_mutex;
+
+		Mutex(const Mutex &rhs);
+		Mutex &operator=(const Mutex &rhs);
+};
+
+/**
+ * @class ScopedLock
+ * @brief RAII guard holding a Mutex for the lifetime of a scope.
+ *
+ * @startuml
+ * class "ScopedLock" as ScopedLock {
+		- _mutex : Mutex
+		--
+		+ ScopedLock(mutex : Mutex)
+	}
+ * @enduml
+ */
+class ScopedLock
+{
+	public:
+		explicit ScopedLock(Mutex &mutex);
+		~ScopedLock();
+
+	private:
+		Mutex	&_mutex;
+
+		ScopedLock(const ScopedLock &rhs);
+		ScopedLock &operator=(const ScopedLock &rhs);
+};
+
+Mutex	&stripeLock(const void *address);
+Mutex	&referenceLock();
+bool	everyMillis(unsigned long &last, const unsigned long period);
+
+/**
+ * @class Epoch
+ * @brief Epoch-based reclamation of values that other threads may still be
+ * reading after they were replaced.
+ *
+ * Readers wrap their accesses in a Guard, which records the global epoch the
+ * thread entered at; guards nest and cost a thread-local increment and one
+ * store. A writer that unlinks a value retires it: the value is tagged with
+ * the current epoch, the epoch advances, and the value is destroyed once
+ * every thread still inside a guard entered after it was retired. Retired
+ * values are collected by later retirements or by collect().
+ *
+ * @startuml
+ * class "Epoch" as Epoch {
+		+ {static} retire(ptr : T) : void
+		+ {static} retireMemory(ptr : void) : void
+		+ {static} collect() : void
+		+ {static} pending() : size_t
+		- {static} _enter() : void
+		- {static} _leave() : void
+		- {static} _retire(ptr : void, destroy : void) : void
+		- {static} _destroy(ptr : void) : void
+	}
+ * @enduml
+ */
+class Epoch
+{
+	public:
+		class Guard;
+
+		/**
+		 * @brief Schedules a value for destruction once no reader can hold it.
+		 *
+		 * The value must already be unreachable for threads entering a guard.
+		 *
+		 * @param ptr The value to destroy, allocated with new.
+		 */
+		template <typename T>
+		static void	retire(T *ptr)
+		{
+			if (ptr)
+				_retire(ptr, &_destroy<T>);
+		}
+
+		static void			retireMemory(void *ptr);
+		static void			collect();
+		static std::size_t	pending();
+
+		/**
+		 * @class Guard
+		 * @brief RAII marker of a read-side critical section.
+		 *
+		 * Values read from a Published holder stay valid until the outermost
+		 * guard of the thread ends.
+		 */
+		class Guard
+		{
+			public:
+				/**
+				 * @brief Enters a read-side critical section.
+				 */
+				Guard()
+				{
+					Epoch::_enter();
+				}
+
+				/**
+				 * @brief Leaves the read-side critical section.
+				 */
+				~Guard()
+				{
+					Epoch::_leave();
+				}
+
+			private:
+				Guard(const Guard &rhs);
+				Guard &operator=(const Guard &rhs);
+		};
+
+	private:
+		Epoch();
+		~Epoch();
+		Epoch(const Epoch &rhs);
+		Epoch &operator=(const Epoch &rhs);
+
+		/**
+		 * @brief Destroys a retired value of type T.
+		 *
+		 * @param ptr The value.
+		 */
+		template <typename T>
+		static void	_destroy(void *ptr)
+		{
+			delete static_cast<T *>(ptr);
+		}
+
+		static void	_enter();
+		static void	_leave();
+		static void	_retire(void *ptr, void (*destroy)(void *));
+
+		friend class Guard;
+		template <typename T> friend class Published;
+};
+
+/**
+ * @class Published
+ * @brief Copy-on-write holder of a value read without locking.
+ *
+ * Readers get the current version with a single load and never block; the
+ * version stays valid while they hold an Epoch::Guard. Writers serialize on
+ * referenceLock(), edit a private copy through a Writer and publish it. The
+ * version it replaces is retired to the Epoch and destroyed, under the same
+ * lock, once the readers that may hold it are gone: versions share the
+ * reference counts of the values they hold, which are not atomic. A reader
+ * copying such a value out of a version holds the lock as well.
+ *
+ * A holder is a single pointer. Every empty holder of a given type points
+ * to one shared empty value, which is never retired, so the many loggers
+ * without handlers or filters allocate nothing for them.
+ *
+ * @startuml
+ * class "Published<T>" as Published {
+		- _current : T
+		--
+		+ Published()
+		+ get() : T
+		- {static} _empty() : T
+		- {static} _retire(value : T) : void
+		- {static} _destroy(ptr : void) : void
+	}
+ * @enduml
+ */
+template <typename T>
+class Published
+{
+	public:
+		class Writer;
+
+		/**
+		 * @brief Constructs a holder of a default-constructed value.
+		 */
+		Published() : _current(_empty()) {}
+
+		/**
+		 * @brief Constructs a holder of a copy of another holder's current value.
+		 *
+		 * @param rhs The holder to copy.
+		 */
+		Published(const Published &rhs) : _current(_empty())
+		{
+			Epoch::Guard guard;
+			ScopedLock lock(referenceLock());
+			if (!rhs.get().empty())
+				this->_current = new T(rhs.get());
+		}
+
+		/**
+		 * @brief Publishes a copy of another holder's current value.
+		 *
+		 * @param rhs The holder to copy.
+		 * @return Reference to this holder.
+		 */
+		Published &operator=(const Published &rhs)
+		{
+			if (this != &rhs)
+			{
+				Epoch::Guard guard;
+				Writer writer(*this);
+				*writer = rhs.get();
+				writer.commit();
+			}
+			return (*this);
+		}
+
+		/**
+		 * @brief Destructor; retires the current version.
+		 */
+		~Published()
+		{
+			_retire(this->_current);
+		}
+
+		/**
+		 * @brief Gets the current version.
+		 *
+		 * The load is sequentially consistent so that it cannot be ordered
+		 * before the epoch announced by the caller's guard.
+		 *
+		 * @return The current value, valid until the caller's guard ends.
+		 */
+		const T	&get() const
+		{
+			return (*__atomic_load_n(&this->_current, __ATOMIC_SEQ_CST));
+		}
+
+		/**
+		 * @class Writer
+		 * @brief Scoped edit of a Published value.
+		 *
+		 * Holds referenceLock() and a private copy of the current value;
+		 * commit() publishes the copy, otherwise it is discarded.
+		 */
+		class Writer
+		{
+			public:
+				/**
+				 * @brief Starts an edit of the holder's current value.
+				 *
+				 * @param owner The holder to edit.
+				 */
+				explicit Writer(Published &owner) : _owner(owner), _lock(referenceLock()), _next(new T(*owner._current)) {}
+
+				/**
+				 * @brief Discards the copy unless it was committed.
+				 */
+				~Writer()
+				{
+					delete this->_next;
+				}
+
+				/**
+				 * @brief Accesses the copy being edited.
+				 *
+				 * @return Reference to the copy.
+				 */
+				T	&operator*()
+				{
+					return (*this->_next);
+				}
+
+				/**
+				 * @brief Accesses the copy being edited.
+				 *
+				 * @return Pointer to the copy.
+				 */
+				T	*operator->()
+				{
+					return (this->_next);
+				}
+
+				/**
+				 * @brief Publishes the copy, or the shared empty value if the
+				 * copy is empty, and retires the version it replaces.
+				 */
+				void	commit()
+				{
+					T *previous = this->_owner._current;
+					T *next = this->_next;
+					this->_next = NULL;
+					if (next->empty())
+					{
+						delete next;
+						next = _empty();
+					}
+					__atomic_store_n(&this->_owner._current, next, __ATOMIC_SEQ_CST);
+					_retire(previous);
+				}
+
+			private:
+				Published	&_owner;
+				ScopedLock	_lock;
+				T			*_next;
+
+				Writer(const Writer &rhs);
+				Writer &operator=(const Writer &rhs);
+		};
+
+	private:
+		T	*_current;
+
+		/**
+		 * @brief Gets the empty value shared by the empty holders of this
+		 * type. It is never destroyed.
+		 *
+		 * @return The shared empty value.
+		 */
+		static T	*_empty()
+		{
+			static T *value = new T();
+			return (value);
+		}
+
+		/**
+		 * @brief Retires a replaced version, unless it is the shared empty
+		 * value.
+		 *
+		 * @param value The version.
+		 */
+		static void	_retire(T *value)
+		{
+			if (value != _empty())
+				Epoch::_retire(value, &_destroy);
+		}
+
+		/**
+		 * @brief Destroys a retired version under referenceLock(), whatever
+		 * the thread collecting it.
+		 *
+		 * @param ptr The version.
+		 */
+		static void	_destroy(void *ptr)
+		{
+			ScopedLock lock(referenceLock());
+			delete static_cast<T *>(ptr);
+		}
+};
+
+} // !sync
+} // !log42
+
+#endif // !LOG42_SYNC_HPP
+
+/* ************************************************************************** */
+/*                                                                            */
+/*                                MIT License                                 */
+/*                                                                            */
+/*   Copyright (c) 2025 Demont Pieric, Lucken Bénédict                        */
+/*                                                                            */
+/*   Inspired by the Python 'logging' module by Vinay Sajip.                  */
+/*   This implementation was rewritten in C++98 and contains no original      */
+/*   Python source code.                                                      */
+/*                                                                            */
+/*   Permission is hereby granted, free of charge, to any person obtaining    */
+/*   a copy of this software and associated documentation files (the          */
+/*   "Software"), to deal in the Software without restriction, including      */
+/*   without limitation the rights to use, copy, modify, merge, publish,      */
+/*   distribute, sublicense, and/or sell copies of the Software, and to       */
+/*   permit persons to whom the Software is furnished to do so, subject to    */
+/*   the following conditions:                                                */
+/*                                                                            */
+/*   The above copyright notice and this permission notice shall be included  */
+/*   in all copies or substantial portions of the Software.                   */
+/*                                                                            */
+/*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS  */
+/*   OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF               */
+/*   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.   */
+/*   IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY     */
+/*   CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,     */
+/*   TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE        */
+/*   SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                   */
+/*                                                                            */
+/* ************************************************************************** */
@@ -57,6 +57,14 @@ enum e_LogLevel { NOTSET, DEBUG, INFO, WARNING, ERROR, CRITICAL };
  */
 std::string levelToString(e_LogLevel level);
 
+/**
+ * @brief Returns the statically allocated name of a log level.
+ *
+ * @param level The log level to convert.
+ * @return const char* The name of the log level, valid for the whole program.
+ */
+const char	*levelName(e_LogLevel level);
+
 } // !logRecord
 } // !log42
 
@@ -25,7 +25,7 @@ namespace log42
 
 namespace logRecord { class LogRecord; }
 namespace handler { class Handler; }
-namespace filter { class Filter; }
+namespace filter { class Filter; class Predicate; }
 namespace logger { class Logger; }
 class Node;
 
@@ -35,9 +35,9 @@ typedef std::vector<std::string> t_args;
 typedef std::map<std::string, std::string> t_defaults;
 typedef std::map<std::string, common::core::raii::SharedPtr<Node> > t_loggerMap;
 typedef std::set<filter::Filter> t_filters;
+typedef std::vector<common::core::raii::SharedPtr<filter::Predicate> > t_predicates;
 typedef std::set<common::core::raii::SharedPtr<logger::Logger> > t_loggers;
-typedef std::map<logRecord::e_LogLevel, bool> t_cache;
-typedef std::set<common::core::raii::SharedPtr<Node> > t_nodes;
+typedef std::vector<Node *> t_nodes;
 
 } // !log42
 
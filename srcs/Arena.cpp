@@ -0,0 +1,341 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   Arena.cpp                                          :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: pdemont <pdemont@student.42lausanne.ch>    +#+  +:+       +#+        */
+/*   By: blucken <blucken@student.42lausanne.ch>  +#+#+#+#+#+   +#+           */
+/*                                                     #+#    #+#             */
+/*   Created: 2026/10/18                              ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+/**
+ * @file Arena.cpp
+ * @brief Implements the per-thread Arena, its Scope and the global Pool.
+ */ 
+
+#include <log42/Arena.hpp>
+#include <pthread.h>
+#include <new>
+
+namespace log42
+{
+namespace arena
+{
+
+/**
+ * @brief Thread-local pointer to the calling thread's arena.
+ */
+static __thread Arena	*tlsArena = NULL;
+
+/**
+ * @brief Key whose destructor releases an arena when its thread exits.
+ */
+static pthread_key_t	arenaKey;
+
+/**
+ * @brief Guard for the one-time creation of arenaKey.
+ */
+static pthread_once_t	arenaKeyOnce = PTHREAD_ONCE_INIT;
+
+/**
+ * @brief Rounds a size up to the arena alignment.
+ *
+ * @param size The size to round.
+ * @return The aligned size.
+ */
+static std::size_t	alignUp(std::size_t size)
+{
+	return ((size + Arena::alignment - 1) & ~(Arena::alignment - 1));
+}
+
+/**
+ * @brief Constructs an empty arena; chunks are allocated on first use.
+ */
+Arena::Arena() : _first(NULL), _current(NULL), _depth(0) {}
+
+/**
+ * @brief Destructor for Arena. Releases every chunk.
+ */
+Arena::~Arena()
+{
+	Chunk *chunk = this->_first;
+	while (chunk)
+	{
+		Chunk *next = chunk->next;
+		::operator delete(chunk);
+		chunk = next;
+	}
+}
+
+/**
+ * @brief Creates the thread-exit key for arenas.
+ */
+void	Arena::_createKey()
+{
+	pthread_key_create(&arenaKey, &Arena::_destroy);
+}
+
+/**
+ * @brief Thread-exit destructor for an arena.
+ *
+ * @param arena The arena to release.
+ */
+void	Arena::_destroy(void *arena)
+{
+	delete static_cast<Arena *>(arena);
+}
+
+/**
+ * @brief Gets the calling thread's arena, creating it on first use.
+ *
+ * @return Reference to the thread's arena.
+ */
+Arena	&Arena::local()
+{
+	if (!tlsArena)
+	{
+		pthread_once(&arenaKeyOnce, &Arena::_createKey);
+		tlsArena = new Arena();
+		pthread_setspecific(arenaKey, tlsArena);
+	}
+	return (*tlsArena);
+}
+
+/**
+ * @brief Checks whether a Scope is currently open on this arena.
+ *
+ * @return True if at least one Scope is active, false otherwise.
+ */
+bool	Arena::isActive() const
+{
+	return (this->_depth > 0);
+}
+
+/**
+ * @brief Allocates size bytes from the arena.
+ *
+ * Chunks retained from earlier scopes are reused before new ones are
+ * requested from the system.
+ *
+ * @param size Number of bytes to allocate.
+ * @return Pointer to the memory, aligned on Arena::alignment.
+ */
+void	*Arena::allocate(std::size_t size)
+{
+	size = alignUp(size ? size : 1);
+	if (!this->_current || this->_current->used + size > this->_current->size)
+		this->_grow(size);
+
+	void *ptr = this->_current->data + this->_current->used;
+	this->_current->used += size;
+	return (ptr);
+}
+
+/**
+ * @brief Returns memory to the arena.
+ *
+ * Only the most recent allocation is actually reclaimed, which covers the
+ * grow-and-release pattern of strings; anything else is released when the
+ * enclosing Scope ends.
+ *
+ * @param ptr The memory to release.
+ * @param size The size it was allocated with.
+ */
+void	Arena::deallocate(void *ptr, std::size_t size)
+{
+	size = alignUp(size ? size : 1);
+	if (this->_current && static_cast<char *>(ptr) + size == this->_current->data + this->_current->used)
+		this->_current->used -= size;
+}
+
+/**
+ * @brief Checks whether a pointer was allocated from this arena.
+ *
+ * @param ptr The pointer to check.
+ * @return True if the pointer lies in one of the arena's chunks.
+ */
+bool	Arena::owns(const void *ptr) const
+{
+	const char *p = static_cast<const char *>(ptr);
+	for (const Chunk *chunk = this->_first; chunk; chunk = chunk->next)
+	{
+		if (p >= chunk->data && p < chunk->data + chunk->size)
+			return (true);
+	}
+	return (false);
+}
+
+/**
+ * @brief Moves to a chunk that can hold size bytes, reusing retained chunks
+ * and appending a new one when none fits.
+ *
+ * @param size The aligned size the chunk must be able to hold.
+ */
+void	Arena::_grow(std::size_t size)
+{
+	Chunk *prev = this->_current;
+	Chunk *chunk = prev ? prev->next : this->_first;
+	while (chunk && chunk->size < size)
+	{
+		prev = chunk;
+		chunk = chunk->next;
+	}
+	if (!chunk)
+	{
+		std::size_t capacity = size > chunkSize ? size : chunkSize;
+		std::size_t header = alignUp(sizeof(Chunk));
+		chunk = static_cast<Chunk *>(::operator new(header + capacity));
+		chunk->next = NULL;
+		chunk->size = capacity;
+		chunk->data = reinterpret_cast<char *>(chunk) + header;
+		if (prev)
+			prev->next = chunk;
+		else
+			this->_first = chunk;
+	}
+	chunk->used = 0;
+	this->_current = chunk;
+}
+
+/**
+ * @brief Opens a scope on the calling thread's arena.
+ */
+Scope::Scope() : _arena(Arena::local()), _chunk(_arena._current), _used(_chunk ? _chunk->used : 0)
+{
+	++this->_arena._depth;
+}
+
+/**
+ * @brief Closes the scope, releasing everything allocated since it was opened.
+ */
+Scope::~Scope()
+{
+	--this->_arena._depth;
+	this->_arena._current = this->_chunk;
+	if (this->_chunk)
+		this->_chunk->used = this->_used;
+}
+
+/**
+ * @brief Number of power-of-two size classes served by the pool.
+ */
+static const std::size_t	poolClasses = 11;
+
+/**
+ * @brief Free block of the pool, linked through its own storage.
+ */
+struct FreeBlock
+{
+	FreeBlock	*next;
+};
+
+/**
+ * @brief Free lists of the pool, one per size class.
+ */
+static FreeBlock		*poolFree[poolClasses];
+
+/**
+ * @brief Lock protecting the pool free lists.
+ */
+static pthread_mutex_t	poolLock = PTHREAD_MUTEX_INITIALIZER;
+
+/**
+ * @brief Gets the size class serving a request.
+ *
+ * @param size The requested size, at most Pool::maxBlock.
+ * @return Index of the size class.
+ */
+static std::size_t	poolClass(std::size_t size)
+{
+	std::size_t cls = 0;
+	std::size_t block = Pool::minBlock;
+	while (block < size)
+	{
+		block <<= 1;
+		++cls;
+	}
+	return (cls);
+}
+
+/**
+ * @brief Allocates size bytes from the pool.
+ *
+ * @param size Number of bytes to allocate.
+ * @return Pointer to the memory.
+ */
+void	*Pool::allocate(std::size_t size)
+{
+	if (size > maxBlock)
+		return (::operator new(size));
+
+	std::size_t cls = poolClass(size);
+	pthread_mutex_lock(&poolLock);
+	FreeBlock *block = poolFree[cls];
+	if (block)
+		poolFree[cls] = block->next;
+	pthread_mutex_unlock(&poolLock);
+
+	if (block)
+		return (block);
+	return (::operator new(minBlock << cls));
+}
+
+/**
+ * @brief Returns memory to the pool.
+ *
+ * @param ptr The memory to release, may be NULL.
+ * @param size The size it was allocated with.
+ */
+void	Pool::deallocate(void *ptr, std::size_t size)
+{
+	if (!ptr)
+		return ;
+	if (size > maxBlock)
+	{
+		::operator delete(ptr);
+		return ;
+	}
+
+	std::size_t cls = poolClass(size);
+	FreeBlock *block = static_cast<FreeBlock *>(ptr);
+	pthread_mutex_lock(&poolLock);
+	block->next = poolFree[cls];
+	poolFree[cls] = block;
+	pthread_mutex_unlock(&poolLock);
+}
+
+} // !arena
+} // !log42
+
+/* ************************************************************************** */
+/*                                                                            */
+/*                                MIT License                                 */
+/*                                                                            */
+/*   Copyright (c) 2025 Demont Pieric, Lucken Bénédict                        */
+/*                                                                            */
+/*   Inspired by the Python 'logging' module by Vinay Sajip.                  */
+/*   This implementation was rewritten in C++98 and contains no original      */
+/*   Python source code.                                                      */
+/*                                                                            */
+/*   Permission is hereby granted, free of charge, to any person obtaining    */
+/*   a copy of this software and associated documentation files (the          */
+/*   "Software"), to deal in the Software without restriction, including      */
+/*   without limitation the rights to use, copy, modify, merge, publish,      */
+/*   distribute, sublicense, and/or sell copies of the Software, and to       */
+/*   permit persons to whom the Software is furnished to do so, subject to    */
+/*   the following conditions:                                                */
+/*                                                                            */
+/*   The above copyright notice and this permission notice shall be included  */
+/*   in all copies or substantial portions of the Software.                   */
+/*                                                                            */
+/*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS  */
+/*   OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF               */
+/*   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.   */
+/*   IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY     */
+/*   CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,     */
+/*   TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE        */
+/*   SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                   */
+/*                                                                            */
+/* ************************************************************************** */
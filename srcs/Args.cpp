@@ -0,0 +1,423 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   Args.cpp                                           :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: pdemont <pdemont@student.42lausanne.ch>    +#+  +:+       +#+        */
+/*   By: blucken <blucken@student.42lausanne.ch>  +#+#+#+#+#+   +#+           */
+/*                                                     #+#    #+#             */
+/*   Created: 2026/10/18                              ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+/**
+ * @file Args.cpp
+ * @brief Implements the Arg and Args classes.
+ */ 
+
+#include <log42/Args.hpp>
+#include <cstdio>
+#include <cstring>
+
+namespace log42
+{
+
+/**
+ * @brief Constructs an empty argument.
+ */
+Arg::Arg() : _type(NONE), _len(0) 
+{
+	this->_value.u = 0;
+}
+
+/**
+ * @brief Constructs an integer argument.
+ *
+ * @param value The value to capture.
+ */
+Arg::Arg(int value) : _type(INT), _len(sizeof(value))
+{
+	this->_value.i = value;
+}
+
+/**
+ * @brief Constructs an integer argument.
+ *
+ * @param value The value to capture.
+ */
+Arg::Arg(long value) : _type(INT), _len(sizeof(value))
+{
+	this->_value.i = value;
+}
+
+/**
+ * @brief Constructs an unsigned integer argument.
+ *
+ * @param value The value to capture.
+ */
+Arg::Arg(unsigned int value) : _type(UINT), _len(sizeof(value))
+{
+	this->_value.u = value;
+}
+
+/**
+ * @brief Constructs an unsigned integer argument.
+ *
+ * @param value The value to capture.
+ */
+Arg::Arg(unsigned long value) : _type(UINT), _len(sizeof(value))
+{
+	this->_value.u = value;
+}
+
+/**
+ * @brief Constructs a floating point argument.
+ *
+ * @param value The value to capture.
+ */
+Arg::Arg(double value) : _type(DOUBLE), _len(0)
+{
+	this->_value.d = value;
+}
+
+/**
+ * @brief Constructs a boolean argument.
+ *
+ * @param value The value to capture.
+ */
+Arg::Arg(bool value) : _type(BOOL), _len(0)
+{
+	this->_value.u = 0;
+	this->_value.b = value;
+}
+
+/**
+ * @brief Constructs a string argument over a NUL-terminated string.
+ *
+ * A NULL string is rendered as "(null)".
+ *
+ * @param value The string to borrow.
+ */
+Arg::Arg(const char *value) : _type(STRING), _len(0)
+{
+	if (!value)
+		value = "(null)";
+	this->_value.s = value;
+	this->_len = std::strlen(value);
+}
+
+/**
+ * @brief Constructs a string argument over a std::string.
+ *
+ * @param value The string to borrow.
+ */
+Arg::Arg(const std::string &value) : _type(STRING), _len(value.size())
+{
+	this->_value.s = value.data();
+}
+
+/**
+ * @brief Constructs a pointer argument.
+ *
+ * @param value The pointer to capture.
+ */
+Arg::Arg(const void *value) : _type(POINTER), _len(0)
+{
+	this->_value.p = value;
+}
+
+/**
+ * @brief Destructor for Arg.
+ */
+Arg::~Arg() {}
+
+/**
+ * @brief Copy constructor for Arg.
+ *
+ * @param rhs The Arg to copy.
+ */
+Arg::Arg(const Arg &rhs) : _type(rhs._type), _value(rhs._value), _len(rhs._len) {}
+
+/**
+ * @brief Assignment operator for Arg.
+ *
+ * @param rhs The Arg to assign from.
+ * @return Reference to this Arg.
+ */
+Arg	&Arg::operator=(const Arg &rhs)
+{
+	if (this != &rhs)
+	{
+		this->_type = rhs._type;
+		this->_value = rhs._value;
+		this->_len = rhs._len;
+	}
+	return (*this);
+}
+
+/**
+ * @brief Gets the kind of value held by the argument.
+ *
+ * @return The argument type.
+ */
+Arg::e_Type	Arg::getType() const
+{
+	return (this->_type);
+}
+
+/**
+ * @brief Gets the text of a string argument.
+ *
+ * @return The borrowed text, or an empty reference if the argument is not a
+ * string.
+ */
+StringRef	Arg::getString() const
+{
+	if (this->_type != STRING)
+		return (StringRef("", 0));
+	return (StringRef(this->_value.s, this->_len));
+}
+
+/**
+ * @brief Gets the number of bytes encode() writes for this argument.
+ *
+ * @return The encoded size in bytes.
+ */
+std::size_t	Arg::encodedSize() const
+{
+	if (this->_type == STRING)
+		return (1 + sizeof(unsigned int) + this->_len);
+	return (2 + sizeof(this->_value));
+}
+
+/**
+ * @brief Serializes the argument: a type tag followed by the width the
+ * value was captured with and the value, or by the length and bytes of a
+ * string, which is copied so that the encoded form no longer depends on the
+ * caller's storage.
+ *
+ * @param dst Destination of at least encodedSize() bytes.
+ * @return Pointer past the last byte written.
+ */
+char	*Arg::encode(char *dst) const
+{
+	*dst++ = static_cast<char>(this->_type);
+	if (this->_type != STRING)
+	{
+		*dst++ = static_cast<char>(this->_len);
+		std::memcpy(dst, &this->_value, sizeof(this->_value));
+		return (dst + sizeof(this->_value));
+	}
+	unsigned int len = this->_len;
+	std::memcpy(dst, &len, sizeof(len));
+	dst += sizeof(len);
+	std::memcpy(dst, this->_value.s, len);
+	return (dst + len);
+}
+
+/**
+ * @brief Deserializes an argument written by encode(). A decoded string
+ * borrows the encoded bytes.
+ *
+ * @param src Start of the encoded argument.
+ * @param arg Receives the decoded argument.
+ * @return Pointer past the encoded argument.
+ */
+const char	*Arg::decode(const char *src, Arg &arg)
+{
+	arg._type = static_cast<e_Type>(*src++);
+	if (arg._type != STRING)
+	{
+		arg._len = static_cast<unsigned char>(*src++);
+		std::memcpy(&arg._value, src, sizeof(arg._value));
+		return (src + sizeof(arg._value));
+	}
+	unsigned int len;
+	std::memcpy(&len, src, sizeof(len));
+	src += sizeof(len);
+	arg._value.s = src;
+	arg._len = len;
+	return (src + len);
+}
+
+/**
+ * @brief Appends the argument as text, following a printf-like conversion.
+ *
+ * 'd' renders numbers as integers, 'f' as fixed-point, 'x' as hexadecimal
+ * and 's' in their natural form; a negative int is printed in hexadecimal
+ * on the width of an int, as printf does. Booleans are "true" or "false" under 's'
+ * and 1 or 0 otherwise. Strings are always appended verbatim and pointers in
+ * their implementation-defined %p form.
+ *
+ * @param out The buffer to append to.
+ * @param conversion One of 'd', 'f', 'x' or 's'.
+ */
+void	Arg::append(arena::t_string &out, char conversion) const
+{
+	char buffer[64];
+	int len = 0;
+
+	switch (this->_type)
+	{
+		case STRING:
+			out.append(this->_value.s, this->_len);
+			return ;
+		case POINTER:
+			len = std::snprintf(buffer, sizeof(buffer), "%p", this->_value.p);
+			break ;
+		case BOOL:
+			if (conversion == 's')
+				out.append(this->_value.b ? "true" : "false");
+			else if (conversion == 'f')
+				out.append(this->_value.b ? "1.000000" : "0.000000");
+			else
+				out.push_back(this->_value.b ? '1' : '0');
+			return ;
+		case INT:
+			if (conversion == 'f')
+				len = std::snprintf(buffer, sizeof(buffer), "%f", static_cast<double>(this->_value.i));
+			else if (conversion == 'x' && this->_len == sizeof(int))
+				len = std::snprintf(buffer, sizeof(buffer), "%x", static_cast<unsigned int>(this->_value.i));
+			else if (conversion == 'x')
+				len = std::snprintf(buffer, sizeof(buffer), "%lx", static_cast<unsigned long>(this->_value.i));
+			else
+				len = std::snprintf(buffer, sizeof(buffer), "%ld", this->_value.i);
+			break ;
+		case UINT:
+			if (conversion == 'f')
+				len = std::snprintf(buffer, sizeof(buffer), "%f", static_cast<double>(this->_value.u));
+			else if (conversion == 'x')
+				len = std::snprintf(buffer, sizeof(buffer), "%lx", this->_value.u);
+			else
+				len = std::snprintf(buffer, sizeof(buffer), "%lu", this->_value.u);
+			break ;
+		case DOUBLE:
+			if (conversion == 'd')
+				len = std::snprintf(buffer, sizeof(buffer), "%ld", static_cast<long>(this->_value.d));
+			else if (conversion == 'f')
+				len = std::snprintf(buffer, sizeof(buffer), "%f", this->_value.d);
+			else
+				len = std::snprintf(buffer, sizeof(buffer), "%g", this->_value.d);
+			break ;
+		default:
+			return ;
+	}
+	if (len > 0)
+		out.append(buffer, static_cast<std::size_t>(len) < sizeof(buffer) ? len : sizeof(buffer) - 1);
+}
+
+/**
+ * @brief Constructs an argument pack from up to maxArgs arguments. The pack
+ * ends at the first empty argument.
+ *
+ * @param a0 First argument.
+ * @param a1 Second argument.
+ * @param a2 Third argument.
+ * @param a3 Fourth argument.
+ * @param a4 Fifth argument.
+ * @param a5 Sixth argument.
+ * @param a6 Seventh argument.
+ * @param a7 Eighth argument.
+ */
+Args::Args(const Arg &a0, const Arg &a1, const Arg &a2, const Arg &a3,
+			const Arg &a4, const Arg &a5, const Arg &a6, const Arg &a7) 
+	: _size(0), _legacy(NULL)
+{
+	const Arg *args[maxArgs] = { &a0, &a1, &a2, &a3, &a4, &a5, &a6, &a7 };
+
+	while (this->_size < maxArgs && args[this->_size]->getType() != Arg::NONE)
+	{
+		this->_args[this->_size] = *args[this->_size];
+		++this->_size;
+	}
+}
+
+/**
+ * @brief Destructor for Args.
+ */
+Args::~Args() {}
+
+/**
+ * @brief Copy constructor for Args.
+ *
+ * @param rhs The Args to copy.
+ */
+Args::Args(const Args &rhs) : _size(rhs._size), _legacy(rhs._legacy)
+{
+	for (std::size_t i = 0; i < rhs._size && !rhs._legacy; ++i)
+		this->_args[i] = rhs._args[i];
+}
+
+/**
+ * @brief Assignment operator for Args.
+ *
+ * @param rhs The Args to assign from.
+ * @return Reference to this Args.
+ */
+Args	&Args::operator=(const Args &rhs)
+{
+	if (this != &rhs)
+	{
+		this->_size = rhs._size;
+		this->_legacy = rhs._legacy;
+		for (std::size_t i = 0; i < rhs._size && !rhs._legacy; ++i)
+			this->_args[i] = rhs._args[i];
+	}
+	return (*this);
+}
+
+/**
+ * @brief Gets the number of arguments.
+ *
+ * @return The number of arguments.
+ */
+std::size_t	Args::size() const
+{
+	return (this->_size);
+}
+
+/**
+ * @brief Gets an argument.
+ *
+ * @param index Position of the argument, lower than size().
+ * @return The argument.
+ */
+Arg	Args::operator[](std::size_t index) const
+{
+	if (this->_legacy)
+		return (Arg((*this->_legacy)[index]));
+	return (this->_args[index]);
+}
+
+} // !log42
+
+/* ************************************************************************** */
+/*                                                                            */
+/*                                MIT License                                 */
+/*                                                                            */
+/*   Copyright (c) 2025 Demont Pieric, Lucken Bénédict                        */
+/*                                                                            */
+/*   Inspired by the Python 'logging' module by Vinay Sajip.                  */
+/*   This implementation was rewritten in C++98 and contains no original      */
+/*   Python source code.                                                      */
+/*                                                                            */
+/*   Permission is hereby granted, free of charge, to any person obtaining    */
+/*   a copy of this software and associated documentation files (the          */
+/*   "Software"), to deal in the Software without restriction, including      */
+/*   without limitation the rights to use, copy, modify, merge, publish,      */
+/*   distribute, sublicense, and/or sell copies of the Software, and to       */
+/*   permit persons to whom the Software is furnished to do so, subject to    */
+/*   the following conditions:                                                */
+/*                                                                            */
+/*   The above copyright notice and this permission notice shall be included  */
+/*   in all copies or substantial portions of the Software.                   */
+/*                                                                            */
+/*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS  */
+/*   OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF               */
+/*   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.   */
+/*   IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY     */
+/*   CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,     */
+/*   TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE        */
+/*   SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                   */
+/*                                                                            */
+/* ************************************************************************** */
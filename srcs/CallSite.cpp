@@ -0,0 +1,276 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   CallSite.cpp                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: pdemont <pdemont@student.42lausanne.ch>    +#+  +:+       +#+        */
+/*   By: blucken <blucken@student.42lausanne.ch>  +#+#+#+#+#+   +#+           */
+/*                                                     #+#    #+#             */
+/*   Created: 2026/10/18                              ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+/**
+ * @file CallSite.cpp
+ * @brief Implements the CallSite class and its process-wide registry.
+ */ 
+
+#include <common/common.hpp>
+#include <log42/CallSite.hpp>
+#include <log42/Sync.hpp>
+#include <cstring>
+#include <map>
+
+using namespace common::core;
+
+namespace log42
+{
+namespace logRecord
+{
+
+namespace
+{
+
+/**
+ * @brief Registry key borrowing the strings of the call site it identifies.
+ */
+struct SiteKey
+{
+	const char	*pathname;
+	int			lineNo;
+	const char	*funcName;
+
+	bool	operator<(const SiteKey &rhs) const
+	{
+		if (this->lineNo != rhs.lineNo)
+			return (this->lineNo < rhs.lineNo);
+		int cmp = std::strcmp(this->pathname, rhs.pathname);
+		if (cmp != 0)
+			return (cmp < 0);
+		return (std::strcmp(this->funcName, rhs.funcName) < 0);
+	}
+};
+
+typedef std::map<SiteKey, const CallSite *> t_sites;
+
+/**
+ * @brief Gets the registry of interned call sites.
+ *
+ * @return Reference to the registry.
+ */
+t_sites	&sites()
+{
+	static t_sites registry;
+
+	return (registry);
+}
+
+/**
+ * @brief Gets the lock serializing the registry.
+ *
+ * @return Reference to the lock.
+ */
+sync::Mutex	&registryLock()
+{
+	static sync::Mutex lock;
+
+	return (lock);
+}
+
+/**
+ * @brief Number of entries of the per-thread call site cache.
+ */
+const std::size_t	cacheSize = 256;
+
+/**
+ * @brief Per-thread, direct-mapped cache in front of the registry, so that a
+ * known call site is found without taking the registry lock.
+ */
+__thread const CallSite	*siteCache[cacheSize];
+
+/**
+ * @brief Picks the cache entry of a source location.
+ *
+ * @param pathname Source file path.
+ * @param lineNo Line number in the source file.
+ * @return The entry index.
+ */
+std::size_t	cacheSlot(const char *pathname, int lineNo)
+{
+	std::size_t hash = reinterpret_cast<std::size_t>(pathname) >> 3;
+	hash ^= static_cast<std::size_t>(lineNo) * 2654435761UL;
+	return ((hash ^ (hash >> 8)) & (cacheSize - 1));
+}
+
+} // !namespace
+
+/**
+ * @brief Constructs a CallSite and derives its filename and module.
+ *
+ * @param pathname Source file path.
+ * @param lineNo Line number in the source file.
+ * @param funcName Function name.
+ */
+CallSite::CallSite(const char *pathname, int lineNo, const char *funcName)
+	: _pathname(pathname),
+	_filename(utils::filenameNoPath(this->_pathname)),
+	_module(utils::filenameNoExt(this->_filename, ".cpp")),
+	_funcName(funcName),
+	_lineNo(lineNo),
+	_template(NULL) {}
+
+/**
+ * @brief Destructor for CallSite.
+ */
+CallSite::~CallSite() {}
+
+/**
+ * @brief Returns the interned call site for a source location, creating it on
+ * first use.
+ *
+ * The lookup borrows the given strings and allocates nothing once the call
+ * site is known. Each thread first checks its own cache, comparing contents
+ * rather than addresses, and only takes the registry lock on a miss.
+ *
+ * @param pathname Source file path.
+ * @param lineNo Line number in the source file.
+ * @param funcName Function name.
+ * @return Pointer to the interned call site.
+ */
+const CallSite	*CallSite::get(const char *pathname, int lineNo, const char *funcName)
+{
+	SiteKey key;
+	key.pathname = pathname ? pathname : "";
+	key.lineNo = lineNo;
+	key.funcName = funcName ? funcName : "";
+
+	const CallSite *&cached = siteCache[cacheSlot(key.pathname, lineNo)];
+	if (cached && cached->_lineNo == lineNo 
+		&& std::strcmp(cached->_pathname.c_str(), key.pathname) == 0 
+		&& std::strcmp(cached->_funcName.c_str(), key.funcName) == 0)
+		return (cached);
+
+	sync::ScopedLock lock(registryLock());
+	t_sites &registry = sites();
+	t_sites::const_iterator it = registry.find(key);
+	if (it != registry.end())
+	{
+		cached = it->second;
+		return (it->second);
+	}
+
+	CallSite *site = new CallSite(key.pathname, lineNo, key.funcName);
+	key.pathname = site->_pathname.c_str();
+	key.funcName = site->_funcName.c_str();
+	registry[key] = site;
+	cached = site;
+	return (site);
+}
+
+/**
+ * @brief Gets the source file path.
+ *
+ * @return Pathname.
+ */
+const char	*CallSite::getPathname() const
+{
+	return (this->_pathname.c_str());
+}
+
+/**
+ * @brief Gets the source file name.
+ *
+ * @return Filename.
+ */
+const char	*CallSite::getFilename() const
+{
+	return (this->_filename.c_str());
+}
+
+/**
+ * @brief Gets the module name.
+ *
+ * @return Module name.
+ */
+const char	*CallSite::getModule() const
+{
+	return (this->_module.c_str());
+}
+
+/**
+ * @brief Gets the function name.
+ *
+ * @return Function name.
+ */
+const char	*CallSite::getFuncName() const
+{
+	return (this->_funcName.c_str());
+}
+
+/**
+ * @brief Gets the line number in the source file.
+ *
+ * @return Line number.
+ */
+const int	&CallSite::getLineNo() const
+{
+	return (this->_lineNo);
+}
+
+/**
+ * @brief Gets the parsed template of a message logged from this call site.
+ *
+ * The template is built from the first message logged here and published
+ * with a compare-and-swap, so concurrent first calls at worst parse the
+ * message twice.
+ *
+ * @param msg The message being logged.
+ * @return The template, or NULL if this call site logs another message,
+ * which is then rendered with MessageTemplate::renderText().
+ */
+const MessageTemplate	*CallSite::getTemplate(const StringRef &msg) const
+{
+	const MessageTemplate *current = sync::load(this->_template);
+	if (!current)
+	{
+		MessageTemplate *created = new MessageTemplate(msg);
+		if (!sync::compareAndSwap(this->_template, static_cast<const MessageTemplate *>(NULL), static_cast<const MessageTemplate *>(created)))
+			delete created;
+		current = sync::load(this->_template);
+	}
+	return (current->matches(msg) ? current : NULL);
+}
+
+} // !logRecord
+} // !log42
+
+/* ************************************************************************** */
+/*                                                                            */
+/*                                MIT License                                 */
+/*                                                                            */
+/*   Copyright (c) 2025 Demont Pieric, Lucken Bénédict                        */
+/*                                                                            */
+/*   Inspired by the Python 'logging' module by Vinay Sajip.                  */
+/*   This implementation was rewritten in C++98 and contains no original      */
+/*   Python source code.                                                      */
+/*                                                                            */
+/*   Permission is hereby granted, free of charge, to any person obtaining    */
+/*   a copy of this software and associated documentation files (the          */
+/*   "Software"), to deal in the Software without restriction, including      */
+/*   without limitation the rights to use, copy, modify, merge, publish,      */
+/*   distribute, sublicense, and/or sell copies of the Software, and to       */
+/*   permit persons to whom the Software is furnished to do so, subject to    */
+/*   the following conditions:                                                */
+/*                                                                            */
+/*   The above copyright notice and this permission notice shall be included  */
+/*   in all copies or substantial portions of the Software.                   */
+/*                                                                            */
+/*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS  */
+/*   OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF               */
+/*   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.   */
+/*   IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY     */
+/*   CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,     */
+/*   TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE        */
+/*   SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                   */
+/*                                                                            */
+/* ************************************************************************** */
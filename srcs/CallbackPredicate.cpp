@@ -0,0 +1,106 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   CallbackPredicate.cpp                              :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: pdemont <pdemont@student.42lausanne.ch>    +#+  +:+       +#+        */
+/*   By: blucken <blucken@student.42lausanne.ch>  +#+#+#+#+#+   +#+           */
+/*                                                     #+#    #+#             */
+/*   Created: 2026/10/18                              ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+/**
+ * @file CallbackPredicate.cpp
+ * @brief Implements the CallbackPredicate class.
+ */ 
+
+#include <log42/CallbackPredicate.hpp>
+
+namespace log42
+{
+namespace filter
+{
+
+/**
+ * @brief Constructs a CallbackPredicate.
+ *
+ * @param callback The decision function.
+ * @param context Pointer passed back to the function.
+ * @param cost Estimated cost of a call, in rough nanoseconds.
+ * @param isStatic True if the function only reads the record's level and
+ * call site.
+ */
+CallbackPredicate::CallbackPredicate(t_callback callback, void *context, const unsigned int cost, const bool isStatic)
+	: Predicate(), _callback(callback), _context(context), _cost(cost), _static(isStatic) {}
+
+/**
+ * @brief Destructor for CallbackPredicate.
+ */
+CallbackPredicate::~CallbackPredicate() {}
+
+/**
+ * @brief Calls the function on a record.
+ *
+ * @param record The log record to check.
+ * @param owner The filterer applying the predicate.
+ * @return The function's decision.
+ */
+bool	CallbackPredicate::test(const logRecord::LogRecord &record, filterer::Filterer &owner) const
+{
+	(void)owner;
+	return (this->_callback(record, this->_context));
+}
+
+/**
+ * @brief Gets the estimated cost of a call.
+ *
+ * @return The cost given at construction.
+ */
+unsigned int	CallbackPredicate::getCost() const
+{
+	return (this->_cost);
+}
+
+/**
+ * @brief Tells whether the decision only depends on the level and call site.
+ *
+ * @return The staticness given at construction.
+ */
+bool	CallbackPredicate::isStatic() const
+{
+	return (this->_static);
+}
+
+} // !filter
+} // !log42
+
+/* ************************************************************************** */
+/*                                                                            */
+/*                                MIT License                                 */
+/*                                                                            */
+/*   Copyright (c) 2025 Demont Pieric, Lucken Bénédict                        */
+/*                                                                            */
+/*   Inspired by the Python 'logging' module by Vinay Sajip.                  */
+/*   This implementation was rewritten in C++98 and contains no original      */
+/*   Python source code.                                                      */
+/*                                                                            */
+/*   Permission is hereby granted, free of charge, to any person obtaining    */
+/*   a copy of this software and associated documentation files (the          */
+/*   "Software"), to deal in the Software without restriction, including      */
+/*   without limitation the rights to use, copy, modify, merge, publish,      */
+/*   distribute, sublicense, and/or sell copies of the Software, and to       */
+/*   permit persons to whom the Software is furnished to do so, subject to    */
+/*   the following conditions:                                                */
+/*                                                                            */
+/*   The above copyright notice and this permission notice shall be included  */
+/*   in all copies or substantial portions of the Software.                   */
+/*                                                                            */
+/*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS  */
+/*   OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF               */
+/*   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.   */
+/*   IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY     */
+/*   CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,     */
+/*   TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE        */
+/*   SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                   */
+/*                                                                            */
+/* ************************************************************************** */
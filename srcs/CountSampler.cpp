@@ -0,0 +1,104 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   CountSampler.cpp                                   :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: pdemont <pdemont@student.42lausanne.ch>    +#+  +:+       +#+        */
+/*   By: blucken <blucken@student.42lausanne.ch>  +#+#+#+#+#+   +#+           */
+/*                                                     #+#    #+#             */
+/*   Created: 2026/10/18                              ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+/**
+ * @file CountSampler.cpp
+ * @brief Implements the CountSampler.
+ */ 
+
+#include <log42/CountSampler.hpp>
+#include <log42/Sync.hpp>
+
+namespace log42
+{
+namespace filter
+{
+
+/**
+ * @brief Constructs a CountSampler.
+ *
+ * @param every Keeps one record in this many; 0 and 1 keep them all.
+ * @param capacity Number of counters, rounded up to a power of two.
+ */
+CountSampler::CountSampler(const unsigned long every, const std::size_t capacity)
+	: Sampler(), _every(every ? every : 1), _counts(NULL), _mask(0)
+{
+	std::size_t size = 1;
+	while (size < capacity)
+		size <<= 1;
+	this->_counts = new unsigned long[size]();
+	this->_mask = size - 1;
+}
+
+/**
+ * @brief Destructor for CountSampler.
+ */
+CountSampler::~CountSampler()
+{
+	delete[] this->_counts;
+}
+
+/**
+ * @brief Gets the estimated cost of a decision.
+ *
+ * @return 10: an atomic increment.
+ */
+unsigned int	CountSampler::getCost() const
+{
+	return (10);
+}
+
+/**
+ * @brief Counts a record of a call site.
+ *
+ * @param site The call site of the record.
+ * @return True for the first record of the site and every N-th after it.
+ */
+bool	CountSampler::_sample(const logRecord::CallSite *site) const
+{
+	unsigned long hash = reinterpret_cast<unsigned long>(site) * 2654435761UL;
+	unsigned long &count = this->_counts[(hash ^ (hash >> 16)) & this->_mask];
+	return (sync::fetchAdd(count, 1UL) % this->_every == 0);
+}
+
+} // !filter
+} // !log42
+
+/* ************************************************************************** */
+/*                                                                            */
+/*                                MIT License                                 */
+/*                                                                            */
+/*   Copyright (c) 2025 Demont Pieric, Lucken Bénédict                        */
+/*                                                                            */
+/*   Inspired by the Python 'logging' module by Vinay Sajip.                  */
+/*   This implementation was rewritten in C++98 and contains no original      */
+/*   Python source code.                                                      */
+/*                                                                            */
+/*   Permission is hereby granted, free of charge, to any person obtaining    */
+/*   a copy of this software and associated documentation files (the          */
+/*   "Software"), to deal in the Software without restriction, including      */
+/*   without limitation the rights to use, copy, modify, merge, publish,      */
+/*   distribute, sublicense, and/or sell copies of the Software, and to       */
+/*   permit persons to whom the Software is furnished to do so, subject to    */
+/*   the following conditions:                                                */
+/*                                                                            */
+/*   The above copyright notice and this permission notice shall be included  */
+/*   in all copies or substantial portions of the Software.                   */
+/*                                                                            */
+/*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS  */
+/*   OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF               */
+/*   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.   */
+/*   IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY     */
+/*   CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,     */
+/*   TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE        */
+/*   SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                   */
+/*                                                                            */
+/* ************************************************************************** */
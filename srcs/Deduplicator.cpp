@@ -0,0 +1,297 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   Deduplicator.cpp                                   :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: pdemont <pdemont@student.42lausanne.ch>    +#+  +:+       +#+        */
+/*   By: blucken <blucken@student.42lausanne.ch>  +#+#+#+#+#+   +#+           */
+/*                                                     #+#    #+#             */
+/*   Created: 2026/10/18                              ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+/**
+ * @file Deduplicator.cpp
+ * @brief Implements the Deduplicator predicate.
+ */ 
+
+#include <log42/Deduplicator.hpp>
+#include <log42/Sync.hpp>
+#include <cstdio>
+#include <cstring>
+#include <ctime>
+
+namespace log42
+{
+namespace filter
+{
+
+namespace
+{
+
+/**
+ * @brief Hashes the logger name of a record.
+ *
+ * @param record The log record.
+ * @return The hash, never null.
+ */
+unsigned long	hashName(const logRecord::LogRecord &record)
+{
+	unsigned long hash = 14695981039346656037UL;
+	for (const char *name = record.getName(); *name; ++name)
+		hash = (hash ^ static_cast<unsigned char>(*name)) * 1099511628211UL;
+	return (hash ? hash : 1);
+}
+
+/**
+ * @brief Hashes the logger name, level and rendered message of a record.
+ *
+ * @param record The log record.
+ * @param name The hash of its logger name.
+ * @return The hash, never null.
+ */
+unsigned long	hashRecord(const logRecord::LogRecord &record, const unsigned long name)
+{
+	unsigned long hash = (name ^ static_cast<unsigned long>(record.getLevelNo())) * 1099511628211UL;
+
+	StringRef message = record.getMessageRef();
+	for (std::size_t i = 0; i < message.size(); ++i)
+		hash = (hash ^ static_cast<unsigned char>(message.data()[i])) * 1099511628211UL;
+	return (hash ? hash : 1);
+}
+
+/**
+ * @brief Maps a hash to a table index.
+ *
+ * @param hash The hash.
+ * @param mask The table size minus one.
+ * @return The index.
+ */
+std::size_t	indexOf(const unsigned long hash, const std::size_t mask)
+{
+	return ((hash ^ (hash >> 32)) & mask);
+}
+
+/**
+ * @brief Copies a text into a fixed buffer, cutting it with "..." if it
+ * does not fit.
+ *
+ * @param out The buffer.
+ * @param capacity The size of the buffer, terminator included.
+ * @param text The text.
+ */
+void	copyText(char *out, const std::size_t capacity, const StringRef &text)
+{
+	std::size_t size = text.size();
+	if (size < capacity)
+	{
+		std::memcpy(out, text.data(), size);
+		out[size] = '\0';
+		return ;
+	}
+	std::memcpy(out, text.data(), capacity - 4);
+	std::memcpy(out + capacity - 4, "...", 4);
+}
+
+/**
+ * @brief Formats a creation time as local "HH:MM:SS,mmm".
+ *
+ * @param millis The time in milliseconds since the epoch.
+ * @return The formatted time.
+ */
+std::string	formatStamp(const long millis)
+{
+	std::time_t seconds = millis / 1000;
+	struct std::tm tm;
+	char buffer[32];
+
+	localtime_r(&seconds, &tm);
+	std::size_t len = std::strftime(buffer, sizeof(buffer), "%H:%M:%S", &tm);
+	std::sprintf(buffer + len, ",%03ld", millis % 1000);
+	return (buffer);
+}
+
+} // !namespace
+
+/**
+ * @brief Constructs a Deduplicator.
+ *
+ * @param window Seconds during which repeats of a message are collapsed.
+ * @param capacity Number of slots, rounded up to a power of two.
+ */
+Deduplicator::Deduplicator(const double window, const std::size_t capacity)
+	: Predicate(), _window(static_cast<long>(window * 1000)), _slots(NULL), _lasts(NULL), _mask(0), _collapsed(0)
+{
+	std::size_t size = 1;
+	while (size < capacity)
+		size <<= 1;
+	this->_slots = new Slot[size]();
+	this->_lasts = new Last[size]();
+	this->_mask = size - 1;
+}
+
+/**
+ * @brief Destructor for Deduplicator.
+ */
+Deduplicator::~Deduplicator()
+{
+	delete[] this->_slots;
+	delete[] this->_lasts;
+}
+
+/**
+ * @brief Passes the first occurrence of a message in its window and drops
+ * the repeats, reporting the run the record ends, if any.
+ *
+ * @param record The log record to check.
+ * @param owner The filterer applying the predicate.
+ * @return True if the record passes, false if it repeats one that did.
+ */
+bool	Deduplicator::test(const logRecord::LogRecord &record, filterer::Filterer &owner) const
+{
+	if (Predicate::_isSummary())
+		return (true);
+
+	const unsigned long name = hashName(record);
+	const unsigned long hash = hashRecord(record, name);
+	const long now = static_cast<long>(record.getCreated()) * 1000 + record.getMsecs();
+
+	unsigned long previous = 0;
+	{
+		Last *last = &this->_lasts[indexOf(name, this->_mask)];
+		sync::ScopedLock lock(sync::stripeLock(last));
+		if (last->logger == name && last->hash != hash)
+			previous = last->hash;
+		last->logger = name;
+		last->hash = hash;
+	}
+	if (previous)
+		this->_flush(previous, owner);
+
+	Slot *slot = &this->_slots[indexOf(hash, this->_mask)];
+	Slot run;
+	run.repeats = 0;
+	{
+		sync::ScopedLock lock(sync::stripeLock(slot));
+		if (slot->hash == hash && now - slot->first < this->_window)
+		{
+			++slot->repeats;
+			slot->last = now;
+			sync::fetchAdd(this->_collapsed, 1UL);
+			return (false);
+		}
+		if (slot->repeats)
+			run = *slot;
+		slot->hash = hash;
+		slot->first = now;
+		slot->last = now;
+		slot->repeats = 0;
+		slot->level = record.getLevelNo();
+		slot->site = record.getCallSite();
+		copyText(slot->name, sizeof(slot->name), record.getName());
+		copyText(slot->message, sizeof(slot->message), record.getMessageRef());
+	}
+	if (run.repeats)
+		this->_report(run, owner);
+	return (true);
+}
+
+/**
+ * @brief Gets the estimated cost of a test.
+ *
+ * @return 120: rendering and hashing the message, and a lock.
+ */
+unsigned int	Deduplicator::getCost() const
+{
+	return (120);
+}
+
+/**
+ * @brief Tells whether the decision only depends on the level and call site.
+ *
+ * @return False: it depends on the message and time.
+ */
+bool	Deduplicator::isStatic() const
+{
+	return (false);
+}
+
+/**
+ * @brief Gets the number of repeats dropped so far.
+ *
+ * @return The number of records collapsed by every slot.
+ */
+unsigned long	Deduplicator::getCollapsed() const
+{
+	return (sync::load(this->_collapsed));
+}
+
+/**
+ * @brief Ends the run of a message its logger moved on from, reporting it
+ * if it dropped repeats.
+ *
+ * @param hash The hash of the message.
+ * @param owner The filterer applying the predicate.
+ */
+void	Deduplicator::_flush(const unsigned long hash, filterer::Filterer &owner) const
+{
+	Slot *slot = &this->_slots[indexOf(hash, this->_mask)];
+	Slot run;
+	run.repeats = 0;
+	{
+		sync::ScopedLock lock(sync::stripeLock(slot));
+		if (slot->hash != hash)
+			return ;
+		if (slot->repeats)
+			run = *slot;
+		slot->hash = 0;
+		slot->repeats = 0;
+	}
+	if (run.repeats)
+		this->_report(run, owner);
+}
+
+/**
+ * @brief Logs how many times a message was repeated in a finished run.
+ *
+ * @param run The finished run of the message.
+ * @param owner The filterer applying the predicate.
+ */
+void	Deduplicator::_report(const Slot &run, filterer::Filterer &owner) const
+{
+	Predicate::_summarize(run.name, run.level, run.site, "message repeated %d times between %s and %s: %s",
+		Args(run.repeats, formatStamp(run.first), formatStamp(run.last), run.message), owner);
+}
+
+} // !filter
+} // !log42
+
+/* ************************************************************************** */
+/*                                                                            */
+/*                                MIT License                                 */
+/*                                                                            */
+/*   Copyright (c) 2025 Demont Pieric, Lucken Bénédict                        */
+/*                                                                            */
+/*   Inspired by the Python 'logging' module by Vinay Sajip.                  */
+/*   This implementation was rewritten in C++98 and contains no original      */
+/*   Python source code.                                                      */
+/*                                                                            */
+/*   Permission is hereby granted, free of charge, to any person obtaining    */
+/*   a copy of this software and associated documentation files (the          */
+/*   "Software"), to deal in the Software without restriction, including      */
+/*   without limitation the rights to use, copy, modify, merge, publish,      */
+/*   distribute, sublicense, and/or sell copies of the Software, and to       */
+/*   permit persons to whom the Software is furnished to do so, subject to    */
+/*   the following conditions:                                                */
+/*                                                                            */
+/*   The above copyright notice and this permission notice shall be included  */
+/*   in all copies or substantial portions of the Software.                   */
+/*                                                                            */
+/*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS  */
+/*   OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF               */
+/*   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.   */
+/*   IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY     */
+/*   CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,     */
+/*   TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE        */
+/*   SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                   */
+/*                                                                            */
+/* ************************************************************************** */
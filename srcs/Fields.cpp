@@ -0,0 +1,237 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   Fields.cpp                                         :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: pdemont <pdemont@student.42lausanne.ch>    +#+  +:+       +#+        */
+/*   By: blucken <blucken@student.42lausanne.ch>  +#+#+#+#+#+   +#+           */
+/*                                                     #+#    #+#             */
+/*   Created: 2026/10/18                              ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+/**
+ * @file Fields.cpp
+ * @brief Implements the Fields class.
+ */ 
+
+#include <log42/Fields.hpp>
+#include <cstring>
+
+namespace log42
+{
+
+/**
+ * @brief Constructs an empty set of fields.
+ */
+Fields::Fields() : _size(0), _encoded(""), _encodedCount(0) {}
+
+/**
+ * @brief Destructor for Fields.
+ */
+Fields::~Fields() {}
+
+/**
+ * @brief Copy constructor for Fields.
+ *
+ * @param rhs The Fields to copy.
+ */
+Fields::Fields(const Fields &rhs) 
+	: _size(rhs._size), _encoded(rhs._encoded), _encodedCount(rhs._encodedCount)
+{
+	for (std::size_t i = 0; i < this->_size; ++i)
+		this->_entries[i] = rhs._entries[i];
+}
+
+/**
+ * @brief Assignment operator for Fields.
+ *
+ * @param rhs The Fields to assign from.
+ * @return Reference to this Fields.
+ */
+Fields	&Fields::operator=(const Fields &rhs)
+{
+	if (this != &rhs)
+	{
+		this->_size = rhs._size;
+		for (std::size_t i = 0; i < this->_size; ++i)
+			this->_entries[i] = rhs._entries[i];
+		this->_encoded = rhs._encoded;
+		this->_encodedCount = rhs._encodedCount;
+	}
+	return (*this);
+}
+
+/**
+ * @brief Adds a field. The key and a string value are borrowed and must
+ * outlive the logging call; fields beyond maxFields are dropped.
+ *
+ * @param key The name of the field.
+ * @param value The value of the field.
+ * @return Reference to this Fields, for chaining.
+ */
+Fields	&Fields::add(const StringRef &key, const Arg &value)
+{
+	if (this->_size < maxFields)
+	{
+		Entry &entry = this->_entries[this->_size++];
+		entry.key = key.data();
+		entry.keyLen = key.size();
+		entry.value = value;
+	}
+	return (*this);
+}
+
+/**
+ * @brief Appends fields that are already encoded, such as those of a
+ * logger. They come after the added fields, which therefore win a lookup.
+ *
+ * @param encoded The encoded fields, borrowed.
+ * @param count The number of fields in encoded.
+ * @return Reference to this Fields, for chaining.
+ */
+Fields	&Fields::extend(const StringRef &encoded, std::size_t count)
+{
+	this->_encoded = encoded;
+	this->_encodedCount = count;
+	return (*this);
+}
+
+/**
+ * @brief Gets the number of fields, added and extended.
+ *
+ * @return The number of fields.
+ */
+std::size_t	Fields::size() const
+{
+	return (this->_size + this->_encodedCount);
+}
+
+/**
+ * @brief Gets the number of bytes encode() writes.
+ *
+ * @return The encoded size in bytes.
+ */
+std::size_t	Fields::encodedSize() const
+{
+	std::size_t size = this->_encoded.size();
+	for (std::size_t i = 0; i < this->_size; ++i)
+		size += this->_entries[i].keyLen + 1 + this->_entries[i].value.encodedSize();
+	return (size);
+}
+
+/**
+ * @brief Serializes the added fields, then copies the extended ones.
+ *
+ * @param dst Destination of at least encodedSize() bytes.
+ * @return Pointer past the last byte written.
+ */
+char	*Fields::encode(char *dst) const
+{
+	for (std::size_t i = 0; i < this->_size; ++i)
+	{
+		const Entry &entry = this->_entries[i];
+		dst = encode(dst, StringRef(entry.key, entry.keyLen), entry.value);
+	}
+	std::memcpy(dst, this->_encoded.data(), this->_encoded.size());
+	return (dst + this->_encoded.size());
+}
+
+/**
+ * @brief Gets the number of bytes a single encoded field takes.
+ *
+ * @param key The name of the field.
+ * @param value The value of the field.
+ * @return The encoded size in bytes.
+ */
+std::size_t	Fields::encodedSize(const StringRef &key, const Arg &value)
+{
+	return (key.size() + 1 + value.encodedSize());
+}
+
+/**
+ * @brief Serializes a single field: the key, NUL-terminated, then the value.
+ *
+ * @param dst Destination of at least encodedSize(key, value) bytes.
+ * @param key The name of the field.
+ * @param value The value of the field.
+ * @return Pointer past the last byte written.
+ */
+char	*Fields::encode(char *dst, const StringRef &key, const Arg &value)
+{
+	std::memcpy(dst, key.data(), key.size());
+	dst += key.size();
+	*dst++ = '\0';
+	return (value.encode(dst));
+}
+
+/**
+ * @brief Deserializes a field written by encode(). The key and a string
+ * value borrow the encoded bytes.
+ *
+ * @param src Start of the encoded field.
+ * @param key Receives the NUL-terminated name of the field.
+ * @param value Receives the value of the field.
+ * @return Pointer past the encoded field.
+ */
+const char	*Fields::decode(const char *src, const char *&key, Arg &value)
+{
+	key = src;
+	return (Arg::decode(src + std::strlen(src) + 1, value));
+}
+
+/**
+ * @brief Looks a field up in encoded fields. The first field with the key
+ * wins.
+ *
+ * @param src Start of the encoded fields.
+ * @param count The number of fields to search.
+ * @param key The name of the field.
+ * @param value Receives the value of the field, borrowing the encoded bytes.
+ * @return True if the field was found.
+ */
+bool	Fields::find(const char *src, std::size_t count, const StringRef &key, Arg &value)
+{
+	const char *name;
+
+	for (std::size_t i = 0; i < count; ++i)
+	{
+		src = decode(src, name, value);
+		if (std::strncmp(name, key.data(), key.size()) == 0 && name[key.size()] == '\0')
+			return (true);
+	}
+	return (false);
+}
+
+} // !log42
+
+/* ************************************************************************** */
+/*                                                                            */
+/*                                MIT License                                 */
+/*                                                                            */
+/*   Copyright (c) 2025 Demont Pieric, Lucken Bénédict                        */
+/*                                                                            */
+/*   Inspired by the Python 'logging' module by Vinay Sajip.                  */
+/*   This implementation was rewritten in C++98 and contains no original      */
+/*   Python source code.                                                      */
+/*                                                                            */
+/*   Permission is hereby granted, free of charge, to any person obtaining    */
+/*   a copy of this software and associated documentation files (the          */
+/*   "Software"), to deal in the Software without restriction, including      */
+/*   without limitation the rights to use, copy, modify, merge, publish,      */
+/*   distribute, sublicense, and/or sell copies of the Software, and to       */
+/*   permit persons to whom the Software is furnished to do so, subject to    */
+/*   the following conditions:                                                */
+/*                                                                            */
+/*   The above copyright notice and this permission notice shall be included  */
+/*   in all copies or substantial portions of the Software.                   */
+/*                                                                            */
+/*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS  */
+/*   OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF               */
+/*   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.   */
+/*   IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY     */
+/*   CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,     */
+/*   TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE        */
+/*   SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                   */
+/*                                                                            */
+/* ************************************************************************** */
@@ -59,13 +59,14 @@ FileHandler::~FileHandler()
  */
 void	FileHandler::close()
 {
+	sync::ScopedLock lock(this->_lock);
 	if (this->_stream)
 	{
 		this->flush();
 		this->_fstream.close();
 		this->_stream = NULL;
 	}
-	this->_closed = true;
+	sync::store(this->_closed, true);
 }
 
 /**
@@ -16,6 +16,7 @@
  */ 
 
 #include <log42/Filter.hpp>
+#include <cstring>
 
 namespace log42
 {
@@ -79,6 +80,16 @@ bool	Filter::operator==(const Filter &rhs) const
 	return (this->_name == rhs._name && this->_len == rhs._len);
 }
 
+/**
+ * @brief Gets the logger name or prefix the filter passes.
+ *
+ * @return Reference to the filter's name.
+ */
+const std::string	&Filter::getName() const
+{
+	return (this->_name);
+}
+
 /**
  * @brief Determines if a log record passes the filter.
  *
@@ -90,13 +101,11 @@ bool	Filter::filter(const logRecord::LogRecord &record) const
 	if (this->_len == 0)
 		return (true);
 	
-	const std::string name = record.getName();
-	
-	if (this->_name == name)
-		return (true);
-	if (name.compare(0, this->_len, this->_name) != 0)
+	const char *name = record.getName();
+
+	if (std::strncmp(name, this->_name.c_str(), this->_len) != 0)
 		return (false);
-	return (name.size() > this->_len && name[this->_len] == '.');
+	return (name[this->_len] == '\0' || name[this->_len] == '.');
 }
 
 } // !filter
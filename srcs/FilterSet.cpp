@@ -0,0 +1,368 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   FilterSet.cpp                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: pdemont <pdemont@student.42lausanne.ch>    +#+  +:+       +#+        */
+/*   By: blucken <blucken@student.42lausanne.ch>  +#+#+#+#+#+   +#+           */
+/*                                                     #+#    #+#             */
+/*   Created: 2026/10/18                              ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+/**
+ * @file FilterSet.cpp
+ * @brief Implements the FilterSet class applying name filters and
+ * predicates cheapest first.
+ */ 
+
+#include <log42/FilterSet.hpp>
+#include <log42/Sync.hpp>
+#include <algorithm>
+
+namespace log42
+{
+namespace filter
+{
+
+namespace
+{
+
+/**
+ * @brief Last version given to a set.
+ */
+unsigned long	lastVersion = 0;
+
+/**
+ * @brief Number of entries of the per-thread decision cache.
+ */
+const std::size_t	cacheSize = 256;
+
+/**
+ * @brief Cached decision of the static predicates of one set version for a
+ * call site and level.
+ */
+struct Decision
+{
+	unsigned long					version;
+	const logRecord::CallSite		*site;
+	int								level;
+	bool							pass;
+};
+
+/**
+ * @brief Per-thread, direct-mapped decision cache, so that looking a
+ * decision up takes no lock.
+ */
+__thread Decision	decisionCache[cacheSize];
+
+/**
+ * @brief Picks the cache entry of a set version, call site and level.
+ *
+ * @param version The set version.
+ * @param site The call site.
+ * @param level The level.
+ * @return The entry index.
+ */
+std::size_t	cacheSlot(unsigned long version, const logRecord::CallSite *site, int level)
+{
+	std::size_t hash = reinterpret_cast<std::size_t>(site) >> 3;
+	hash ^= (version * 2654435761UL) ^ static_cast<std::size_t>(level);
+	return ((hash ^ (hash >> 8)) & (cacheSize - 1));
+}
+
+/**
+ * @brief Orders predicates by increasing cost.
+ */
+struct CheaperThan
+{
+	bool	operator()(const common::core::raii::SharedPtr<Predicate> &lhs, const common::core::raii::SharedPtr<Predicate> &rhs) const
+	{
+		return (lhs->getCost() < rhs->getCost());
+	}
+};
+
+/**
+ * @brief Removes a predicate from a group, if it is there.
+ *
+ * @param predicates The group.
+ * @param predicate The predicate.
+ * @return True if it was removed.
+ */
+bool	remove(t_predicates &predicates, const common::core::raii::SharedPtr<Predicate> &predicate)
+{
+	t_predicates::iterator it = std::find(predicates.begin(), predicates.end(), predicate);
+	if (it == predicates.end())
+		return (false);
+	predicates.erase(it);
+	return (true);
+}
+
+} // !namespace
+
+/**
+ * @brief Constructs an empty set, combining its filters with ALL.
+ */
+FilterSet::FilterSet() : _names(), _static(), _dynamic(), _match(ALL), _version(0) {}
+
+/**
+ * @brief Destructor for FilterSet.
+ */
+FilterSet::~FilterSet() {}
+
+/**
+ * @brief Copy constructor for FilterSet. The copy shares the version, and
+ * so the cached decisions, of the identical set it copies.
+ *
+ * @param rhs The FilterSet to copy.
+ */
+FilterSet::FilterSet(const FilterSet &rhs)
+	: _names(rhs._names), _static(rhs._static), _dynamic(rhs._dynamic),
+	_match(rhs._match), _version(rhs._version) {}
+
+/**
+ * @brief Assignment operator for FilterSet.
+ *
+ * @param rhs The FilterSet to assign from.
+ * @return Reference to this FilterSet.
+ */
+FilterSet	&FilterSet::operator=(const FilterSet &rhs)
+{
+	if (this != &rhs)
+	{
+		this->_names = rhs._names;
+		this->_static = rhs._static;
+		this->_dynamic = rhs._dynamic;
+		this->_match = rhs._match;
+		this->_version = rhs._version;
+	}
+	return (*this);
+}
+
+/**
+ * @brief Adds a name filter.
+ *
+ * @param filter The filter to add.
+ */
+void	FilterSet::insert(const Filter &filter)
+{
+	this->_names.insert(filter);
+	this->_changed();
+}
+
+/**
+ * @brief Removes a name filter.
+ *
+ * @param filter The filter to remove.
+ */
+void	FilterSet::erase(const Filter &filter)
+{
+	this->_names.erase(filter);
+	this->_changed();
+}
+
+/**
+ * @brief Adds a predicate after the predicates of its group costing no
+ * more than it.
+ *
+ * @param predicate The predicate to add; ignored if null or already there.
+ */
+void	FilterSet::insert(const common::core::raii::SharedPtr<Predicate> &predicate)
+{
+	if (!predicate)
+		return ;
+	t_predicates &group = predicate->isStatic() ? this->_static : this->_dynamic;
+	if (std::find(group.begin(), group.end(), predicate) != group.end())
+		return ;
+	group.insert(std::upper_bound(group.begin(), group.end(), predicate, CheaperThan()), predicate);
+	this->_changed();
+}
+
+/**
+ * @brief Removes a predicate.
+ *
+ * @param predicate The predicate to remove.
+ */
+void	FilterSet::erase(const common::core::raii::SharedPtr<Predicate> &predicate)
+{
+	if (remove(this->_static, predicate) || remove(this->_dynamic, predicate))
+		this->_changed();
+}
+
+/**
+ * @brief Removes every filter and predicate.
+ */
+void	FilterSet::clear()
+{
+	this->_names.clear();
+	this->_static.clear();
+	this->_dynamic.clear();
+	this->_changed();
+}
+
+/**
+ * @brief Sets how the filters combine.
+ *
+ * @param match ALL or ANY.
+ */
+void	FilterSet::setMatch(const e_Match match)
+{
+	this->_match = match;
+	this->_changed();
+}
+
+/**
+ * @brief Gets how the filters combine.
+ *
+ * @return ALL or ANY.
+ */
+e_Match	FilterSet::getMatch() const
+{
+	return (this->_match);
+}
+
+/**
+ * @brief Gets the number of name filters and predicates.
+ *
+ * @return The size of the set.
+ */
+std::size_t	FilterSet::size() const
+{
+	return (this->_names.size() + this->_static.size() + this->_dynamic.size());
+}
+
+/**
+ * @brief Checks whether the set holds nothing beyond a default one.
+ *
+ * @return True if there is no filter and the filters combine with ALL.
+ */
+bool	FilterSet::empty() const
+{
+	return (this->size() == 0 && this->_match == ALL);
+}
+
+/**
+ * @brief Applies the set to a log record.
+ *
+ * A set without filters passes every record, whatever its mode.
+ *
+ * @param record The log record to filter.
+ * @param owner The filterer applying the set, handed to the predicates.
+ * @return True if the record passes, false otherwise.
+ */
+bool	FilterSet::filter(const logRecord::LogRecord &record, filterer::Filterer &owner) const
+{
+	const bool all = (this->_match == ALL);
+
+	if ((all ? this->_names.passesAll(record.getName()) : this->_names.passesAny(record.getName())) != all)
+		return (!all);
+	if (!this->_static.empty() && this->_testStatic(record, owner) != all)
+		return (!all);
+	if (!this->_dynamic.empty() && this->_evaluate(this->_dynamic, record, owner) != all)
+		return (!all);
+	return (all || this->size() == 0);
+}
+
+/**
+ * @brief Estimates the memory held by the set.
+ *
+ * @return Size in bytes of the set, its filters and its predicate lists,
+ * or 0 for an empty set.
+ */
+std::size_t	FilterSet::getFootprint() const
+{
+	if (this->empty())
+		return (0);
+	return (sizeof(*this) + this->_names.getFootprint()
+		+ (this->_static.capacity() + this->_dynamic.capacity()) * sizeof(t_predicates::value_type));
+}
+
+/**
+ * @brief Gives the set a new version, invalidating its cached decisions.
+ */
+void	FilterSet::_changed()
+{
+	this->_version = sync::fetchAdd(lastVersion, 1UL) + 1;
+}
+
+/**
+ * @brief Applies the static predicates, through the calling thread's
+ * decision cache.
+ *
+ * @param record The log record to filter.
+ * @param owner The filterer applying the set.
+ * @return The combined decision of the static predicates.
+ */
+bool	FilterSet::_testStatic(const logRecord::LogRecord &record, filterer::Filterer &owner) const
+{
+	const logRecord::CallSite *site = record.getCallSite();
+	const int level = record.getLevelNo();
+
+	if (!site)
+		return (this->_evaluate(this->_static, record, owner));
+	Decision &decision = decisionCache[cacheSlot(this->_version, site, level)];
+	if (decision.version != this->_version || decision.site != site || decision.level != level)
+	{
+		decision.pass = this->_evaluate(this->_static, record, owner);
+		decision.version = this->_version;
+		decision.site = site;
+		decision.level = level;
+	}
+	return (decision.pass);
+}
+
+/**
+ * @brief Applies a group of predicates in order, stopping as soon as the
+ * outcome is known.
+ *
+ * @param predicates The group, cheapest first.
+ * @param record The log record to filter.
+ * @param owner The filterer applying the set.
+ * @return True if every predicate (ALL) or one of them (ANY) passes.
+ */
+bool	FilterSet::_evaluate(const t_predicates &predicates, const logRecord::LogRecord &record,
+			filterer::Filterer &owner) const
+{
+	const bool all = (this->_match == ALL);
+
+	t_predicates::const_iterator it;
+	for (it = predicates.begin(); it != predicates.end(); ++it)
+	{
+		if ((*it)->test(record, owner) != all)
+			return (!all);
+	}
+	return (all);
+}
+
+} // !filter
+} // !log42
+
+/* ************************************************************************** */
+/*                                                                            */
+/*                                MIT License                                 */
+/*                                                                            */
+/*   Copyright (c) 2025 Demont Pieric, Lucken Bénédict                        */
+/*                                                                            */
+/*   Inspired by the Python 'logging' module by Vinay Sajip.                  */
+/*   This implementation was rewritten in C++98 and contains no original      */
+/*   Python source code.                                                      */
+/*                                                                            */
+/*   Permission is hereby granted, free of charge, to any person obtaining    */
+/*   a copy of this software and associated documentation files (the          */
+/*   "Software"), to deal in the Software without restriction, including      */
+/*   without limitation the rights to use, copy, modify, merge, publish,      */
+/*   distribute, sublicense, and/or sell copies of the Software, and to       */
+/*   permit persons to whom the Software is furnished to do so, subject to    */
+/*   the following conditions:                                                */
+/*                                                                            */
+/*   The above copyright notice and this permission notice shall be included  */
+/*   in all copies or substantial portions of the Software.                   */
+/*                                                                            */
+/*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS  */
+/*   OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF               */
+/*   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.   */
+/*   IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY     */
+/*   CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,     */
+/*   TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE        */
+/*   SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                   */
+/*                                                                            */
+/* ************************************************************************** */
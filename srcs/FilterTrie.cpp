@@ -0,0 +1,262 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   FilterTrie.cpp                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: pdemont <pdemont@student.42lausanne.ch>    +#+  +:+       +#+        */
+/*   By: blucken <blucken@student.42lausanne.ch>  +#+#+#+#+#+   +#+           */
+/*                                                     #+#    #+#             */
+/*   Created: 2026/10/18                              ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+/**
+ * @file FilterTrie.cpp
+ * @brief Implements the FilterTrie class compiling name filters into a
+ * prefix trie.
+ */ 
+
+#include <log42/FilterTrie.hpp>
+#include <log42/Node.hpp>
+#include <log42/types.hpp>
+#include <vector>
+
+namespace log42
+{
+namespace filter
+{
+
+/**
+ * @brief Constructs an empty set.
+ */
+FilterTrie::FilterTrie() : _filters(), _nodes(), _prefixes(0) {}
+
+/**
+ * @brief Destructor for FilterTrie.
+ */
+FilterTrie::~FilterTrie() {}
+
+/**
+ * @brief Copy constructor for FilterTrie.
+ *
+ * @param rhs The FilterTrie to copy.
+ */
+FilterTrie::FilterTrie(const FilterTrie &rhs)
+	: _filters(rhs._filters), _nodes(rhs._nodes), _prefixes(rhs._prefixes) {}
+
+/**
+ * @brief Assignment operator for FilterTrie.
+ *
+ * @param rhs The FilterTrie to assign from.
+ * @return Reference to this FilterTrie.
+ */
+FilterTrie	&FilterTrie::operator=(const FilterTrie &rhs)
+{
+	if (this != &rhs)
+	{
+		this->_filters = rhs._filters;
+		this->_nodes = rhs._nodes;
+		this->_prefixes = rhs._prefixes;
+	}
+	return (*this);
+}
+
+/**
+ * @brief Adds a filter and recompiles the trie.
+ *
+ * @param filter The filter to add.
+ */
+void	FilterTrie::insert(const Filter &filter)
+{
+	if (this->_filters.insert(filter).second)
+		this->_compile();
+}
+
+/**
+ * @brief Removes a filter and recompiles the trie.
+ *
+ * @param filter The filter to remove.
+ */
+void	FilterTrie::erase(const Filter &filter)
+{
+	if (this->_filters.erase(filter))
+		this->_compile();
+}
+
+/**
+ * @brief Removes every filter.
+ */
+void	FilterTrie::clear()
+{
+	this->_filters.clear();
+	this->_compile();
+}
+
+/**
+ * @brief Gets the number of filters.
+ *
+ * @return The number of filters in the set.
+ */
+std::size_t	FilterTrie::size() const
+{
+	return (this->_filters.size());
+}
+
+/**
+ * @brief Checks whether the set has no filter.
+ *
+ * @return True if the set is empty, false otherwise.
+ */
+bool	FilterTrie::empty() const
+{
+	return (this->_filters.empty());
+}
+
+/**
+ * @brief Checks whether a logger name passes every filter.
+ *
+ * A filter with an empty name passes every name.
+ *
+ * @param name The record's logger name.
+ * @return True if the name passes every filter, or if there is none.
+ */
+bool	FilterTrie::passesAll(const char *name) const
+{
+	if (this->_prefixes == 0)
+		return (true);
+	return (this->_count(name, this->_prefixes) == this->_prefixes);
+}
+
+/**
+ * @brief Checks whether a logger name passes at least one filter.
+ *
+ * @param name The record's logger name.
+ * @return True if the name passes a filter, false if it passes none or if
+ * there is none.
+ */
+bool	FilterTrie::passesAny(const char *name) const
+{
+	if (this->_prefixes < this->_filters.size())
+		return (true);
+	return (this->_prefixes != 0 && this->_count(name, 1) != 0);
+}
+
+/**
+ * @brief Estimates the memory held by the set.
+ *
+ * @return Size in bytes of the filters and the trie, beyond the object
+ * itself.
+ */
+std::size_t	FilterTrie::getFootprint() const
+{
+	std::size_t bytes = this->_nodes.capacity() * sizeof(TrieNode);
+	t_filters::const_iterator it;
+	for (it = this->_filters.begin(); it != this->_filters.end(); ++it)
+		bytes += 4 * sizeof(void *) + sizeof(Filter) + Node::stringFootprint(it->getName());
+	return (bytes);
+}
+
+/**
+ * @brief Rebuilds the trie from the filters with a non-empty name.
+ */
+void	FilterTrie::_compile()
+{
+	std::vector<TrieNode> nodes;
+	std::size_t prefixes = 0;
+	TrieNode root = { 0, 0, '\0', false };
+
+	nodes.push_back(root);
+	t_filters::const_iterator it;
+	for (it = this->_filters.begin(); it != this->_filters.end(); ++it)
+	{
+		const std::string &name = it->getName();
+		if (name.empty())
+			continue ;
+		unsigned int node = 0;
+		for (std::size_t i = 0; i < name.length(); ++i)
+		{
+			unsigned int child = nodes[node].child;
+			while (child && nodes[child].c != name[i])
+				child = nodes[child].sibling;
+			if (!child)
+			{
+				TrieNode next = { 0, nodes[node].child, name[i], false };
+				child = static_cast<unsigned int>(nodes.size());
+				nodes.push_back(next);
+				nodes[node].child = child;
+			}
+			node = child;
+		}
+		nodes[node].terminal = true;
+		++prefixes;
+	}
+	if (prefixes == 0)
+		nodes.clear();
+	this->_nodes.swap(nodes);
+	this->_prefixes = prefixes;
+}
+
+/**
+ * @brief Counts the filters a logger name passes, in one walk.
+ *
+ * A filter is passed when its node is reached at the end of the name or
+ * right before a dot.
+ *
+ * @param name The logger name.
+ * @param limit Count at which to stop walking.
+ * @return The number of filters passed, at most limit.
+ */
+std::size_t	FilterTrie::_count(const char *name, std::size_t limit) const
+{
+	const TrieNode *nodes = &this->_nodes[0];
+	std::size_t hits = 0;
+	unsigned int node = 0;
+
+	for (const char *p = name; ; ++p)
+	{
+		if ((*p == '.' || *p == '\0') && nodes[node].terminal && ++hits == limit)
+			break ;
+		if (*p == '\0')
+			break ;
+		unsigned int child = nodes[node].child;
+		while (child && nodes[child].c != *p)
+			child = nodes[child].sibling;
+		if (!child)
+			break ;
+		node = child;
+	}
+	return (hits);
+}
+
+} // !filter
+} // !log42
+
+/* ************************************************************************** */
+/*                                                                            */
+/*                                MIT License                                 */
+/*                                                                            */
+/*   Copyright (c) 2025 Demont Pieric, Lucken Bénédict                        */
+/*                                                                            */
+/*   Inspired by the Python 'logging' module by Vinay Sajip.                  */
+/*   This implementation was rewritten in C++98 and contains no original      */
+/*   Python source code.                                                      */
+/*                                                                            */
+/*   Permission is hereby granted, free of charge, to any person obtaining    */
+/*   a copy of this software and associated documentation files (the          */
+/*   "Software"), to deal in the Software without restriction, including      */
+/*   without limitation the rights to use, copy, modify, merge, publish,      */
+/*   distribute, sublicense, and/or sell copies of the Software, and to       */
+/*   permit persons to whom the Software is furnished to do so, subject to    */
+/*   the following conditions:                                                */
+/*                                                                            */
+/*   The above copyright notice and this permission notice shall be included  */
+/*   in all copies or substantial portions of the Software.                   */
+/*                                                                            */
+/*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS  */
+/*   OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF               */
+/*   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.   */
+/*   IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY     */
+/*   CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,     */
+/*   TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE        */
+/*   SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                   */
+/*                                                                            */
+/* ************************************************************************** */
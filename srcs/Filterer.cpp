@@ -61,7 +61,21 @@ Filterer	&Filterer::operator=(const Filterer &rhs)
  */
 void	Filterer::addFilter(const filter::Filter &filter)
 {
-	this->_filters.insert(filter);
+	sync::Published<filter::FilterSet>::Writer filters(this->_filters);
+	filters->insert(filter);
+	filters.commit();
+}
+
+/**
+ * @brief Adds a predicate to the Filterer.
+ *
+ * @param predicate The predicate to add, shared with the caller.
+ */
+void	Filterer::addFilter(const common::core::raii::SharedPtr<filter::Predicate> &predicate)
+{
+	sync::Published<filter::FilterSet>::Writer filters(this->_filters);
+	filters->insert(predicate);
+	filters.commit();
 }
 
 /**
@@ -71,7 +85,21 @@ void	Filterer::addFilter(const filter::Filter &filter)
  */
 void	Filterer::removeFilter(const filter::Filter &filter)
 {
-	this->_filters.erase(filter);
+	sync::Published<filter::FilterSet>::Writer filters(this->_filters);
+	filters->erase(filter);
+	filters.commit();
+}
+
+/**
+ * @brief Removes a predicate from the Filterer.
+ *
+ * @param predicate The predicate to remove.
+ */
+void	Filterer::removeFilter(const common::core::raii::SharedPtr<filter::Predicate> &predicate)
+{
+	sync::Published<filter::FilterSet>::Writer filters(this->_filters);
+	filters->erase(predicate);
+	filters.commit();
 }
 
 /**
@@ -79,24 +107,83 @@ void	Filterer::removeFilter(const filter::Filter &filter)
  */
 void	Filterer::clearFilters()
 {
-	this->_filters.clear();
+	sync::Published<filter::FilterSet>::Writer filters(this->_filters);
+	filters->clear();
+	filters.commit();
+}
+
+/**
+ * @brief Sets how the filters combine.
+ *
+ * @param match filter::ALL for a record to pass every filter (the default),
+ * filter::ANY for it to pass at least one.
+ */
+void	Filterer::setMatch(const filter::e_Match match)
+{
+	sync::Published<filter::FilterSet>::Writer filters(this->_filters);
+	filters->setMatch(match);
+	filters.commit();
+}
+
+/**
+ * @brief Gets how the filters combine.
+ *
+ * @return filter::ALL or filter::ANY.
+ */
+filter::e_Match	Filterer::getMatch() const
+{
+	sync::Epoch::Guard guard;
+	return (this->_filters.get().getMatch());
+}
+
+/**
+ * @brief Gets the number of filters.
+ *
+ * @return The number of name filters and predicates in the current set.
+ */
+std::size_t	Filterer::getFilterCount() const
+{
+	sync::Epoch::Guard guard;
+	return (this->_filters.get().size());
+}
+
+/**
+ * @brief Estimates the memory held by the filters.
+ *
+ * @return Size in bytes of the current set, or 0 if it is the shared empty
+ * set.
+ */
+std::size_t	Filterer::getFilterFootprint() const
+{
+	sync::Epoch::Guard guard;
+	return (this->_filters.get().getFootprint());
 }
 
 /**
  * @brief Applies all filters to a log record.
  *
+ * The filterer is handed to the predicates as their owner, so one can hand
+ * it a summary; filter() is not const for that reason.
+ *
  * @param record The log record to filter.
- * @return True if the record passes all filters, false otherwise.
+ * @return True if the record passes the filters, false otherwise.
+ */
+bool	Filterer::filter(const logRecord::LogRecord &record)
+{
+	sync::Epoch::Guard guard;
+	return (this->_filters.get().filter(record, *this));
+}
+
+/**
+ * @brief Handles a summary record of a predicate of this filterer.
+ *
+ * A bare filterer has nowhere to send it, and drops it.
+ *
+ * @param record The summary record.
  */
-bool	Filterer::filter(const logRecord::LogRecord &record) const
+void	Filterer::_handleSummary(logRecord::LogRecord &record)
 {
-	t_filters::const_iterator it;
-	for (it = this->_filters.begin(); it != this->_filters.end(); ++it)
-	{
-		if (!it->filter(record))
-			return (false);
-	}
-	return (true);
+	(void)record;
 }
 
 } // !filterer
@@ -36,9 +36,10 @@ const std::string Formatter::defaultPercentFormat = "%(levelname):%(name):%(mess
 const std::string Formatter::defaultTimeFormat = "%Y-%m-%d %H:%M:%S,%(msecs) %Z";
 
 /**
- * @brief Pointer to the time converter function (default: localtime).
+ * @brief Pointer to the time converter function (default: localtime_r, which
+ * unlike localtime does not share a static result between threads).
  */
-struct std::tm *(*Formatter::_converter)(const time_t *) = localtime;
+struct std::tm *(*Formatter::_converter)(const time_t *, struct std::tm *) = localtime_r;
 
 /**
  * @brief Constructs a Formatter with the given format and date format.
@@ -50,11 +51,25 @@ struct std::tm *(*Formatter::_converter)(const time_t *) = localtime;
  */
 Formatter::Formatter(const std::string &fmt, const std::string &datefmt, 
 					 bool validate, const t_defaults defaults)
-	: _style(fmt.empty() ? defaultPercentFormat : fmt, defaults), 
-	_fmt(this->_style.getFmt()), _datefmt(datefmt)
+	: _style(new style::PercentStyle(fmt.empty() ? defaultPercentFormat : fmt, defaults)), 
+	_fmt(this->_style->getFmt()), _datefmt(datefmt)
 {
 	if (validate)
-		this->_style.validate();
+		this->_style->validate();
+}
+
+/**
+ * @brief Constructs a Formatter around a style built by a subclass.
+ *
+ * @param style The style formatting the records.
+ * @param datefmt The format string for timestamps.
+ * @param validate If true, validates the format string of the style.
+ */
+Formatter::Formatter(const common::core::raii::SharedPtr<style::PercentStyle> &style, const std::string &datefmt, bool validate)
+	: _style(style), _fmt(style->getFmt()), _datefmt(datefmt)
+{
+	if (validate)
+		this->_style->validate();
 }
 
 /**
@@ -93,7 +108,7 @@ Formatter	&Formatter::operator=(const Formatter &rhs)
  */
 bool	Formatter::useTime() const
 {
-	return (this->_style.useTime());
+	return (this->_style->useTime());
 }
 
 /**
@@ -104,7 +119,7 @@ bool	Formatter::useTime() const
  */
 std::string	Formatter::formatMessage(const logRecord::LogRecord &record) const
 {
-	return (this->_style.format(record));
+	return (this->_style->format(record));
 }
 
 /**
@@ -113,10 +128,33 @@ std::string	Formatter::formatMessage(const logRecord::LogRecord &record) const
  * @param record The log record to format.
  * @return The formatted log message.
  */
-std::string	Formatter::format(logRecord::LogRecord &record) const
+std::string	Formatter::format(const logRecord::LogRecord &record) const
 {
-	record.setAsctime(Formatter::formatTime(record, this->_datefmt));
-	return (formatMessage(record));
+	arena::Scope scope;
+	arena::t_string out;
+	this->format(record, out);
+	return (std::string(out.data(), out.size()));
+}
+
+/**
+ * @brief Formats a log record, appending the result to a dispatch buffer.
+ *
+ * The creation time is only rendered when the format uses it, into a stack
+ * buffer handed to the style instead of being stored in the record.
+ *
+ * @param record The log record to format.
+ * @param out The buffer to append to.
+ */
+void	Formatter::format(const logRecord::LogRecord &record, arena::t_string &out) const
+{
+	if (!this->useTime())
+	{
+		this->_style->format(record, StringRef(""), out);
+		return ;
+	}
+	char buffer[timeBufferSize];
+	std::size_t len = this->_formatTime(record, this->_datefmt, buffer);
+	this->_style->format(record, StringRef(buffer, len), out);
 }
 
 /**
@@ -128,15 +166,27 @@ std::string	Formatter::format(logRecord::LogRecord &record) const
  */
 std::string	Formatter::formatTime(const logRecord::LogRecord &record, const std::string &datefmt) const
 {
-	time_t	t = record.getCreated();
-	struct std::tm *tm= this->_converter(&t);
+	char buffer[timeBufferSize];
+	std::size_t len = this->_formatTime(record, datefmt, buffer);
+	return (std::string(buffer, len));
+}
 
-	const std::string &fmt = datefmt.empty() ? defaultTimeFormat : datefmt;
-	std::string buffer(100, 0);
-	std::strftime(&buffer[0], buffer.size(), fmt.c_str(), tm);
-	buffer.resize(std::strlen(&buffer[0]));
+/**
+ * @brief Formats the time for a log record into a caller-provided buffer.
+ *
+ * @param record The log record.
+ * @param datefmt The date format string.
+ * @param buffer Buffer of timeBufferSize bytes receiving the time.
+ * @return The length of the formatted time.
+ */
+std::size_t	Formatter::_formatTime(const logRecord::LogRecord &record, const std::string &datefmt, char *buffer) const
+{
+	time_t			t = record.getCreated();
+	struct std::tm	tm;
+	this->_converter(&t, &tm);
 
-	return (buffer);
+	const std::string &fmt = datefmt.empty() ? defaultTimeFormat : datefmt;
+	return (std::strftime(buffer, timeBufferSize, fmt.c_str(), &tm));
 }
 
 } // !formatter
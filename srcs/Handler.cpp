@@ -18,6 +18,7 @@
 #include <log42/Filterer.hpp>
 #include <log42/Handler.hpp>
 #include <log42/LogRecord.hpp>
+#include <log42/Sync.hpp>
 #include <iostream>
 
 namespace log42
@@ -35,7 +36,8 @@ Handler::Handler(const logRecord::e_LogLevel level)
 	_name(""), 
 	_level(level), 
 	_formatter(), 
-	_closed(false) 
+	_closed(false),
+	_lock(true)
 {}
 
 /**
@@ -48,7 +50,7 @@ Handler::~Handler() {};
  *
  * @param rhs The Handler to copy.
  */
-Handler::Handler(const Handler &rhs) : filterer::Filterer(rhs), _name(rhs._name), _level(rhs._level), _formatter(rhs._formatter), _closed(rhs._closed) {}
+Handler::Handler(const Handler &rhs) : filterer::Filterer(rhs), _name(rhs._name), _level(rhs._level), _formatter(rhs._formatter), _closed(rhs._closed), _lock(true) {}
 
 /**
  * @brief Assignment operator for Handler.
@@ -60,6 +62,7 @@ Handler	&Handler::operator=(const Handler &rhs)
 {
 	if (this != &rhs)
 	{
+		sync::ScopedLock lock(this->_lock);
 		filterer::Filterer::operator=(rhs);
 		this->_name = rhs._name;
 		this->_level = rhs._level;
@@ -96,7 +99,7 @@ void	Handler::setName(const std::string &name)
  */
 logRecord::e_LogLevel	Handler::getLevel() const
 {
-	return (this->_level);
+	return (sync::load(this->_level));
 }
 
 /**
@@ -106,7 +109,7 @@ logRecord::e_LogLevel	Handler::getLevel() const
  */
 void	Handler::setLevel(const logRecord::e_LogLevel level)
 {
-	this->_level = level;
+	sync::store(this->_level, level);
 }
 
 /**
@@ -120,20 +123,56 @@ std::string	Handler::format(logRecord::LogRecord &record) const
 	return (this->_formatter.format(record));
 }
 
+/**
+ * @brief Formats a log record, appending the result to a dispatch buffer.
+ *
+ * @param record The log record to format.
+ * @param out The buffer to append to.
+ */
+void	Handler::format(const logRecord::LogRecord &record, arena::t_string &out) const
+{
+	this->_formatter.format(record, out);
+}
+
+/**
+ * @brief Acquires the handler's lock, which serializes emission.
+ *
+ * The lock is recursive, so a thread holding it may call methods that take it.
+ */
+void	Handler::acquire()
+{
+	this->_lock.lock();
+}
+
+/**
+ * @brief Releases the handler's lock.
+ */
+void	Handler::release()
+{
+	this->_lock.unlock();
+}
+
 /**
  * @brief Handles a log record: filters, checks level, emits, and handles errors.
  *
+ * Everything the handler formats while emitting lives in the thread's arena
+ * and is released when the record has been handled. Filtering runs
+ * concurrently; emit() runs under the handler's lock, one record at a time.
+ *
  * @param record The log record to handle.
  * @return True if the record was handled, false otherwise.
  */
 bool	Handler::handle(logRecord::LogRecord &record)
 {
-	if (this->_closed)
+	if (sync::load(this->_closed))
 		return (false);
 	if (!this->filter(record))
 		return (false);
-	if (record.getLevelNo() < this->_level)
+	if (record.getLevelNo() < this->getLevel())
 		return (false);
+
+	arena::Scope scope;
+	sync::ScopedLock lock(this->_lock);
 	try
 	{
 		this->emit(record);
@@ -163,6 +202,7 @@ const formatter::Formatter	&Handler::getFormatter() const
  */
 void	Handler::setFormatter(const formatter::Formatter &fmt)
 {
+	sync::ScopedLock lock(this->_lock);
 	this->_formatter = fmt;
 }
 
@@ -171,7 +211,19 @@ void	Handler::setFormatter(const formatter::Formatter &fmt)
  */
 void	Handler::close()
 {
-	this->_closed = true;
+	sync::ScopedLock lock(this->_lock);
+	sync::store(this->_closed, true);
+}
+
+/**
+ * @brief Handles a summary record of a predicate of this handler, which
+ * goes through the handler only.
+ *
+ * @param record The summary record.
+ */
+void	Handler::_handleSummary(logRecord::LogRecord &record)
+{
+	this->handle(record);
 }
 
 /**
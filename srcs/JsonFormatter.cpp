@@ -0,0 +1,107 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   JsonFormatter.cpp                                  :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: pdemont <pdemont@student.42lausanne.ch>    +#+  +:+       +#+        */
+/*   By: blucken <blucken@student.42lausanne.ch>  +#+#+#+#+#+   +#+           */
+/*                                                     #+#    #+#             */
+/*   Created: 2026/10/18                              ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+/**
+ * @file JsonFormatter.cpp
+ * @brief Implements the JsonFormatter class.
+ */ 
+
+#include <log42/JsonFormatter.hpp>
+#include <log42/JsonStyle.hpp>
+
+namespace log42
+{
+namespace formatter
+{
+
+/**
+ * @brief Default members of the JSON objects.
+ */
+const std::string JsonFormatter::defaultJsonFormat = 
+	"%(asctime) %(levelname) %(name) %(message) %(filename) %(lineno) %(funcName)";
+
+/**
+ * @brief Default time format of the JSON objects, ISO 8601 with
+ * milliseconds and the UTC offset.
+ */
+const std::string JsonFormatter::defaultJsonTimeFormat = "%Y-%m-%dT%H:%M:%S.%(msecs)%z";
+
+/**
+ * @brief Constructs a JsonFormatter.
+ *
+ * @param fmt The format string naming the members; it must name the message.
+ * @param datefmt The format string for timestamps.
+ * @param defaults Default values for structured fields.
+ * @throws std::invalid_argument if the format does not contain %(message).
+ */
+JsonFormatter::JsonFormatter(const std::string &fmt, const std::string &datefmt, const t_defaults defaults)
+	: Formatter(common::core::raii::SharedPtr<style::PercentStyle>(
+		new style::JsonStyle(fmt.empty() ? defaultJsonFormat : fmt, defaults)), datefmt, true) {}
+
+/**
+ * @brief Destructor for JsonFormatter.
+ */
+JsonFormatter::~JsonFormatter() {}
+
+/**
+ * @brief Copy constructor for JsonFormatter.
+ *
+ * @param rhs The JsonFormatter to copy.
+ */
+JsonFormatter::JsonFormatter(const JsonFormatter &rhs) : Formatter(rhs) {}
+
+/**
+ * @brief Assignment operator for JsonFormatter.
+ *
+ * @param rhs The JsonFormatter to assign from.
+ * @return Reference to this JsonFormatter.
+ */
+JsonFormatter	&JsonFormatter::operator=(const JsonFormatter &rhs)
+{
+	if (this != &rhs)
+		Formatter::operator=(rhs);
+	return (*this);
+}
+
+} // !formatter
+} // !log42
+
+/* ************************************************************************** */
+/*                                                                            */
+/*                                MIT License                                 */
+/*                                                                            */
+/*   Copyright (c) 2025 Demont Pieric, Lucken Bénédict                        */
+/*                                                                            */
+/*   Inspired by the Python 'logging' module by Vinay Sajip.                  */
+/*   This implementation was rewritten in C++98 and contains no original      */
+/*   Python source code.                                                      */
+/*                                                                            */
+/*   Permission is hereby granted, free of charge, to any person obtaining    */
+/*   a copy of this software and associated documentation files (the          */
+/*   "Software"), to deal in the Software without restriction, including      */
+/*   without limitation the rights to use, copy, modify, merge, publish,      */
+/*   distribute, sublicense, and/or sell copies of the Software, and to       */
+/*   permit persons to whom the Software is furnished to do so, subject to    */
+/*   the following conditions:                                                */
+/*                                                                            */
+/*   The above copyright notice and this permission notice shall be included  */
+/*   in all copies or substantial portions of the Software.                   */
+/*                                                                            */
+/*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS  */
+/*   OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF               */
+/*   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.   */
+/*   IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY     */
+/*   CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,     */
+/*   TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE        */
+/*   SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                   */
+/*                                                                            */
+/* ************************************************************************** */
@@ -0,0 +1,396 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   JsonStyle.cpp                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: pdemont <pdemont@student.42lausanne.ch>    +#+  +:+       +#+        */
+/*   By: blucken <blucken@student.42lausanne.ch>  +#+#+#+#+#+   +#+           */
+/*                                                     #+#    #+#             */
+/*   Created: 2026/10/18                              ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+/**
+ * @file JsonStyle.cpp
+ * @brief Implements the JsonStyle class.
+ */ 
+
+#include <log42/Fields.hpp>
+#include <log42/JsonStyle.hpp>
+#include <cstring>
+
+namespace log42
+{
+namespace style
+{
+
+/**
+ * @brief Machine word the escaping scan tests at once.
+ */
+typedef unsigned long	t_word;
+
+/**
+ * @brief Word with every byte set to 0x01.
+ */
+static const t_word	wordOnes = ~static_cast<t_word>(0) / 0xFF;
+
+/**
+ * @brief Word with every byte set to 0x80.
+ */
+static const t_word	wordHighs = wordOnes * 0x80;
+
+/**
+ * @brief Tells whether a word holds a byte that JSON requires to escape: a
+ * quote, a backslash or a control character below 0x20.
+ *
+ * A byte equal to c is a zero byte of the word xor c, and a zero or small
+ * byte borrows in the subtraction, setting its high bit; bytes of 0x80 and
+ * above are masked out. A borrow can only flag the bytes above a matching
+ * one, so the answer is exact.
+ *
+ * @param word The bytes to test.
+ * @return True if at least one byte needs escaping.
+ */
+static bool	needsEscape(t_word word)
+{
+	t_word quote = word ^ (wordOnes * '"');
+	t_word backslash = word ^ (wordOnes * '\\');
+	return ((((word - wordOnes * 0x20) | (quote - wordOnes) | (backslash - wordOnes)) & ~word & wordHighs) != 0);
+}
+
+/**
+ * @brief Appends the JSON escape sequence of a byte.
+ *
+ * @param c A quote, a backslash or a control character.
+ * @param out The buffer to append to.
+ */
+static void	appendEscape(unsigned char c, arena::t_string &out)
+{
+	static const char	hex[] = "0123456789abcdef";
+
+	switch (c)
+	{
+		case '"': out.append("\\\"", 2); break ;
+		case '\\': out.append("\\\\", 2); break ;
+		case '\n': out.append("\\n", 2); break ;
+		case '\r': out.append("\\r", 2); break ;
+		case '\t': out.append("\\t", 2); break ;
+		case '\b': out.append("\\b", 2); break ;
+		case '\f': out.append("\\f", 2); break ;
+		default:
+			out.append("\\u00", 4);
+			out.push_back(hex[c >> 4]);
+			out.push_back(hex[c & 0xF]);
+			break ;
+	}
+}
+
+/**
+ * @brief Appends text as a quoted JSON string.
+ *
+ * Words without a byte to escape are skipped over and copied with the rest
+ * of their run in one append; only the bytes of a flagged word are looked
+ * at one by one.
+ *
+ * @param data The text.
+ * @param size The length of the text.
+ * @param out The buffer to append to.
+ */
+static void	appendString(const char *data, std::size_t size, arena::t_string &out)
+{
+	const char *p = data;
+	const char *end = data + size;
+	const char *run = data;
+
+	out.push_back('"');
+	while (p < end)
+	{
+		std::size_t left = end - p;
+		if (left >= sizeof(t_word))
+		{
+			t_word word;
+			std::memcpy(&word, p, sizeof(word));
+			if (!needsEscape(word))
+			{
+				p += sizeof(word);
+				continue ;
+			}
+			left = sizeof(word);
+		}
+		for (const char *stop = p + left; p < stop; ++p)
+		{
+			unsigned char c = static_cast<unsigned char>(*p);
+			if (c >= 0x20 && c != '"' && c != '\\')
+				continue ;
+			out.append(run, p - run);
+			appendEscape(c, out);
+			run = p + 1;
+		}
+	}
+	out.append(run, end - run);
+	out.push_back('"');
+}
+
+/**
+ * @brief Appends the separator and the name of a member.
+ *
+ * @param key The name of the member.
+ * @param first True for the first member of the object.
+ * @param out The buffer to append to.
+ */
+static void	appendKey(const StringRef &key, bool &first, arena::t_string &out)
+{
+	if (!first)
+		out.push_back(',');
+	first = false;
+	appendString(key.data(), key.size(), out);
+	out.push_back(':');
+}
+
+/**
+ * @brief Quotes the name of a member once, ready to be copied per record.
+ *
+ * @param key The name of the member.
+ * @return The escaped name between quotes, followed by a colon.
+ */
+static std::string	quoteKey(const std::string &key)
+{
+	arena::t_string quoted;
+
+	appendString(key.data(), key.size(), quoted);
+	quoted.push_back(':');
+	return (std::string(quoted.data(), quoted.size()));
+}
+
+/**
+ * @brief Constructs a JsonStyle and compiles its format string.
+ *
+ * @param fmt The format string naming the members.
+ * @param defaults Default values for structured fields.
+ */
+JsonStyle::JsonStyle(const std::string &fmt, const t_defaults defaults) 
+	: PercentStyle(fmt, defaults)
+{
+	t_segments::const_iterator it;
+	for (it = this->_segments.begin(); it != this->_segments.end(); ++it)
+		this->_keys.push_back(it->field == LITERAL ? std::string() : quoteKey(it->text));
+}
+
+/**
+ * @brief Destructor for JsonStyle.
+ */
+JsonStyle::~JsonStyle() {}
+
+/**
+ * @brief Copy constructor for JsonStyle.
+ *
+ * @param rhs The JsonStyle to copy.
+ */
+JsonStyle::JsonStyle(const JsonStyle &rhs) : PercentStyle(rhs), _keys(rhs._keys) {}
+
+/**
+ * @brief Assignment operator for JsonStyle.
+ *
+ * @param rhs The JsonStyle to assign from.
+ * @return Reference to this JsonStyle.
+ */
+JsonStyle	&JsonStyle::operator=(const JsonStyle &rhs)
+{
+	if (this != &rhs)
+	{
+		PercentStyle::operator=(rhs);
+		this->_keys = rhs._keys;
+	}
+	return (*this);
+}
+
+/**
+ * @brief Formats a log record as a JSON object.
+ *
+ * @param record The log record to format.
+ * @param asctime The formatted creation time of the record.
+ * @param out The buffer to append to.
+ */
+void	JsonStyle::_format(const logRecord::LogRecord &record, const StringRef &asctime, arena::t_string &out) const
+{
+	bool first = true;
+	Arg value;
+
+	out.push_back('{');
+	for (std::size_t i = 0; i < this->_segments.size(); ++i)
+	{
+		const Segment &segment = this->_segments[i];
+		t_defaults::const_iterator def = this->_defaults.end();
+
+		if (segment.field == LITERAL)
+			continue ;
+		if (segment.field == EXTRA && !record.getField(segment.text, value))
+		{
+			def = this->_defaults.find(segment.text);
+			if (def == this->_defaults.end())
+				continue ;
+		}
+		if (!first)
+			out.push_back(',');
+		first = false;
+		out.append(this->_keys[i].data(), this->_keys[i].size());
+		if (segment.field != EXTRA)
+			this->_appendAttribute(record, segment.field, asctime, out);
+		else if (def == this->_defaults.end())
+			_appendValue(value, out);
+		else
+			appendString(def->second.data(), def->second.size(), out);
+	}
+
+	const char *fields = record.getFields();
+	const char *p = fields;
+	const char *key;
+	Arg previous;
+	for (std::size_t i = 0; i < record.getFieldCount(); ++i)
+	{
+		p = Fields::decode(p, key, value);
+		if (this->_isNamed(key) || Fields::find(fields, i, key, previous))
+			continue ;
+		appendKey(key, first, out);
+		_appendValue(value, out);
+	}
+	out.push_back('}');
+}
+
+/**
+ * @brief Appends the value of a record attribute: a number, or a string.
+ *
+ * Numbers are written without the padding of the text formats, which a
+ * JSON number cannot have (msecs would be 007).
+ *
+ * @param record The log record to read from.
+ * @param field The attribute to append.
+ * @param asctime The formatted creation time of the record.
+ * @param out The buffer to append to.
+ */
+void	JsonStyle::_appendAttribute(const logRecord::LogRecord &record, e_Field field, const StringRef &asctime, arena::t_string &out) const
+{
+	const char *text = NULL;
+
+	switch (field)
+	{
+		case ASCTIME:
+		{
+			arena::t_string expanded;
+			this->_appendExpanded(record, asctime, expanded);
+			appendString(expanded.data(), expanded.size(), out);
+			return ;
+		}
+		case MESSAGE:
+		{
+			StringRef message = record.getMessageRef();
+			appendString(message.data(), message.size(), out);
+			return ;
+		}
+		case FILENAME: text = record.getFilename(); break ;
+		case FUNCNAME: text = record.getFuncName(); break ;
+		case LEVELNAME: text = record.getLevelName(); break ;
+		case MODULE: text = record.getModule(); break ;
+		case NAME: text = record.getName(); break ;
+		case PATHNAME: text = record.getPathname(); break ;
+		case CREATED: _appendValue(Arg(static_cast<long>(record.getCreated())), out); return ;
+		case LEVELNO: _appendValue(Arg(static_cast<int>(record.getLevelNo())), out); return ;
+		case LINENO: _appendValue(Arg(record.getLineNo()), out); return ;
+		case MSECS: _appendValue(Arg(record.getMsecs()), out); return ;
+		case RELATIVECREATED: _appendValue(Arg(record.getRelativeCreated()), out); return ;
+		default:
+			this->_appendField(record, field, asctime, out);
+			return ;
+	}
+	appendString(text, std::strlen(text), out);
+}
+
+/**
+ * @brief Tells whether the format names a member, so that a structured
+ * field of that name is not written twice.
+ *
+ * @param key The name of the field.
+ * @return True if a placeholder of the format has that name.
+ */
+bool	JsonStyle::_isNamed(const char *key) const
+{
+	t_segments::const_iterator it;
+	for (it = this->_segments.begin(); it != this->_segments.end(); ++it)
+	{
+		if (it->field != LITERAL && it->text == key)
+			return (true);
+	}
+	return (false);
+}
+
+/**
+ * @brief Appends the value of a structured field. Numbers that JSON cannot
+ * represent, infinities and NaN, are written as null.
+ *
+ * @param value The value to append.
+ * @param out The buffer to append to.
+ */
+void	JsonStyle::_appendValue(const Arg &value, arena::t_string &out)
+{
+	std::size_t start = out.size();
+
+	switch (value.getType())
+	{
+		case Arg::STRING:
+		{
+			StringRef text = value.getString();
+			appendString(text.data(), text.size(), out);
+			return ;
+		}
+		case Arg::POINTER:
+			out.push_back('"');
+			value.append(out, 's');
+			out.push_back('"');
+			return ;
+		case Arg::NONE:
+			out.append("null", 4);
+			return ;
+		default:
+			value.append(out, 's');
+			break ;
+	}
+	if (value.getType() == Arg::DOUBLE && std::memchr(out.data() + start, 'n', out.size() - start))
+	{
+		out.resize(start);
+		out.append("null", 4);
+	}
+}
+
+} // !style
+} // !log42
+
+/* ************************************************************************** */
+/*                                                                            */
+/*                                MIT License                                 */
+/*                                                                            */
+/*   Copyright (c) 2025 Demont Pieric, Lucken Bénédict                        */
+/*                                                                            */
+/*   Inspired by the Python 'logging' module by Vinay Sajip.                  */
+/*   This implementation was rewritten in C++98 and contains no original      */
+/*   Python source code.                                                      */
+/*                                                                            */
+/*   Permission is hereby granted, free of charge, to any person obtaining    */
+/*   a copy of this software and associated documentation files (the          */
+/*   "Software"), to deal in the Software without restriction, including      */
+/*   without limitation the rights to use, copy, modify, merge, publish,      */
+/*   distribute, sublicense, and/or sell copies of the Software, and to       */
+/*   permit persons to whom the Software is furnished to do so, subject to    */
+/*   the following conditions:                                                */
+/*                                                                            */
+/*   The above copyright notice and this permission notice shall be included  */
+/*   in all copies or substantial portions of the Software.                   */
+/*                                                                            */
+/*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS  */
+/*   OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF               */
+/*   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.   */
+/*   IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY     */
+/*   CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,     */
+/*   TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE        */
+/*   SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                   */
+/*                                                                            */
+/* ************************************************************************** */
@@ -0,0 +1,103 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   LevelRange.cpp                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: pdemont <pdemont@student.42lausanne.ch>    +#+  +:+       +#+        */
+/*   By: blucken <blucken@student.42lausanne.ch>  +#+#+#+#+#+   +#+           */
+/*                                                     #+#    #+#             */
+/*   Created: 2026/10/18                              ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+/**
+ * @file LevelRange.cpp
+ * @brief Implements the LevelRange predicate.
+ */ 
+
+#include <log42/LevelRange.hpp>
+
+namespace log42
+{
+namespace filter
+{
+
+/**
+ * @brief Constructs a LevelRange.
+ *
+ * @param min The lowest level passed.
+ * @param max The highest level passed.
+ */
+LevelRange::LevelRange(const logRecord::e_LogLevel min, const logRecord::e_LogLevel max)
+	: Predicate(), _min(min), _max(max) {}
+
+/**
+ * @brief Destructor for LevelRange.
+ */
+LevelRange::~LevelRange() {}
+
+/**
+ * @brief Checks whether a record's level lies within the range.
+ *
+ * @param record The log record to check.
+ * @param owner The filterer applying the predicate.
+ * @return True if min <= level <= max, false otherwise.
+ */
+bool	LevelRange::test(const logRecord::LogRecord &record, filterer::Filterer &owner) const
+{
+	(void)owner;
+	return (record.getLevelNo() >= this->_min && record.getLevelNo() <= this->_max);
+}
+
+/**
+ * @brief Gets the estimated cost of a test.
+ *
+ * @return 1: two comparisons.
+ */
+unsigned int	LevelRange::getCost() const
+{
+	return (1);
+}
+
+/**
+ * @brief Tells whether the decision only depends on the level and call site.
+ *
+ * @return True.
+ */
+bool	LevelRange::isStatic() const
+{
+	return (true);
+}
+
+} // !filter
+} // !log42
+
+/* ************************************************************************** */
+/*                                                                            */
+/*                                MIT License                                 */
+/*                                                                            */
+/*   Copyright (c) 2025 Demont Pieric, Lucken Bénédict                        */
+/*                                                                            */
+/*   Inspired by the Python 'logging' module by Vinay Sajip.                  */
+/*   This implementation was rewritten in C++98 and contains no original      */
+/*   Python source code.                                                      */
+/*                                                                            */
+/*   Permission is hereby granted, free of charge, to any person obtaining    */
+/*   a copy of this software and associated documentation files (the          */
+/*   "Software"), to deal in the Software without restriction, including      */
+/*   without limitation the rights to use, copy, modify, merge, publish,      */
+/*   distribute, sublicense, and/or sell copies of the Software, and to       */
+/*   permit persons to whom the Software is furnished to do so, subject to    */
+/*   the following conditions:                                                */
+/*                                                                            */
+/*   The above copyright notice and this permission notice shall be included  */
+/*   in all copies or substantial portions of the Software.                   */
+/*                                                                            */
+/*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS  */
+/*   OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF               */
+/*   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.   */
+/*   IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY     */
+/*   CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,     */
+/*   TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE        */
+/*   SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                   */
+/*                                                                            */
+/* ************************************************************************** */
@@ -17,6 +17,7 @@
 
 #include <common/common.hpp>
 #include <log42/LogRecord.hpp>
+#include <cstring>
 #include <ctime>
 #include <string>
 #include <sstream>
@@ -28,6 +29,31 @@ namespace log42
 namespace logRecord 
 {
 
+namespace
+{
+
+/**
+ * @brief Tells whether a message has a "%%" to collapse.
+ *
+ * @param msg The message.
+ * @return True if the message contains "%%".
+ */
+bool	hasEscape(const StringRef &msg)
+{
+	const char *end = msg.data() + msg.size();
+	for (const char *p = msg.data(); p + 1 < end; ++p)
+	{
+		p = static_cast<const char *>(std::memchr(p, '%', end - p));
+		if (!p || p + 1 >= end)
+			return (false);
+		if (p[1] == '%')
+			return (true);
+	}
+	return (false);
+}
+
+} // !namespace
+
 /**
  * @brief Converts a log level enum to its string representation.
  *
@@ -35,6 +61,17 @@ namespace logRecord
  * @return The string representation of the log level.
  */
 std::string	levelToString(e_LogLevel level)
+{
+	return (levelName(level));
+}
+
+/**
+ * @brief Returns the statically allocated name of a log level.
+ *
+ * @param level The log level.
+ * @return The name of the log level.
+ */
+const char	*levelName(e_LogLevel level)
 {
 	switch (level)
 	{
@@ -62,6 +99,52 @@ clock_t	&LogRecord::getStartTime()
 	return (_startTime);
 }
 
+/**
+ * @brief Header size the record layout is designed around.
+ */
+static const std::size_t	headerSize = 64;
+
+/**
+ * @brief Compile-time check that the header fits in a single cache line.
+ *
+ * The inline buffer is the last member, so the header is everything before
+ * it, padding included: the record size less the inline capacity. offsetof
+ * is not usable on a non-POD class in C++98.
+ */
+typedef char	t_headerFitsCacheLine[(sizeof(LogRecord) - LogRecord::inlineCapacity <= headerSize) ? 1 : -1];
+
+/**
+ * @brief Constructs a LogRecord object for an interned call site.
+ *
+ * @param name Logger name.
+ * @param level Log level.
+ * @param site Interned call site of the logging statement.
+ * @param msg Log message.
+ * @param args Optional arguments for the message.
+ * @param fields Optional structured fields.
+ */
+LogRecord::LogRecord(const StringRef &name,
+					 const e_LogLevel level,
+					 const CallSite *site,
+					 const StringRef &msg, 
+					 const Args &args,
+					 const Fields &fields)
+					 : _site(site),
+					 _data(this->_inline),
+					 _created(utils::nowSec()),
+					 _relativeCreated(utils::relativeSec(this->_startTime)),
+					 _msecs(utils::nowMilli()),
+					 _size(0),
+					 _capacity(inlineCapacity),
+					 _levelNo(level),
+					 _msgLen(0),
+					 _argc(0),
+					 _fieldc(0),
+					 _storage(STORAGE_INLINE)
+{
+	this->_init(name, msg, args, fields);
+}
+
 /**
  * @brief Constructs a LogRecord object with all metadata.
  *
@@ -73,44 +156,54 @@ clock_t	&LogRecord::getStartTime()
  * @param args Optional arguments for the message.
  * @param func Function name (optional).
  */
-LogRecord::LogRecord(const std::string &name,
+LogRecord::LogRecord(const StringRef &name,
 					 const e_LogLevel level,
 					 const std::string &pathname, 
 					 const int lineNo, 
-					 const std::string &msg, 
-					 const t_args *args, 
+					 const StringRef &msg, 
+					 const Args &args, 
 					 const std::string &func)
-					 : _name(name), 
-					 _msg(msg),
-					 _args(args ? *args : std::vector<std::string>()),
-					 _levelNo(level),
-					 _levelName(levelToString(level)),
-					 _pathname(pathname),
-					 _filename(utils::filenameNoPath(pathname)),
-					 _module(utils::filenameNoExt(this->_filename, ".cpp")),
-					 _lineNo(lineNo),
-					 _funcName(func),
+					 : _site(CallSite::get(pathname.c_str(), lineNo, func.c_str())),
+					 _data(this->_inline),
 					 _created(utils::nowSec()),
-					 _msecs(utils::nowMilli()),
 					 _relativeCreated(utils::relativeSec(this->_startTime)),
-					 _asctime("") {}
+					 _msecs(utils::nowMilli()),
+					 _size(0),
+					 _capacity(inlineCapacity),
+					 _levelNo(level),
+					 _msgLen(0),
+					 _argc(0),
+					 _fieldc(0),
+					 _storage(STORAGE_INLINE)
+{
+	this->_init(name, msg, args, Fields());
+}
 
 /**
- * @brief Destructor for LogRecord.
+ * @brief Destructor for LogRecord. Releases the spilled payload, if any.
  */
-LogRecord::~LogRecord() {}
+LogRecord::~LogRecord()
+{
+	this->_release();
+}
 
 /**
  * @brief Copy constructor for LogRecord.
  *
+ * Only the used part of the payload is copied; the copy stays inline whenever
+ * the payload fits and spills into the global pool otherwise, since a copy may
+ * outlive the dispatch or move to another thread.
+ *
  * @param rhs The LogRecord to copy.
  */
 LogRecord::LogRecord(const LogRecord &rhs) 
-	: _name(rhs._name), _msg(rhs._msg), _args(rhs._args), _levelNo(rhs._levelNo), 
-	_levelName(rhs._levelName), _pathname(rhs._pathname), _filename(rhs._filename),
-	_module(rhs._module), _lineNo(rhs._lineNo), _funcName(rhs._funcName),
-	_created(rhs._created), _msecs(rhs._msecs), _relativeCreated(rhs._relativeCreated), 
-	_asctime(rhs._asctime) {}
+	: _site(rhs._site), _data(this->_inline), _created(rhs._created),
+	_relativeCreated(rhs._relativeCreated), _msecs(rhs._msecs), _size(0),
+	_capacity(inlineCapacity), _levelNo(rhs._levelNo), _msgLen(rhs._msgLen),
+	_argc(rhs._argc), _fieldc(rhs._fieldc), _storage(STORAGE_INLINE)
+{
+	this->_append(rhs._data, rhs._size);
+}
 
 /**
  * @brief Assignment operator for LogRecord.
@@ -122,24 +215,121 @@ LogRecord	&LogRecord::operator=(const LogRecord &rhs)
 {
 	if (this != &rhs)
 	{
-		this->_name = rhs._name;
-		this->_msg = rhs._msg;
-		this->_args = rhs._args;
-		this->_levelNo = rhs._levelNo;
-		this->_levelName = rhs._levelName;
-		this->_pathname = rhs._pathname;
-		this->_filename = rhs._filename;
-		this->_module = rhs._module;
-		this->_lineNo = rhs._lineNo;
-		this->_funcName = rhs._funcName;
+		this->_site = rhs._site;
 		this->_created = rhs._created;
-		this->_msecs = rhs._msecs;
 		this->_relativeCreated = rhs._relativeCreated;
-		this->_asctime = rhs._asctime;
+		this->_msecs = rhs._msecs;
+		this->_levelNo = rhs._levelNo;
+		this->_msgLen = rhs._msgLen;
+		this->_argc = rhs._argc;
+		this->_fieldc = rhs._fieldc;
+		this->_size = 0;
+		this->_append(rhs._data, rhs._size);
 	}
 	return (*this);
 }
 
+/**
+ * @brief Packs the message, logger name, fields and arguments into the
+ * payload.
+ *
+ * The message and the name are NUL-terminated so they can be handed out
+ * directly; the fields and the arguments follow in their typed encoding and
+ * are only turned into text when they are formatted.
+ *
+ * @param name Logger name.
+ * @param msg Log message.
+ * @param args Arguments for the message.
+ * @param fields Structured fields.
+ */
+void	LogRecord::_init(const StringRef &name, const StringRef &msg, const Args &args, const Fields &fields)
+{
+	std::size_t total = msg.size() + name.size() + 2 + fields.encodedSize();
+	for (std::size_t i = 0; i < args.size(); ++i)
+		total += args[i].encodedSize();
+	this->_reserve(total, true);
+
+	this->_msgLen = msg.size();
+	this->_append(msg.data(), msg.size());
+	this->_append("", 1);
+	this->_append(name.data(), name.size());
+	this->_append("", 1);
+	this->_size = fields.encode(this->_data + this->_size) - this->_data;
+	this->_fieldc = fields.size();
+	for (std::size_t i = 0; i < args.size(); ++i)
+	{
+		Arg arg = args[i];
+		char *end = arg.encode(this->_data + this->_size);
+		this->_size = end - this->_data;
+		++this->_argc;
+	}
+}
+
+/**
+ * @brief Ensures the payload can hold at least len bytes, spilling out of the
+ * inline buffer when it is too small.
+ *
+ * Transient payloads go to the thread's arena when a dispatch scope is open;
+ * everything else goes to the global pool.
+ *
+ * @param len Required payload capacity in bytes.
+ * @param transient True if the record does not outlive the current scope.
+ */
+void	LogRecord::_reserve(std::size_t len, bool transient)
+{
+	if (len <= this->_capacity)
+		return ;
+
+	std::size_t capacity = this->_capacity * 2;
+	if (capacity < len)
+		capacity = len;
+
+	arena::Arena &local = arena::Arena::local();
+	char *data;
+	unsigned char storage;
+	if (transient && local.isActive())
+	{
+		data = static_cast<char *>(local.allocate(capacity));
+		storage = STORAGE_ARENA;
+	}
+	else
+	{
+		data = static_cast<char *>(arena::Pool::allocate(capacity));
+		storage = STORAGE_POOL;
+	}
+	std::memcpy(data, this->_data, this->_size);
+	this->_release();
+	this->_data = data;
+	this->_capacity = capacity;
+	this->_storage = storage;
+}
+
+/**
+ * @brief Releases a payload stored in the global pool. Arena payloads are
+ * reclaimed with their scope.
+ */
+void	LogRecord::_release()
+{
+	if (this->_storage == STORAGE_POOL)
+		arena::Pool::deallocate(this->_data, this->_capacity);
+}
+
+/**
+ * @brief Appends raw bytes to the payload.
+ *
+ * @param data Bytes to append.
+ * @param len Number of bytes.
+ * @return Pointer to the appended bytes inside the payload.
+ */
+char	*LogRecord::_append(const char *data, std::size_t len)
+{
+	this->_reserve(this->_size + len);
+	char *dst = this->_data + this->_size;
+	std::memcpy(dst, data, len);
+	this->_size += len;
+	return (dst);
+}
+
 /**
  * @brief Returns a string representation of the log record.
  *
@@ -150,44 +340,154 @@ std::string	LogRecord::toString() const
 	std::ostringstream oss;
 
 	oss << "<LogRecord: "
-		<< this->_name << ", "
+		<< this->getName() << ", "
 		<< this->_levelNo << ", "
-		<< this->_pathname << ", "
-		<< this->_lineNo << ", \""
-		<< this->_msg << "\">";
+		<< this->getPathname() << ", "
+		<< this->getLineNo() << ", \""
+		<< std::string(this->_data, this->_msgLen) << "\">";
 	return (oss.str());
 }
 
+/**
+ * @brief Gets the interned call site the record was emitted from.
+ *
+ * @return Pointer to the call site.
+ */
+const CallSite	*LogRecord::getCallSite() const
+{
+	return (this->_site);
+}
+
 /**
  * @brief Gets the logger name.
  *
  * @return Logger name.
  */
-const std::string	&LogRecord::getName() const
+const char	*LogRecord::getName() const
 {
-	return (this->_name);
+	return (this->_data + this->_msgLen + 1);
 }
 
 /**
  * @brief Gets the log message, substituting arguments if present.
  *
+ * Each "%d", "%f", "%x" or "%s" of the message is replaced, left to right,
+ * by the next argument and "%%" by a single '%'. Conversions left once the
+ * arguments are exhausted are kept verbatim.
+ *
  * @return The formatted log message.
  */
 std::string	LogRecord::getMessage() const
 {
-	if (this->_args.empty())
-		return (this->_msg);
+	this->_render();
+	return (std::string(this->_data, this->_msgLen));
+}
 
-	std::string result = this->_msg;
+/**
+ * @brief Gets the log message, with its arguments substituted, without
+ * copying it.
+ *
+ * @return Reference to the message, valid until the record is modified or
+ * destroyed.
+ */
+StringRef	LogRecord::getMessageRef() const
+{
+	this->_render();
+	return (StringRef(this->_data, this->_msgLen));
+}
 
-	std::size_t pos = 0;
-	t_args::const_iterator it;
-	for (it = this->_args.begin(); it != this->_args.end() && (pos = result.find("%s", pos)) != std::string::npos; ++it)
-	{
-		result.replace(pos, 2, *it);
-		pos += it->size();
-	}
-	return (result);
+/**
+ * @brief Appends the log message, with its arguments substituted, to a
+ * dispatch buffer.
+ *
+ * @param out The buffer to append to.
+ */
+void	LogRecord::appendMessage(arena::t_string &out) const
+{
+	this->_render();
+	out.append(this->_data, this->_msgLen);
+}
+
+/**
+ * @brief Substitutes the arguments into the message, once per record.
+ *
+ * The rendered message replaces the message and the arguments in the
+ * payload, so every later handler, and the error path, reuse it as is; the
+ * fields are carried over unchanged. The message is rendered with the
+ * template cached by the call site when it logs this exact text, and
+ * scanned directly otherwise. A message without arguments is only rendered
+ * if it has a "%%" to collapse, so it prints the same with or without them.
+ */
+void	LogRecord::_render() const
+{
+	StringRef msg(this->_data, this->_msgLen);
+	if (this->_argc == 0 && !hasEscape(msg))
+		return ;
+
+	const char *name = this->getName();
+	std::size_t nameLen = std::strlen(name);
+	const char *fields = name + nameLen + 1;
+	const char *args = fields;
+	const char *key;
+	Arg value;
+	for (unsigned short i = 0; i < this->_fieldc; ++i)
+		args = Fields::decode(args, key, value);
+
+	arena::Scope scope;
+	arena::t_string rendered;
+	const MessageTemplate *tmpl = this->_site ? this->_site->getTemplate(msg) : NULL;
+	if (tmpl)
+		tmpl->render(args, this->_argc, rendered);
+	else
+		MessageTemplate::renderText(msg, args, this->_argc, rendered);
+	std::size_t msgLen = rendered.size();
+	rendered.push_back('\0');
+	rendered.append(name, nameLen + 1);
+	rendered.append(fields, args - fields);
+
+	LogRecord *self = const_cast<LogRecord *>(this);
+	self->_size = 0;
+	self->_reserve(rendered.size());
+	self->_append(rendered.data(), rendered.size());
+	self->_msgLen = msgLen;
+	self->_argc = 0;
+}
+
+/**
+ * @brief Gets the number of structured fields of the record.
+ *
+ * @return The number of fields.
+ */
+std::size_t	LogRecord::getFieldCount() const
+{
+	return (this->_fieldc);
+}
+
+/**
+ * @brief Gets the structured fields of the record, in their encoded form.
+ *
+ * Walk them with Fields::decode(), getFieldCount() times; the call's own
+ * fields come first, then those of the logger.
+ *
+ * @return Start of the encoded fields, valid until the record is modified
+ * or destroyed.
+ */
+const char	*LogRecord::getFields() const
+{
+	const char *name = this->getName();
+	return (name + std::strlen(name) + 1);
+}
+
+/**
+ * @brief Looks up a structured field of the record.
+ *
+ * @param key The name of the field.
+ * @param value Receives the value; a string borrows the record's payload.
+ * @return True if the record has the field.
+ */
+bool	LogRecord::getField(const StringRef &key, Arg &value) const
+{
+	return (this->_fieldc && Fields::find(this->getFields(), this->_fieldc, key, value));
 }
 
 /**
@@ -205,9 +505,9 @@ const e_LogLevel	&LogRecord::getLevelNo() const
  *
  * @return Log level name.
  */
-const std::string	&LogRecord::getLevelName() const
+const char	*LogRecord::getLevelName() const
 {
-	return (this->_levelName);
+	return (levelName(this->_levelNo));
 }
 
 /**
@@ -215,9 +515,9 @@ const std::string	&LogRecord::getLevelName() const
  *
  * @return Pathname.
  */
-const std::string	&LogRecord::getPathname() const
+const char	*LogRecord::getPathname() const
 {
-	return (this->_pathname);
+	return (this->_site->getPathname());
 }
 
 /**
@@ -225,9 +525,9 @@ const std::string	&LogRecord::getPathname() const
  *
  * @return Filename.
  */
-const std::string	&LogRecord::getFilename() const
+const char	*LogRecord::getFilename() const
 {
-	return (this->_filename);
+	return (this->_site->getFilename());
 }
 
 /**
@@ -235,9 +535,9 @@ const std::string	&LogRecord::getFilename() const
  *
  * @return Module name.
  */
-const std::string	&LogRecord::getModule() const
+const char	*LogRecord::getModule() const
 {
-	return (this->_module);
+	return (this->_site->getModule());
 }
 
 /**
@@ -247,7 +547,7 @@ const std::string	&LogRecord::getModule() const
  */
 const int	&LogRecord::getLineNo() const
 {
-	return (this->_lineNo);
+	return (this->_site->getLineNo());
 }
 
 /**
@@ -255,9 +555,9 @@ const int	&LogRecord::getLineNo() const
  *
  * @return Function name.
  */
-const std::string	&LogRecord::getFuncName() const
+const char	*LogRecord::getFuncName() const
 {
-	return (this->_funcName);
+	return (this->_site->getFuncName());
 }
 
 /**
@@ -290,26 +590,6 @@ const double	&LogRecord::getRelativeCreated() const
 	return (this->_relativeCreated);
 }
 
-/**
- * @brief Gets the formatted time string.
- *
- * @return Asctime string.
- */
-const std::string	&LogRecord::getAsctime() const
-{
-	return (this->_asctime);
-}
-
-/**
- * @brief Sets the formatted time string.
- *
- * @param asctime The formatted time string.
- */
-void	LogRecord::setAsctime(const std::string &asctime)
-{
-	this->_asctime = asctime;
-}
-
 } //!logRecord
 } //!log42
 
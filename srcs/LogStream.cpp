@@ -0,0 +1,185 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   LogStream.cpp                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: pdemont <pdemont@student.42lausanne.ch>    +#+  +:+       +#+        */
+/*   By: blucken <blucken@student.42lausanne.ch>  +#+#+#+#+#+   +#+           */
+/*                                                     #+#    #+#             */
+/*   Created: 2026/10/18                              ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+/**
+ * @file LogStream.cpp
+ * @brief Implements the LogStream class.
+ */ 
+
+#include <log42/LogStream.hpp>
+#include <new>
+
+namespace log42
+{
+
+namespace
+{
+
+/**
+ * @brief Stream buffer appending to a string drawn from the thread's arena.
+ */
+class StreamBuffer : public std::streambuf
+{
+	public:
+		StreamBuffer() : std::streambuf(), _text() {}
+
+		/**
+		 * @brief Gets the text written so far.
+		 *
+		 * @return Reference to the text, valid while the buffer lives.
+		 */
+		StringRef	text() const
+		{
+			return (StringRef(this->_text.data(), this->_text.size()));
+		}
+
+	protected:
+		/**
+		 * @brief Appends a single character.
+		 *
+		 * @param c The character, or EOF.
+		 * @return The character, or a value other than EOF for EOF.
+		 */
+		int_type	overflow(int_type c)
+		{
+			if (!traits_type::eq_int_type(c, traits_type::eof()))
+				this->_text.push_back(traits_type::to_char_type(c));
+			return (traits_type::not_eof(c));
+		}
+
+		/**
+		 * @brief Appends a run of characters.
+		 *
+		 * @param s The characters.
+		 * @param n Their number.
+		 * @return n.
+		 */
+		std::streamsize	xsputn(const char *s, std::streamsize n)
+		{
+			this->_text.append(s, static_cast<std::size_t>(n));
+			return (n);
+		}
+
+	private:
+		arena::t_string	_text;
+};
+
+} // !namespace
+
+/**
+ * @brief Opens the stream of a logging statement if the call is logged.
+ *
+ * @param logger The logger to log to.
+ * @param level The log level.
+ * @param filename Source file name.
+ * @param lineNo Source line number.
+ * @param funcName Function name.
+ */
+LogStream::LogStream(logger::Logger *logger, const logRecord::e_LogLevel level,
+					const char *filename, int lineNo, const char *funcName)
+	: _logger(logger), _level(level), _site(NULL), _scope(), _buffer(NULL), _stream(NULL)
+{
+	if (!logger->isEnabledFor(level))
+		return ;
+	this->_site = logRecord::CallSite::get(filename, lineNo, funcName);
+	if (!logger->_sample(level, this->_site))
+		return ;
+
+	arena::Arena &local = arena::Arena::local();
+	this->_buffer = new (local.allocate(sizeof(StreamBuffer))) StreamBuffer();
+	this->_stream = new (local.allocate(sizeof(std::ostream))) std::ostream(this->_buffer);
+}
+
+/**
+ * @brief Destructor for LogStream; discards a message that was not flushed.
+ */
+LogStream::~LogStream()
+{
+	this->_close();
+}
+
+/**
+ * @brief Tells whether the message is still to be built and logged.
+ *
+ * @return True until flush() if the call is logged, false otherwise.
+ */
+bool	LogStream::isOpen() const
+{
+	return (this->_stream != NULL);
+}
+
+/**
+ * @brief Gets the stream the message is written to.
+ *
+ * @return Reference to the stream; only valid while isOpen() is true.
+ */
+std::ostream	&LogStream::stream()
+{
+	return (*this->_stream);
+}
+
+/**
+ * @brief Logs the message written so far and closes the stream.
+ */
+void	LogStream::flush()
+{
+	if (!this->_stream)
+		return ;
+	this->_logger->_emit(this->_level, this->_site, static_cast<StreamBuffer *>(this->_buffer)->text(), Args());
+	this->_close();
+}
+
+/**
+ * @brief Destroys the stream and its buffer; their memory goes back to the
+ * arena with the scope.
+ */
+void	LogStream::_close()
+{
+	if (!this->_stream)
+		return ;
+	this->_stream->~basic_ostream();
+	static_cast<StreamBuffer *>(this->_buffer)->~StreamBuffer();
+	this->_stream = NULL;
+	this->_buffer = NULL;
+}
+
+} // !log42
+
+/* ************************************************************************** */
+/*                                                                            */
+/*                                MIT License                                 */
+/*                                                                            */
+/*   Copyright (c) 2025 Demont Pieric, Lucken Bénédict                        */
+/*                                                                            */
+/*   Inspired by the Python 'logging' module by Vinay Sajip.                  */
+/*   This implementation was rewritten in C++98 and contains no original      */
+/*   Python source code.                                                      */
+/*                                                                            */
+/*   Permission is hereby granted, free of charge, to any person obtaining    */
+/*   a copy of this software and associated documentation files (the          */
+/*   "Software"), to deal in the Software without restriction, including      */
+/*   without limitation the rights to use, copy, modify, merge, publish,      */
+/*   distribute, sublicense, and/or sell copies of the Software, and to       */
+/*   permit persons to whom the Software is furnished to do so, subject to    */
+/*   the following conditions:                                                */
+/*                                                                            */
+/*   The above copyright notice and this permission notice shall be included  */
+/*   in all copies or substantial portions of the Software.                   */
+/*                                                                            */
+/*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS  */
+/*   OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF               */
+/*   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.   */
+/*   IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY     */
+/*   CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,     */
+/*   TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE        */
+/*   SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                   */
+/*                                                                            */
+/* ************************************************************************** */
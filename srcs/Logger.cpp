@@ -15,20 +15,69 @@
  * @brief Implements the Logger class for hierarchical logging.
  */ 
 
+#include <log42/Fields.hpp>
 #include <log42/Filterer.hpp>
 #include <log42/Logger.hpp>
 #include <log42/LogRecord.hpp>
 #include <log42/Manager.hpp>
 #include <log42/Node.hpp>
+#include <log42/Sync.hpp>
 #include <log42/types.hpp>
+#include <cstring>
 #include <iostream>
-#include <map>
 
 namespace log42
 {
 namespace logger
 {
 
+namespace
+{
+
+/**
+ * @brief Bits of the level cache per level: whether the level is known, then
+ * whether it is enabled.
+ */
+const unsigned int	cacheLevelBits = 2;
+
+/**
+ * @brief Bit marking a level as known in its cache entry.
+ */
+const unsigned long	cacheKnown = 1;
+
+/**
+ * @brief Bit marking a level as enabled in its cache entry.
+ */
+const unsigned long	cacheEnabled = 2;
+
+/**
+ * @brief Bits of the level cache holding the per-level entries; the cache
+ * generation they were computed under fills the remaining bits.
+ */
+const unsigned int	cacheEntryBits = cacheLevelBits * (logRecord::CRITICAL + 1);
+
+/**
+ * @brief Mask of the per-level entries of the level cache.
+ */
+const unsigned long	cacheEntryMask = (1UL << cacheEntryBits) - 1;
+
+/**
+ * @brief Estimates the memory held by a non-shared set: its header and one
+ * tree node (three links and a color) per element.
+ *
+ * @param count The number of elements.
+ * @return Size in bytes, 0 for an empty set.
+ */
+template <typename T>
+std::size_t	setFootprint(std::size_t count)
+{
+	if (count == 0)
+		return (0);
+	return (sizeof(T) + count * (4 * sizeof(void *) + sizeof(typename T::value_type)));
+}
+
+} // !namespace
+
 /**
  * @brief Constructs a Logger with the given name and log level.
  *
@@ -36,8 +85,8 @@ namespace logger
  * @param level The log level for this logger.
  */
 Logger::Logger(const std::string &name, const logRecord::e_LogLevel level) 
-	: Node(name), filterer::Filterer(), _level(level), _propagate(true),
-	_handlers(), _disabled(false), _cache(), _manager(manager::Manager::getInstance()) {}
+	: Node(name, Node::LOGGER), filterer::Filterer(), _level(level), _propagate(true),
+	_handlers(), _sampling(), _extra(), _disabled(false), _cache(0), _references(0), _reclaimState(RECLAIM_IN_USE) {}
 
 /**
  * @brief Destructor for Logger.
@@ -51,7 +100,7 @@ Logger::~Logger() {}
  */
 Logger::Logger(const Logger &rhs)
 	: Node(rhs), filterer::Filterer(), _level(rhs._level), _propagate(rhs._propagate), 
-	_handlers(rhs._handlers), _disabled(rhs._disabled), _cache(rhs._cache), _manager(rhs._manager) {}
+	_handlers(rhs._handlers), _sampling(rhs._sampling), _extra(rhs._extra), _disabled(rhs._disabled), _cache(0), _references(0), _reclaimState(RECLAIM_IN_USE) {}
 
 /**
  * @brief Assignment operator for Logger.
@@ -65,11 +114,13 @@ Logger &Logger::operator=(const Logger &rhs)
 	{
 		Node::operator=(rhs);
 		filterer::Filterer::operator=(rhs);
-		this->_level = rhs._level;
-		this->_propagate = rhs._propagate;
+		sync::store(this->_level, sync::load(rhs._level));
+		sync::store(this->_propagate, sync::load(rhs._propagate));
 		this->_handlers = rhs._handlers;
-		this->_disabled = rhs._disabled;
-		this->_cache = rhs._cache;
+		this->_sampling = rhs._sampling;
+		this->_extra = rhs._extra;
+		sync::store(this->_disabled, sync::load(rhs._disabled));
+		this->clearCache();
 	}
 	return (*this);
 }
@@ -81,8 +132,8 @@ Logger &Logger::operator=(const Logger &rhs)
  */
 void	Logger::setLevel(const logRecord::e_LogLevel level)
 {
-	this->_level = level;
-	this->_manager.clearCache();
+	sync::store(this->_level, level);
+	manager::Manager::getInstance().clearCache();
 }
 
 /**
@@ -92,7 +143,88 @@ void	Logger::setLevel(const logRecord::e_LogLevel level)
  */
 void	Logger::setPropagate(bool propagate)
 {
-	this->_propagate = propagate;
+	sync::store(this->_propagate, propagate);
+}
+
+/**
+ * @brief Samples the records of this logger up to a level.
+ *
+ * Records above that level are all kept. A null sampler removes sampling.
+ *
+ * @param sampler The sampler deciding which records are kept.
+ * @param upTo The highest level sampled.
+ */
+void	Logger::setSampler(const common::core::raii::SharedPtr<filter::Sampler> &sampler, const logRecord::e_LogLevel upTo)
+{
+	sync::Published<Sampling>::Writer sampling(this->_sampling);
+	sampling->sampler = sampler;
+	sampling->upTo = upTo;
+	sampling.commit();
+}
+
+/**
+ * @brief Gets the sampler of this logger.
+ *
+ * @return The sampler, or a null pointer if the logger is not sampled.
+ */
+common::core::raii::SharedPtr<filter::Sampler>	Logger::getSampler() const
+{
+	sync::Epoch::Guard guard;
+	sync::ScopedLock lock(sync::referenceLock());
+	return (this->_sampling.get().sampler);
+}
+
+/**
+ * @brief Sets a field added to every record of this logger, replacing a
+ * field with the same key.
+ *
+ * The key and a string value are copied.
+ *
+ * @param key The name of the field.
+ * @param value The value of the field.
+ */
+void	Logger::setField(const StringRef &key, const Arg &value)
+{
+	sync::Published<Extra>::Writer extra(this->_extra);
+	_dropField(*extra, key);
+	std::size_t at = extra->fields.size();
+	extra->fields.resize(at + Fields::encodedSize(key, value));
+	Fields::encode(&extra->fields[at], key, value);
+	++extra->count;
+	extra.commit();
+}
+
+/**
+ * @brief Removes a field of this logger.
+ *
+ * @param key The name of the field.
+ */
+void	Logger::removeField(const StringRef &key)
+{
+	sync::Published<Extra>::Writer extra(this->_extra);
+	_dropField(*extra, key);
+	extra.commit();
+}
+
+/**
+ * @brief Removes all the fields of this logger.
+ */
+void	Logger::clearFields()
+{
+	sync::Published<Extra>::Writer extra(this->_extra);
+	*extra = Extra();
+	extra.commit();
+}
+
+/**
+ * @brief Gets the number of fields of this logger.
+ *
+ * @return The number of fields.
+ */
+std::size_t	Logger::getFieldCount() const
+{
+	sync::Epoch::Guard guard;
+	return (this->_extra.get().count);
 }
 
  /**
@@ -104,7 +236,7 @@ void	Logger::setPropagate(bool propagate)
  * @param funcName Function name.
  * @param args Optional arguments.
  */
-void	Logger::debug(const std::string &msg, const std::string filename, int lineNo, const std::string funcName, const t_args *args)
+void	Logger::debug(const StringRef &msg, const char *filename, int lineNo, const char *funcName, const Args &args)
 {
 	if (this->isEnabledFor(logRecord::DEBUG))
 		this->_log(logRecord::DEBUG, msg, args, filename, lineNo, funcName);
@@ -119,7 +251,7 @@ void	Logger::debug(const std::string &msg, const std::string filename, int lineN
  * @param funcName Function name.
  * @param args Optional arguments.
  */
-void	Logger::info(const std::string &msg, const std::string filename, int lineNo, const std::string funcName, const t_args *args)
+void	Logger::info(const StringRef &msg, const char *filename, int lineNo, const char *funcName, const Args &args)
 {
    if (this->isEnabledFor(logRecord::INFO))
 	   this->_log(logRecord::INFO, msg, args, filename, lineNo, funcName);
@@ -134,7 +266,7 @@ void	Logger::info(const std::string &msg, const std::string filename, int lineNo
  * @param funcName Function name.
  * @param args Optional arguments.
  */
-void	Logger::warning(const std::string &msg, const std::string filename, int lineNo, const std::string funcName, const t_args *args)
+void	Logger::warning(const StringRef &msg, const char *filename, int lineNo, const char *funcName, const Args &args)
 {
    if (this->isEnabledFor(logRecord::WARNING))
 	   this->_log(logRecord::WARNING, msg, args, filename, lineNo, funcName);
@@ -149,7 +281,7 @@ void	Logger::warning(const std::string &msg, const std::string filename, int lin
  * @param funcName Function name.
  * @param args Optional arguments.
  */
-void	Logger::error(const std::string &msg, const std::string filename, int lineNo, const std::string funcName, const t_args *args)
+void	Logger::error(const StringRef &msg, const char *filename, int lineNo, const char *funcName, const Args &args)
 {
    if (this->isEnabledFor(logRecord::ERROR))
 	   this->_log(logRecord::ERROR, msg, args, filename, lineNo, funcName);
@@ -164,7 +296,7 @@ void	Logger::error(const std::string &msg, const std::string filename, int lineN
  * @param funcName Function name.
  * @param args Optional arguments.
  */
-void	Logger::exception(const std::string &msg, const std::string filename, int lineNo, const std::string funcName, const t_args *args)
+void	Logger::exception(const StringRef &msg, const char *filename, int lineNo, const char *funcName, const Args &args)
 {
    if (this->isEnabledFor(logRecord::ERROR))
 	   this->_log(logRecord::ERROR, msg, args, filename, lineNo, funcName);
@@ -179,7 +311,7 @@ void	Logger::exception(const std::string &msg, const std::string filename, int l
  * @param funcName Function name.
  * @param args Optional arguments.
  */
-void	Logger::critical(const std::string &msg, const std::string filename, int lineNo, const std::string funcName, const t_args *args)
+void	Logger::critical(const StringRef &msg, const char *filename, int lineNo, const char *funcName, const Args &args)
 {
    if (this->isEnabledFor(logRecord::CRITICAL))
 	   this->_log(logRecord::CRITICAL, msg, args, filename, lineNo, funcName);
@@ -195,12 +327,30 @@ void	Logger::critical(const std::string &msg, const std::string filename, int li
  * @param funcName Function name.
  * @param args Optional arguments.
  */
-void	Logger::log(const logRecord::e_LogLevel level, const std::string &msg, const std::string filename, int lineNo, const std::string funcName, const t_args *args)
+void	Logger::log(const logRecord::e_LogLevel level, const StringRef &msg, const char *filename, int lineNo, const char *funcName, const Args &args)
 {
 	if (this->isEnabledFor(level))
 		this->_log(level, msg, args, filename, lineNo, funcName);
 }
 
+/**
+ * @brief Logs a message with a specified log level and structured fields.
+ *
+ * @param level The log level.
+ * @param msg The message to log.
+ * @param filename Source file name.
+ * @param lineNo Source line number.
+ * @param funcName Function name.
+ * @param fields Fields of the record.
+ * @param args Optional arguments.
+ */
+void	Logger::log(const logRecord::e_LogLevel level, const StringRef &msg, const char *filename, int lineNo, const char *funcName,
+					const Fields &fields, const Args &args)
+{
+	if (this->isEnabledFor(level))
+		this->_log(level, msg, args, filename, lineNo, funcName, fields);
+}
+
 /**
  * @brief Handles a log record: applies filters and calls handlers.
  *
@@ -208,13 +358,24 @@ void	Logger::log(const logRecord::e_LogLevel level, const std::string &msg, cons
  */
 void	Logger::handle(logRecord::LogRecord &record)
 {
-	if (this->_disabled)
+	if (sync::load(this->_disabled))
 		return ;
 	if (!this->filter(record))
 		return ;
 	this->callHandlers(record);
 }
 
+/**
+ * @brief Handles a summary record of a predicate of this logger, which goes
+ * to the handlers of the logger and of its ancestors like its records.
+ *
+ * @param record The summary record.
+ */
+void	Logger::_handleSummary(logRecord::LogRecord &record)
+{
+	this->handle(record);
+}
+
 /**
  * @brief Adds a handler to this logger.
  *
@@ -224,7 +385,9 @@ void	Logger::addHandler(const common::core::raii::SharedPtr<handler::Handler> &h
 {
 	if (!handler)
 		return ;
-	this->_handlers.insert(handler);
+	sync::Published<t_handlers>::Writer handlers(this->_handlers);
+	handlers->insert(handler);
+	handlers.commit();
 }
 
 /**
@@ -236,7 +399,9 @@ void	Logger::removeHandler(const common::core::raii::SharedPtr<handler::Handler>
 {
 	if (!handler)
 		return ;
-	this->_handlers.erase(handler);
+	sync::Published<t_handlers>::Writer handlers(this->_handlers);
+	handlers->erase(handler);
+	handlers.commit();
 }
 
 /**
@@ -246,15 +411,16 @@ void	Logger::removeHandler(const common::core::raii::SharedPtr<handler::Handler>
  */
 bool	Logger::hasHandler() const
 {
+	sync::Epoch::Guard guard;
 	const Logger *c = this;
 	while (c)
 	{
-		if (!c->_handlers.empty())
+		if (!c->_handlers.get().empty())
 			return (true);
-		if (!c->_propagate)
+		if (!sync::load(c->_propagate))
 			break ;
 		else
-			c = dynamic_cast<const Logger *>(c->getParent().get());
+			c = c->getParentLogger();
 	}
 	return false;
 }
@@ -262,33 +428,40 @@ bool	Logger::hasHandler() const
 /**
  * @brief Calls all handlers for this logger and its ancestors.
  *
+ * Each logger's handlers are read from its current snapshot, without
+ * locking or taking a reference, while other threads add or remove handlers.
+ * A replaced snapshot is destroyed once every thread inside such a read has
+ * left it.
+ *
  * @param record The log record to process.
  */
 void	Logger::callHandlers(logRecord::LogRecord &record)
 {
-	const Logger	*c = this;
-	bool			found = false;
+	sync::Epoch::Guard	guard;
+	const Logger		*c = this;
+	bool				found = false;
 
 	while (c)
 	{
-		t_handlers::iterator it;
-		for (it = c->_handlers.begin(); it != c->_handlers.end(); ++it)
+		const t_handlers &handlers = c->_handlers.get();
+		t_handlers::const_iterator it;
+		for (it = handlers.begin(); it != handlers.end(); ++it)
 		{
 			found = true;
 			if (record.getLevelNo() >= (*it)->getLevel())
 				(*it)->handle(record);
 		}
-		if (!c->_propagate)
+		if (!sync::load(c->_propagate))
 			break ;
-		c = dynamic_cast<const Logger *>(c->getParent().get());
+		c = c->getParentLogger();
 	}
 
 	if (!found)
 	{
-		if (this->_manager.getEmittedNoHandlerWarning())
+		if (manager::Manager::getInstance().getEmittedNoHandlerWarning())
 		{
 			std::cerr << "No handlers could be found for logger \"" << this->_name << std::endl;
-			_manager.setEmittedNoHandlerWarning(true);
+			manager::Manager::getInstance().setEmittedNoHandlerWarning(true);
 		}
 	}
 }
@@ -296,11 +469,13 @@ void	Logger::callHandlers(logRecord::LogRecord &record)
 /**
  * @brief Gets the set of handlers attached to this logger.
  *
- * @return Reference to the set of handler pointers.
+ * @return Copy of the current snapshot of handler pointers.
  */
-const t_handlers	&Logger::getHandlers() const
+t_handlers	Logger::getHandlers() const
 {
-	return (this->_handlers);
+	sync::Epoch::Guard guard;
+	sync::ScopedLock lock(sync::referenceLock());
+	return (this->_handlers.get());
 }
 
 /**
@@ -314,9 +489,10 @@ logRecord::e_LogLevel	Logger::getEffectiveLevel() const
 
 	while (logger)
 	{
-		if (logger->_level != logRecord::NOTSET)
-			return (logger->_level);
-		logger = dynamic_cast<const Logger *>(logger->getParent().get());
+		logRecord::e_LogLevel level = sync::load(logger->_level);
+		if (level != logRecord::NOTSET)
+			return (level);
+		logger = logger->getParentLogger();
 	}
 	return (logRecord::NOTSET);
 }
@@ -324,26 +500,39 @@ logRecord::e_LogLevel	Logger::getEffectiveLevel() const
 /**
  * @brief Checks if this logger is enabled for the specified log level.
  *
+ * The answer is cached in a single word tagged with the Manager's cache
+ * generation, so a hit is two loads and a compare. Threads filling the cache
+ * concurrently publish with a compare-and-swap, and an entry computed before
+ * a level change carries an outdated generation and is recomputed.
+ *
  * @param level The log level to check.
  * @return True if enabled, false otherwise.
  */
 bool	Logger::isEnabledFor(const logRecord::e_LogLevel level)
 {
-	if (this->_disabled)
+	if (sync::load(this->_disabled))
 		return (false);
-	
-	t_cache::const_iterator it = this->_cache.find(level);
-	if (it != this->_cache.end())
-		return (it->second);
+
+	unsigned long generation = manager::Manager::getCacheGeneration() << cacheEntryBits;
+	unsigned long cache = sync::load(this->_cache);
+	unsigned int shift = level * cacheLevelBits;
+	bool cacheable = level <= logRecord::CRITICAL;
+	bool current = (cache & ~cacheEntryMask) == generation;
+	if (cacheable && current && ((cache >> shift) & cacheKnown))
+		return (((cache >> shift) & cacheEnabled) != 0);
 
 	bool	is_enabled = false;
-	if (this->_manager.getDisable() >= level)
+	if (manager::Manager::getInstance().getDisable() >= level)
 		is_enabled = false;
 	else
 		is_enabled = (level >= this->getEffectiveLevel());
 
-	this->_cache[level] = is_enabled;
-
+	if (cacheable)
+	{
+		unsigned long entries = current ? (cache & cacheEntryMask) : 0;
+		entries |= (cacheKnown | (is_enabled ? cacheEnabled : 0)) << shift;
+		sync::compareAndSwap(this->_cache, cache, generation | entries);
+	}
 	return (is_enabled);
 }
 
@@ -356,52 +545,99 @@ bool	Logger::isEnabledFor(const logRecord::e_LogLevel level)
 common::core::raii::SharedPtr<Logger> Logger::getChild(const std::string &suffix) const
 { 
 	std::string fullname = suffix;
-	if (this != this->_manager.getRoot().get())
+	if (this != manager::Manager::getInstance().getRoot().get())
 		fullname = this->getName() + "." + suffix;
-	return (this->_manager.getLogger(fullname));
+	return (manager::Manager::getInstance().getLogger(fullname));
 }
 
 /**
  * @brief Gets the set of direct child loggers.
  *
+ * Follows the node's child links, so the cost depends on the number of
+ * children rather than on the size of the hierarchy. The children are
+ * retained, since the caller now holds references to them.
+ *
  * @return Set of pointers to child loggers.
  */
 t_loggers	Logger::getChildren() const
 {
 	t_loggers children;
-	t_loggerMap loggerMap = this->_manager.getLoggerMap();
-	t_loggerMap::const_iterator it;
+	sync::ScopedLock lock(manager::Manager::getInstance().getLock());
+	t_loggerMap &loggerMap = manager::Manager::getInstance().getLoggerMap();
 
-	for (it = loggerMap.begin(); it != loggerMap.end(); ++it)
+	for (Node *child = this->getFirstChild(); child; child = child->getNextSibling())
 	{
-		common::core::raii::SharedPtr<logger::Logger> alogger_sp = common::core::raii::dynamicPointerCast<logger::Logger>(it->second);
-		if (!alogger_sp)
+		t_loggerMap::iterator it = loggerMap.find(child->getName());
+		if (it == loggerMap.end())
 			continue ;
-		if (alogger_sp->getParent().get() != this)
-			continue ;
-
-		int hierLevel = 0;
-		const Node *parentIter = alogger_sp.get();
-		while (parentIter != this->_manager.getRoot().get())
-		{
-			parentIter = parentIter->getParent().get();
-			hierLevel++;
-		}
-
-		int selfLevel = 0;
-		parentIter = this;
-		while (parentIter != this->_manager.getRoot().get())
+		common::core::raii::SharedPtr<logger::Logger> alogger_sp = common::core::raii::dynamicPointerCast<logger::Logger>(it->second);
+		if (alogger_sp)
 		{
-			parentIter = parentIter->getParent().get();
-			selfLevel++;
-		}
-
-		if (hierLevel == selfLevel + 1)
+			alogger_sp->retain();
 			children.insert(alogger_sp);
+		}
 	}
 	return (children);
 }
 
+/**
+ * @brief Estimates the memory held by the logger.
+ *
+ * Empty handler and filter sets are shared by all loggers and cost nothing.
+ *
+ * @return Size in bytes of the object, its name and its own sets.
+ */
+std::size_t	Logger::getFootprint() const
+{
+	sync::Epoch::Guard guard;
+	return (sizeof(*this) + stringFootprint(this->getName())
+		+ setFootprint<t_handlers>(this->_handlers.get().size())
+		+ this->getFilterFootprint());
+}
+
+/**
+ * @brief Keeps the logger from being reclaimed until a matching release().
+ *
+ * Must be called with the Manager lock held, or on a logger that is already
+ * retained, so that no reclamation runs in between.
+ */
+void	Logger::retain()
+{
+	sync::fetchAdd(this->_references, 1UL);
+}
+
+/**
+ * @brief Drops a reference taken with retain().
+ */
+void	Logger::release()
+{
+	sync::fetchAdd(this->_references, static_cast<unsigned long>(-1));
+}
+
+/**
+ * @brief Checks whether the Manager may reclaim the logger.
+ *
+ * A logger is reclaimable when nothing would change if it were recreated
+ * later: it has no child logger, no handler, no filter, no sampler, no
+ * level of its own, propagates and is not disabled. It must also not be
+ * retained.
+ *
+ * @return true if the logger can be reclaimed, false otherwise.
+ */
+bool	Logger::isReclaimable() const
+{
+	sync::Epoch::Guard guard;
+	return (!this->getFirstChild()
+		&& sync::load(this->_references) == 0
+		&& sync::load(this->_level) == logRecord::NOTSET
+		&& sync::load(this->_propagate)
+		&& !sync::load(this->_disabled)
+		&& this->_handlers.get().empty()
+		&& this->_sampling.get().empty()
+		&& this->_extra.get().empty()
+		&& this->getFilterCount() == 0);
+}
+
 /**
  * @brief Returns a string representation of the logger.
  *
@@ -413,40 +649,119 @@ std::string Logger::toString() const
 }
 
 /**
- * @brief Internal method to log a message at a given level.
+ * @brief Marks the logger as looked up, so that the next reclaim() keeps it.
+ *
+ * @return False if the logger is being reclaimed and must not be handed out.
+ */
+bool	Logger::_touch()
+{
+	if (sync::load(this->_reclaimState) == RECLAIM_IDLE)
+		sync::compareAndSwap(this->_reclaimState, RECLAIM_IDLE, RECLAIM_IN_USE);
+	return (sync::load(this->_reclaimState) != RECLAIMED);
+}
+
+/**
+ * @brief Decides whether the sampler keeps a record.
+ *
+ * @param level The level of the record.
+ * @param site The call site of the record.
+ * @return True if the record is kept or its level is not sampled.
+ */
+bool	Logger::_sample(const logRecord::e_LogLevel level, const logRecord::CallSite *site) const
+{
+	sync::Epoch::Guard guard;
+	const Sampling &sampling = this->_sampling.get();
+	return (!sampling.sampler || level > sampling.upTo || sampling.sampler->keep(site));
+}
+
+/**
+ * @brief Builds the record of a call the sampler kept and handles it.
+ *
+ * The record and everything formatted while handling it are allocated from
+ * the thread's arena, which is rewound once the record has been handled.
+ * The fields of the logger follow those of the call.
  *
  * @param level The log level.
+ * @param site The call site.
  * @param msg The message to log.
  * @param args Optional arguments.
- * @param filename Source file name.
- * @param lineNo Source line number.
- * @param funcName Function name.
+ * @param fields Fields of the call.
  */
-void	Logger::_log(const logRecord::e_LogLevel level, const std::string &msg, const t_args *args,
-					const std::string filename, int lineNo, const std::string funcName)
+void	Logger::_emit(const logRecord::e_LogLevel level, const logRecord::CallSite *site, const StringRef &msg, const Args &args,
+					const Fields &fields)
 {
+	arena::Scope scope;
+	sync::Epoch::Guard guard;
+	const Extra &extra = this->_extra.get();
+	Fields all(fields);
 	logRecord::LogRecord record(
 		this->getName(),
 		level,
-		filename,
-		lineNo,
+		site,
 		msg,
 		args,
-		funcName
+		all.extend(extra.fields, extra.count)
 	);
 	this->handle(record);
 }
 
+/**
+ * @brief Internal method to log a message at a given level.
+ *
+ * The sampler decides first, so a record it drops is never built.
+ *
+ * @param level The log level.
+ * @param msg The message to log.
+ * @param args Optional arguments.
+ * @param filename Source file name.
+ * @param lineNo Source line number.
+ * @param funcName Function name.
+ * @param fields Fields of the call.
+ */
+void	Logger::_log(const logRecord::e_LogLevel level, const StringRef &msg, const Args &args,
+					const char *filename, int lineNo, const char *funcName, const Fields &fields)
+{
+	const logRecord::CallSite *site = logRecord::CallSite::get(filename, lineNo, funcName);
+	if (this->_sample(level, site))
+		this->_emit(level, site, msg, args, fields);
+}
+
+/**
+ * @brief Removes the field with a key from encoded logger fields.
+ *
+ * @param extra The fields to edit.
+ * @param key The name of the field.
+ */
+void	Logger::_dropField(Extra &extra, const StringRef &key)
+{
+	const char *begin = extra.fields.data();
+	const char *p = begin;
+	const char *name;
+	Arg value;
+
+	for (std::size_t i = 0; i < extra.count; ++i)
+	{
+		const char *next = Fields::decode(p, name, value);
+		if (std::strncmp(name, key.data(), key.size()) == 0 && name[key.size()] == '\0')
+		{
+			extra.fields.erase(p - begin, next - p);
+			--extra.count;
+			return ;
+		}
+		p = next;
+	}
+}
+
 /**
  * @brief Clears the cache for this logger and all its children.
  */
 void Logger::cacheClear()
 {
+	sync::ScopedLock lock(manager::Manager::getInstance().getLock());
 	this->clearCache();
 
-	t_loggers children = this->getChildren();
-	for (t_loggers::iterator it = children.begin(); it != children.end(); ++it)
-		(*it)->cacheClear();
+	for (Node *child = this->getFirstChild(); child; child = child->getNextSibling())
+		static_cast<Logger *>(child)->cacheClear();
 }
 
 /**
@@ -454,7 +769,7 @@ void Logger::cacheClear()
  */
 void Logger::clearCache()
 {
-	_cache.clear();
+	sync::store(this->_cache, 0UL);
 }
 
 } // !logger
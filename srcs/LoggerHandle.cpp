@@ -0,0 +1,121 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   LoggerHandle.cpp                                   :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: pdemont <pdemont@student.42lausanne.ch>    +#+  +:+       +#+        */
+/*   By: blucken <blucken@student.42lausanne.ch>  +#+#+#+#+#+   +#+           */
+/*                                                     #+#    #+#             */
+/*   Created: 2026/10/18                              ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+/**
+ * @file LoggerHandle.cpp
+ * @brief Implements the slow path of the LoggerHandle struct.
+ */ 
+
+#include <log42/Log42.hpp>
+#include <log42/LoggerHandle.hpp>
+
+namespace log42
+{
+namespace logger
+{
+
+/**
+ * @brief Resolves the logger and recomputes the lowest level it has enabled.
+ *
+ * The root logger (empty name) is resolved through ensureRootReady(), so a
+ * root handle configures the root on first use like the root functions.
+ *
+ * The generation is read first, so a change racing with the computation
+ * leaves a state that is already stale and is recomputed on the next check.
+ *
+ * @return The new state.
+ */
+unsigned long	LoggerHandle::_refresh()
+{
+	unsigned long generation = manager::Manager::getCacheGeneration();
+	Logger *resolved = this->name[0] ? this->_resolve() : ensureRootReady();
+
+	unsigned long lowest = logRecord::CRITICAL + 1;
+	for (int level = logRecord::CRITICAL; level >= logRecord::NOTSET; --level)
+	{
+		if (!resolved->isEnabledFor(static_cast<logRecord::e_LogLevel>(level)))
+			break ;
+		lowest = level;
+	}
+
+	unsigned long current = (generation << levelBits) | lowest;
+	sync::store(this->alogger, resolved);
+	sync::store(this->state, current);
+	return (current);
+}
+
+/**
+ * @brief Resolves a named logger, retaining it once per handle.
+ *
+ * The logger is looked up without locking, and only a logger other than
+ * the cached one is retained, through the Manager lock. A cached logger
+ * destroyed by a resetRoot() since it was cached is never the one found,
+ * even if a new logger took its address, and is not released. The handle
+ * that publishes the logger releases the one it replaces; a handle that
+ * loses the race releases its own.
+ *
+ * @return The logger.
+ */
+Logger	*LoggerHandle::_resolve()
+{
+	manager::Manager &manager = manager::Manager::getInstance();
+	unsigned long previous = sync::load(this->state);
+	Logger *cached = sync::load(this->alogger);
+	bool held = cached && (previous >> levelBits) >= manager::Manager::getResetGeneration();
+	Logger *resolved = manager.getLoggerPtr(this->name);
+	if (held && resolved == cached)
+		return (resolved);
+
+	resolved = manager.retainLogger(this->name);
+	if (!sync::compareAndSwap(this->alogger, cached, resolved))
+	{
+		resolved->release();
+		return (sync::load(this->alogger));
+	}
+	if (held)
+		cached->release();
+	return (resolved);
+}
+
+} // !logger
+} // !log42
+
+/* ************************************************************************** */
+/*                                                                            */
+/*                                MIT License                                 */
+/*                                                                            */
+/*   Copyright (c) 2025 Demont Pieric, Lucken Bénédict                        */
+/*                                                                            */
+/*   Inspired by the Python 'logging' module by Vinay Sajip.                  */
+/*   This implementation was rewritten in C++98 and contains no original      */
+/*   Python source code.                                                      */
+/*                                                                            */
+/*   Permission is hereby granted, free of charge, to any person obtaining    */
+/*   a copy of this software and associated documentation files (the          */
+/*   "Software"), to deal in the Software without restriction, including      */
+/*   without limitation the rights to use, copy, modify, merge, publish,      */
+/*   distribute, sublicense, and/or sell copies of the Software, and to       */
+/*   permit persons to whom the Software is furnished to do so, subject to    */
+/*   the following conditions:                                                */
+/*                                                                            */
+/*   The above copyright notice and this permission notice shall be included  */
+/*   in all copies or substantial portions of the Software.                   */
+/*                                                                            */
+/*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS  */
+/*   OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF               */
+/*   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.   */
+/*   IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY     */
+/*   CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,     */
+/*   TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE        */
+/*   SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                   */
+/*                                                                            */
+/* ************************************************************************** */
@@ -21,6 +21,7 @@
 #include <log42/Log42.hpp>
 #include <log42/Manager.hpp>
 #include <log42/StreamHandler.hpp>
+#include <log42/Sync.hpp>
 #include <ostream>
 #include <set>
 #include <stdexcept>
@@ -33,7 +34,8 @@ namespace log42
  * @brief Configures the root logger with basic settings and handlers.
  *
  * Sets up the root logger with file or stream handlers, formatters, and log level.
- * If 'force' is true, existing handlers are removed and deleted.
+ * If 'force' is true, existing handlers are removed and deleted. Concurrent
+ * calls are serialized, so only the first one configures an empty root.
  *
  * @param filename Name of the log file (if any).
  * @param fileMode File open mode for file handler.
@@ -54,7 +56,9 @@ void	basicConfig(
 	const logRecord::e_LogLevel level,
 	bool force)
 {
-	logger::Logger &root = *manager::Manager::getInstance().getRoot();
+	manager::Manager &manager = manager::Manager::getInstance();
+	sync::ScopedLock lock(manager.getLock());
+	logger::Logger &root = *manager.getRootLogger();
 
 	if (force)
 	{
@@ -120,24 +124,76 @@ void	basicConfig(
 common::core::raii::SharedPtr<logger::Logger> getLogger(const std::string &name)
 {
 	manager::Manager &manager = manager::Manager::getInstance();
-	if (name.empty() || name == manager.getRoot()->getName())
+	if (name.empty() || name == manager.getRootLogger()->getName())
 		return manager.getRoot();
 	return manager.getLogger(name);
 }
 
+/**
+ * @brief Retrieves a logger by name without taking a reference to it.
+ *
+ * Unlike getLogger(), an existing logger is found without locking, so this
+ * can be called on every request from any number of threads.
+ *
+ * @param name The name of the logger, empty for the root logger.
+ * @return Pointer to the logger, valid until shutdown(), or until the second
+ * reclaimLoggers() after the lookup unless the logger is retained.
+ */
+logger::Logger	*getLoggerPtr(const StringRef &name)
+{
+	return (manager::Manager::getInstance().getLoggerPtr(name));
+}
+
+/**
+ * @brief Retrieves a logger by name and keeps it from being reclaimed.
+ *
+ * @param name The name of the logger, empty for the root logger.
+ * @return Pointer to the logger, valid until Logger::release() is called
+ * on it.
+ */
+logger::Logger	*retainLogger(const StringRef &name)
+{
+	return (manager::Manager::getInstance().retainLogger(name));
+}
+
+/**
+ * @brief Frees the loggers that can be recreated on demand: no handler, no
+ * filter, no level of their own, no child logger, no reference taken by
+ * getLogger(), getChildren() or retainLogger(), and no lookup since the
+ * previous call.
+ *
+ * @return The number of loggers freed by this call.
+ */
+std::size_t	reclaimLoggers()
+{
+	return (manager::Manager::getInstance().reclaim());
+}
+
 /**
  * @brief Ensures the root logger is ready for logging.
  *
- * If the root logger has no handlers, configures it with default settings.
- * @return Pointer to the root logger.
+ * The first call after the root is created configures it with default
+ * settings if it has no handlers; later calls only check a flag. The root
+ * is returned without taking a reference, so the ROOT_* macros can be used
+ * from any thread.
+ *
+ * @return Pointer to the root logger, valid until shutdown().
  */
-common::core::raii::SharedPtr<logger::Logger> ensureRootReady()
+logger::Logger	*ensureRootReady()
 {
 	manager::Manager &manager = manager::Manager::getInstance();
-	common::core::raii::SharedPtr<logger::Logger> root = manager.getRoot();
-	if (root->getHandlers().empty())
-		basicConfig();
-	return root;
+	logger::Logger *root = manager.getRootLogger();
+	if (!manager.getRootConfigured())
+	{
+		sync::ScopedLock lock(manager.getLock());
+		if (!manager.getRootConfigured())
+		{
+			if (!root->hasHandler())
+				basicConfig();
+			manager.setRootConfigured(true);
+		}
+	}
+	return (root);
 }
 
 /**
@@ -149,7 +205,7 @@ common::core::raii::SharedPtr<logger::Logger> ensureRootReady()
  * @param funcName Function name.
  * @param args Optional arguments.
  */
-void	debug(const std::string &msg, const std::string filename, int lineNo, const std::string funcName, const t_args *args)
+void	debug(const StringRef &msg, const char *filename, int lineNo, const char *funcName, const Args &args)
 {
 	ensureRootReady()->debug(msg, filename, lineNo, funcName, args);
 }
@@ -163,7 +219,7 @@ void	debug(const std::string &msg, const std::string filename, int lineNo, const
  * @param funcName Function name.
  * @param args Optional arguments.
  */
-void	info(const std::string &msg, const std::string filename, int lineNo, const std::string funcName, const t_args *args)
+void	info(const StringRef &msg, const char *filename, int lineNo, const char *funcName, const Args &args)
 {
 	ensureRootReady()->info(msg, filename, lineNo, funcName, args);
 }
@@ -177,7 +233,7 @@ void	info(const std::string &msg, const std::string filename, int lineNo, const
  * @param funcName Function name.
  * @param args Optional arguments.
  */
-void	warning(const std::string &msg, const std::string filename, int lineNo, const std::string funcName, const t_args *args)
+void	warning(const StringRef &msg, const char *filename, int lineNo, const char *funcName, const Args &args)
 {
 	ensureRootReady()->warning(msg, filename, lineNo, funcName, args);
 }
@@ -191,7 +247,7 @@ void	warning(const std::string &msg, const std::string filename, int lineNo, con
  * @param funcName Function name.
  * @param args Optional arguments.
  */
-void	error(const std::string &msg, const std::string filename, int lineNo, const std::string funcName, const t_args *args)
+void	error(const StringRef &msg, const char *filename, int lineNo, const char *funcName, const Args &args)
 {
 	ensureRootReady()->error(msg, filename, lineNo, funcName, args);
 }
@@ -205,7 +261,7 @@ void	error(const std::string &msg, const std::string filename, int lineNo, const
  * @param funcName Function name.
  * @param args Optional arguments.
  */
-void	exception(const std::string &msg, const std::string filename, int lineNo, const std::string funcName, const t_args *args)
+void	exception(const StringRef &msg, const char *filename, int lineNo, const char *funcName, const Args &args)
 {
 	ensureRootReady()->error(msg, filename, lineNo, funcName, args);
 }
@@ -219,7 +275,7 @@ void	exception(const std::string &msg, const std::string filename, int lineNo, c
  * @param funcName Function name.
  * @param args Optional arguments.
  */
-void	critical(const std::string &msg, const std::string filename, int lineNo, const std::string funcName, const t_args *args)
+void	critical(const StringRef &msg, const char *filename, int lineNo, const char *funcName, const Args &args)
 {
 	ensureRootReady()->critical(msg, filename, lineNo, funcName, args);
 }
@@ -234,7 +290,7 @@ void	critical(const std::string &msg, const std::string filename, int lineNo, co
  * @param funcName Function name.
  * @param args Optional arguments.
  */
-void	log(const logRecord::e_LogLevel level, const std::string &msg, const std::string filename, int lineNo, const std::string funcName, const t_args *args)
+void	log(const logRecord::e_LogLevel level, const StringRef &msg, const char *filename, int lineNo, const char *funcName, const Args &args)
 {
 	ensureRootReady()->log(level, msg, filename, lineNo, funcName, args);
 }
@@ -254,11 +310,12 @@ void disable(logRecord::e_LogLevel level)
  * @brief Shuts down the logging system, closing and deleting all loggers and handlers.
  *
  * Iterates through all loggers, closes and deletes their handlers, clears the logger map,
- * and resets the root logger.
+ * and resets the root logger. No other thread may be logging meanwhile.
  */
 void shutdown()
 {
 	manager::Manager &manager = manager::Manager::getInstance();
+	sync::ScopedLock lock(manager.getLock());
 
 	t_loggerMap &loggers = manager.getLoggerMap();
 
@@ -289,6 +346,7 @@ void shutdown()
 	}
 	loggers.clear();
 	manager.resetRoot();
+	sync::Epoch::collect();
 }
 
 } // !log42
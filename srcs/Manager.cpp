@@ -19,6 +19,8 @@
 #include <log42/Log42.hpp>
 #include <log42/RootLogger.hpp>
 #include <log42/Manager.hpp>
+#include <log42/Sync.hpp>
+#include <algorithm>
 #include <stdexcept>
 
 namespace log42
@@ -26,6 +28,17 @@ namespace log42
 namespace manager
 {
 
+/**
+ * @brief Generation of the loggers' level caches, starting above the 0 of
+ * a cache or handle never filled.
+ */
+unsigned long	Manager::_cacheGeneration = 1;
+
+/**
+ * @brief Cache generation started by the last resetRoot().
+ */
+unsigned long	Manager::_resetGeneration = 0;
+
 /**
  * @brief Retrieves the singleton instance of Manager.
  *
@@ -46,22 +59,30 @@ Manager &Manager::getInstance(logger::Logger *root)
  */
 Manager::Manager(logger::Logger *root) 
 	: _root(),
+	_rootLogger(NULL),
 	_disable(logRecord::NOTSET),
 	_emittedNoHandlerWarning(false), 
-	_loggerMap() 
+	_rootConfigured(false),
+	_loggerMap(),
+	_registry(),
+	_lock(true)
 {
 	if (root)
 	{
 		this->_root = common::core::raii::SharedPtr<logger::Logger>(root);
 		this->_loggerMap[this->_root->getName()] = common::core::raii::staticPointerCast<Node>(this->_root);
+		this->_registry.bind(this->_root->getName(), root, root);
+		sync::store(this->_rootLogger, root);
 	}
 }
 
 /**
- * @brief Destructor for Manager. Calls shutdown on destruction.
+ * @brief Destructor for Manager. Unlinks the nodes, which are then destroyed
+ * in any order.
  */
 Manager::~Manager() 
 {
+	this->_detachNodes();
 }
 
 /**
@@ -71,21 +92,47 @@ Manager::~Manager()
  */
 common::core::raii::SharedPtr<logger::Logger> Manager::getRoot()
 {
+	sync::ScopedLock lock(this->_lock);
 	if (!this->_root)
 	{
 		this->_root = common::core::raii::SharedPtr<logger::Logger>(new logger::RootLogger());
 		this->_loggerMap[this->_root->getName()] = common::core::raii::staticPointerCast<Node>(this->_root);
+		this->_registry.bind(this->_root->getName(), this->_root.get(), this->_root.get());
+		sync::store(this->_rootLogger, this->_root.get());
 	}
 	return (this->_root);
 }
 
+/**
+ * @brief Gets the root logger without taking a reference to it, creating it
+ * if necessary.
+ *
+ * Once the root exists this is a single load, safe to call from any thread.
+ *
+ * @return Pointer to the root logger, valid until resetRoot().
+ */
+logger::Logger	*Manager::getRootLogger()
+{
+	logger::Logger *root = sync::load(this->_rootLogger);
+	if (root)
+		return (root);
+	return (this->getRoot().get());
+}
+
 /**
  * @brief Resets the root logger to NULL.
  */
 void	Manager::resetRoot()
 {
+	sync::ScopedLock lock(this->_lock);
+	sync::store(this->_rootLogger, static_cast<logger::Logger *>(NULL));
+	sync::store(this->_rootConfigured, false);
+	this->_registry.clear();
+	this->_detachNodes();
 	this->_loggerMap.clear();
 	this->_root = common::core::raii::SharedPtr<logger::Logger>();
+	this->clearCache();
+	sync::store(_resetGeneration, getCacheGeneration());
 }
 
 /**
@@ -95,7 +142,7 @@ void	Manager::resetRoot()
  */
 logRecord::e_LogLevel	Manager::getDisable() const
 {
-	return (this->_disable);
+	return (sync::load(this->_disable));
 }
 
 /**
@@ -105,7 +152,7 @@ logRecord::e_LogLevel	Manager::getDisable() const
  */
 void	Manager::setDisable(const logRecord::e_LogLevel value)
 {
-	this->_disable = value;
+	sync::store(this->_disable, value);
 }
 
 /**
@@ -115,7 +162,7 @@ void	Manager::setDisable(const logRecord::e_LogLevel value)
  */
 bool	Manager::getEmittedNoHandlerWarning() const
 {
-	return (this->_emittedNoHandlerWarning);
+	return (sync::load(this->_emittedNoHandlerWarning));
 }
 
 /**
@@ -125,12 +172,34 @@ bool	Manager::getEmittedNoHandlerWarning() const
  */
 void	Manager::setEmittedNoHandlerWarning(bool value)
 {
-	this->_emittedNoHandlerWarning = value;
+	sync::store(this->_emittedNoHandlerWarning, value);
+}
+
+/**
+ * @brief Checks if the root logger went through its implicit configuration.
+ *
+ * @return True once ensureRootReady() has checked the root, until resetRoot().
+ */
+bool	Manager::getRootConfigured() const
+{
+	return (sync::load(this->_rootConfigured));
+}
+
+/**
+ * @brief Sets the implicit root configuration flag.
+ *
+ * @param value True once the root has been checked, false otherwise.
+ */
+void	Manager::setRootConfigured(bool value)
+{
+	sync::store(this->_rootConfigured, value);
 }
 
 /**
  * @brief Gets the map of logger names to their nodes.
  *
+ * The map may only be used while holding getLock().
+ *
  * @return Reference to the logger map.
  */
 t_loggerMap	&Manager::getLoggerMap()
@@ -138,107 +207,284 @@ t_loggerMap	&Manager::getLoggerMap()
 	return (this->_loggerMap);
 }
 
+/**
+ * @brief Gets the lock serializing changes to the logger hierarchy.
+ *
+ * The lock is recursive, so a thread holding it may still create loggers.
+ *
+ * @return Reference to the lock.
+ */
+sync::Mutex	&Manager::getLock()
+{
+	return (this->_lock);
+}
+
 /**
  * @brief Retrieves a logger by name, creating it if necessary.
  *
+ * The reference is copied under the hierarchy lock, since SharedPtr counts
+ * are not atomic; dropping it is not synchronized either, so threads that
+ * look the same logger up concurrently use getLoggerPtr(), the lock-free
+ * lookup. The logger is retained for good, since the caller may keep the
+ * returned reference indefinitely.
+ *
  * @param name The name of the logger.
  * @return Pointer to the logger.
  * @throws std::invalid_argument if the logger name is empty.
  */
 common::core::raii::SharedPtr<logger::Logger> Manager::getLogger(const std::string &name)
+{
+	sync::ScopedLock lock(this->_lock);
+	this->_getLogger(name)->retain();
+	return (common::core::raii::staticPointerCast<logger::Logger>(this->_loggerMap.find(name)->second));
+}
+
+/**
+ * @brief Retrieves a logger by name and retains it, creating it if
+ * necessary.
+ *
+ * The logger is not reclaimed until it is released, so the pointer can be
+ * kept by a thread while another one reclaims loggers.
+ *
+ * @param name The name of the logger, empty for the root logger.
+ * @return Pointer to the logger, to pass to Logger::release() once done.
+ */
+logger::Logger	*Manager::retainLogger(const StringRef &name)
+{
+	if (name.size() == 0)
+		return (this->getRootLogger());
+	sync::ScopedLock lock(this->_lock);
+	logger::Logger *alogger = this->_registry.find(name);
+	if (alogger)
+		alogger->_touch();
+	else
+		alogger = this->_getLogger(std::string(name.data(), name.size()));
+	if (alogger)
+		alogger->retain();
+	return (alogger);
+}
+
+/**
+ * @brief Reclaims the loggers that can be recreated on demand.
+ *
+ * A reclaimable logger (see Logger::isReclaimable()) is first marked idle,
+ * and any lookup marks it in use again. A logger still idle and reclaimable
+ * at the next sweep was not looked up in between: it is unlinked and its
+ * references are dropped under the lock, so it is destroyed here, and only
+ * its memory waits for the lock-free lookups that may have found it (see
+ * Node::operator delete). The placeholders left with no logger are dropped
+ * too, and the other loggers keep their parents. A logger whose children
+ * are reclaimed becomes reclaimable, and is reclaimed by later sweeps.
+ *
+ * Loggers handed out by getLogger() or getChildren() are retained, so only
+ * loggers reached through getLoggerPtr() or handles are ever reclaimed. A
+ * pointer from getLoggerPtr() to a logger that is not retained is
+ * invalidated by the second sweep after its lookup.
+ *
+ * @return The number of loggers reclaimed by this sweep.
+ */
+std::size_t	Manager::reclaim()
+{
+	sync::ScopedLock lock(this->_lock);
+	t_nodes reclaimed;
+
+	t_loggerMap::reverse_iterator rit;
+	for (rit = this->_loggerMap.rbegin(); rit != this->_loggerMap.rend(); ++rit)
+	{
+		if (rit->second->getKind() != Node::LOGGER)
+			continue ;
+		logger::Logger *alogger = static_cast<logger::Logger *>(rit->second.get());
+		if (alogger == this->_root.get())
+			continue ;
+		if (!alogger->isReclaimable())
+		{
+			sync::store(alogger->_reclaimState, logger::Logger::RECLAIM_IN_USE);
+			continue ;
+		}
+		if (sync::compareAndSwap(alogger->_reclaimState, logger::Logger::RECLAIM_IN_USE, logger::Logger::RECLAIM_IDLE)
+			|| !sync::compareAndSwap(alogger->_reclaimState, logger::Logger::RECLAIM_IDLE, logger::Logger::RECLAIMED))
+			continue ;
+		alogger->setParent(NULL);
+		reclaimed.push_back(alogger);
+	}
+	if (reclaimed.empty())
+		return (0);
+	std::sort(reclaimed.begin(), reclaimed.end());
+
+	t_loggerMap::iterator it = this->_loggerMap.begin();
+	while (it != this->_loggerMap.end())
+	{
+		bool drop = false;
+		if (it->second->getKind() == Node::PLACEHOLDER)
+		{
+			placeholder::PlaceHolder *ph = static_cast<placeholder::PlaceHolder *>(it->second.get());
+			ph->remove(reclaimed);
+			drop = ph->getLoggerSet().empty();
+		}
+		else
+			drop = std::binary_search(reclaimed.begin(), reclaimed.end(), it->second.get());
+		if (drop)
+		{
+			this->_registry.unbind(it->first);
+			this->_loggerMap.erase(it++);
+		}
+		else
+			++it;
+	}
+	this->clearCache();
+	return (reclaimed.size());
+}
+
+/**
+ * @brief Retrieves a logger by name, creating it if necessary, without
+ * retaining it.
+ *
+ * The logger is marked in use, so the next reclaim() keeps it. A new logger
+ * is indexed last, once it is linked into the hierarchy. Must be called with
+ * the lock held.
+ *
+ * @param name The name of the logger.
+ * @return Pointer to the logger.
+ * @throws std::invalid_argument if the logger name is empty.
+ */
+logger::Logger	*Manager::_getLogger(const std::string &name)
 {
 	if (!this->_root)
 		this->getRoot();
 	if (name.empty())
 		throw std::invalid_argument("Logger name must be a non-empty string");
-	common::core::raii::SharedPtr<logger::Logger> alogger;
-	t_loggerMap::iterator it;
-	it = this->_loggerMap.find(name);
+	t_loggerMap::iterator it = this->_loggerMap.end();
+	if (this->_registry.findNode(name))
+		it = this->_loggerMap.find(name);
+
+	if (it != this->_loggerMap.end() && it->second->getKind() == Node::LOGGER)
+	{
+		logger::Logger *alogger = static_cast<logger::Logger *>(it->second.get());
+		alogger->_touch();
+		return (alogger);
+	}
 
-	if (it != this->_loggerMap.end())
 	{
-		common::core::raii::SharedPtr<placeholder::PlaceHolder> ph = common::core::raii::dynamicPointerCast<placeholder::PlaceHolder>(it->second);
-		if (ph)
+		common::core::raii::SharedPtr<logger::Logger> alogger_sp(new logger::Logger(name));
+		if (it != this->_loggerMap.end())
 		{
-			common::core::raii::SharedPtr<logger::Logger> alogger_sp(new logger::Logger(name));
-			this->_loggerMap[name] = common::core::raii::staticPointerCast<Node>(alogger_sp);
+			common::core::raii::SharedPtr<placeholder::PlaceHolder> ph = common::core::raii::staticPointerCast<placeholder::PlaceHolder>(it->second);
+			it->second = common::core::raii::staticPointerCast<Node>(alogger_sp);
 			_fixupChildren(ph, alogger_sp);
-			_fixupParents(alogger_sp);
-			alogger = alogger_sp;
 		}
 		else
-		{
-			common::core::raii::SharedPtr<logger::Logger> alogger_sp = common::core::raii::dynamicPointerCast<logger::Logger>(it->second);
-			if (alogger_sp)
-				alogger = alogger_sp;
-			else
-				alogger = common::core::raii::SharedPtr<logger::Logger>();
-		}
+			it = this->_loggerMap.insert(t_loggerMap::value_type(name, common::core::raii::staticPointerCast<Node>(alogger_sp))).first;
+		_fixupParents(alogger_sp);
 	}
-	else
+	logger::Logger *alogger = static_cast<logger::Logger *>(it->second.get());
+	this->_registry.bind(name, alogger, alogger);
+	return (alogger);
+}
+
+/**
+ * @brief Retrieves a logger by name without taking a reference to it,
+ * creating it if necessary.
+ *
+ * An existing logger is found without locking or allocating; only a logger
+ * that does not exist yet, or is being reclaimed, takes the hierarchy lock
+ * to be created. An empty name designates the root logger.
+ *
+ * @param name The name of the logger.
+ * @return Pointer to the logger, valid until resetRoot(), or until the
+ * second reclaim() after the lookup unless the logger is retained.
+ */
+logger::Logger	*Manager::getLoggerPtr(const StringRef &name)
+{
+	if (name.size() == 0)
+		return (this->getRootLogger());
 	{
-		common::core::raii::SharedPtr<logger::Logger> alogger_sp(new logger::Logger(name));
-		this->_loggerMap[name] = common::core::raii::staticPointerCast<Node>(alogger_sp);
-		_fixupParents(alogger_sp);
-		alogger = alogger_sp;
+		sync::Epoch::Guard guard;
+		logger::Logger *alogger = this->_registry.find(name);
+		if (alogger && alogger->_touch())
+			return (alogger);
 	}
 
-	return (alogger);
+	sync::ScopedLock lock(this->_lock);
+	return (this->_getLogger(std::string(name.data(), name.size())));
 }
 
 /**
  * @brief Clears the cache for all loggers and the root logger.
+ *
+ * Bumping the generation invalidates every cache at once, without visiting
+ * the loggers or racing with threads filling their caches.
  */
 void	Manager::clearCache()
 {
-	t_loggerMap::iterator it;
+	sync::fetchAdd(_cacheGeneration, 1UL);
+}
+
+/**
+ * @brief Measures the memory held by the hierarchy.
+ *
+ * Counts every logger and placeholder of the map with its name and its
+ * handler and filter sets, the map nodes and the registry.
+ *
+ * @return The node counts and the estimated size in bytes.
+ */
+Manager::Footprint	Manager::getFootprint()
+{
+	sync::ScopedLock lock(this->_lock);
+	Footprint footprint;
+	footprint.loggers = 0;
+	footprint.placeholders = 0;
+	footprint.bytes = this->_registry.getFootprint();
+
+	t_loggerMap::const_iterator it;
 	for (it = this->_loggerMap.begin(); it != this->_loggerMap.end(); ++it)
 	{
-		common::core::raii::SharedPtr<logger::Logger> alogger_sp = common::core::raii::dynamicPointerCast<logger::Logger>(it->second);
-		if (alogger_sp)
-			alogger_sp->clearCache();
+		if (it->second->getKind() == Node::LOGGER)
+			++footprint.loggers;
+		else
+			++footprint.placeholders;
+		footprint.bytes += 4 * sizeof(void *) + sizeof(t_loggerMap::value_type)
+			+ Node::stringFootprint(it->first) + it->second->getFootprint();
 	}
-	if (this->_root)
-		this->_root->cacheClear();
+	return (footprint);
 }
 
 /**
  * @brief Fixes parent relationships for a logger, updating the logger hierarchy.
  *
+ * Each dotted prefix of the name, from the longest, is resolved with one
+ * lookup in the registry, without building a substring unless a placeholder
+ * has to be created for it.
+ *
  * @param alogger Pointer to the logger.
  */
 void Manager::_fixupParents(const common::core::raii::SharedPtr<logger::Logger> &alogger)
 {
 	const std::string &name = alogger->getName();
 	std::size_t pos = name.rfind('.');
-	common::core::raii::SharedPtr<Node> foundParentSp;
+	Node *parent = NULL;
 
-	while (pos != std::string::npos && !foundParentSp) 
+	while (pos != std::string::npos && !parent) 
 	{
-		std::string substr = name.substr(0, pos);
-		t_loggerMap::iterator it;
-		it = this->_loggerMap.find(substr);
+		Node *node = this->_registry.findNode(StringRef(name.data(), pos));
 
-		if (it == this->_loggerMap.end()) 
-			this->_loggerMap[substr] = common::core::raii::SharedPtr<Node>(new placeholder::PlaceHolder(this->_loggerMap[name]));
-		else 
+		if (!node) 
 		{
-			common::core::raii::SharedPtr<logger::Logger> parentLoggerSp = common::core::raii::dynamicPointerCast<logger::Logger>(it->second);
-			if (parentLoggerSp)
-				foundParentSp = it->second;
-			else
-			{
-				common::core::raii::SharedPtr<placeholder::PlaceHolder> ph = common::core::raii::dynamicPointerCast<placeholder::PlaceHolder>(it->second);
-				if (ph)
-					ph->append(this->_loggerMap[name]);
-			}
+			std::string substr(name, 0, pos);
+			common::core::raii::SharedPtr<placeholder::PlaceHolder> ph(new placeholder::PlaceHolder(substr, alogger.get()));
+			this->_loggerMap.insert(t_loggerMap::value_type(substr, common::core::raii::staticPointerCast<Node>(ph)));
+			this->_registry.bind(substr, ph.get(), NULL);
 		}
-		pos = name.rfind('.', pos - 1);
+		else if (node->getKind() == Node::LOGGER)
+			parent = node;
+		else
+			static_cast<placeholder::PlaceHolder *>(node)->append(alogger.get());
+		pos = pos ? name.rfind('.', pos - 1) : std::string::npos;
 	}
 
-	if (!foundParentSp)
-		foundParentSp = common::core::raii::staticPointerCast<Node>(this->_root);
-	alogger->setParent(foundParentSp);
+	if (parent)
+		alogger->setParent(parent);
+	else
+		alogger->setParent(this->_root.get());
 }
 
 /**
@@ -256,18 +502,27 @@ void Manager::_fixupChildren(const common::core::raii::SharedPtr<placeholder::Pl
 	t_nodes::const_iterator it;
 	for (it = children.begin(); it != children.end(); ++it)
 	{
-		common::core::raii::SharedPtr<Node> csp = *it;
-		Node *cparent = csp->getParent().get();
+		Node *child = *it;
+		Node *cparent = child->getParent();
 		if (cparent && cparent->getName().compare(0, namelen, name) != 0)
 		{
-			common::core::raii::SharedPtr<Node> cparentSp = this->_loggerMap[cparent->getName()];
-			common::core::raii::SharedPtr<Node> aloggerSp = this->_loggerMap[alogger->getName()];
-			alogger->setParent(cparentSp);
-			csp->setParent(aloggerSp);
+			alogger->setParent(cparent);
+			child->setParent(alogger.get());
 		}
 	}
 }
 
+/**
+ * @brief Unlinks every node from its parent, leaving no link to a node
+ * destroyed before the nodes referring to it.
+ */
+void	Manager::_detachNodes()
+{
+	t_loggerMap::iterator it;
+	for (it = this->_loggerMap.begin(); it != this->_loggerMap.end(); ++it)
+		it->second->setParent(NULL);
+}
+
 } // !manager
 } // !log42
 
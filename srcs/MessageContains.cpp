@@ -0,0 +1,119 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   MessageContains.cpp                                :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: pdemont <pdemont@student.42lausanne.ch>    +#+  +:+       +#+        */
+/*   By: blucken <blucken@student.42lausanne.ch>  +#+#+#+#+#+   +#+           */
+/*                                                     #+#    #+#             */
+/*   Created: 2026/10/18                              ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+/**
+ * @file MessageContains.cpp
+ * @brief Implements the MessageContains predicate.
+ */ 
+
+#include <log42/MessageContains.hpp>
+#include <log42/StringRef.hpp>
+#include <cstring>
+
+namespace log42
+{
+namespace filter
+{
+
+/**
+ * @brief Constructs a MessageContains.
+ *
+ * @param text The text to look for.
+ * @param accept True to pass the records containing the text, false to pass
+ * those that do not.
+ */
+MessageContains::MessageContains(const std::string &text, const bool accept)
+	: Predicate(), _text(text), _accept(accept) {}
+
+/**
+ * @brief Destructor for MessageContains.
+ */
+MessageContains::~MessageContains() {}
+
+/**
+ * @brief Checks whether a record's message contains the text.
+ *
+ * @param record The log record to check.
+ * @param owner The filterer applying the predicate.
+ * @return True if the record passes, false otherwise.
+ */
+bool	MessageContains::test(const logRecord::LogRecord &record, filterer::Filterer &owner) const
+{
+	(void)owner;
+	StringRef msg = record.getMessageRef();
+	const char *text = this->_text.data();
+	std::size_t len = this->_text.length();
+	bool found = (len == 0);
+
+	for (std::size_t i = 0; !found && i + len <= msg.size(); ++i)
+	{
+		const char *p = static_cast<const char *>(std::memchr(msg.data() + i, text[0], msg.size() - len - i + 1));
+		if (!p)
+			break ;
+		i = p - msg.data();
+		found = (std::memcmp(p, text, len) == 0);
+	}
+	return (found == this->_accept);
+}
+
+/**
+ * @brief Gets the estimated cost of a test.
+ *
+ * @return 100: the message may have to be rendered before it is searched.
+ */
+unsigned int	MessageContains::getCost() const
+{
+	return (100);
+}
+
+/**
+ * @brief Tells whether the decision only depends on the level and call site.
+ *
+ * @return False: it depends on the message.
+ */
+bool	MessageContains::isStatic() const
+{
+	return (false);
+}
+
+} // !filter
+} // !log42
+
+/* ************************************************************************** */
+/*                                                                            */
+/*                                MIT License                                 */
+/*                                                                            */
+/*   Copyright (c) 2025 Demont Pieric, Lucken Bénédict                        */
+/*                                                                            */
+/*   Inspired by the Python 'logging' module by Vinay Sajip.                  */
+/*   This implementation was rewritten in C++98 and contains no original      */
+/*   Python source code.                                                      */
+/*                                                                            */
+/*   Permission is hereby granted, free of charge, to any person obtaining    */
+/*   a copy of this software and associated documentation files (the          */
+/*   "Software"), to deal in the Software without restriction, including      */
+/*   without limitation the rights to use, copy, modify, merge, publish,      */
+/*   distribute, sublicense, and/or sell copies of the Software, and to       */
+/*   permit persons to whom the Software is furnished to do so, subject to    */
+/*   the following conditions:                                                */
+/*                                                                            */
+/*   The above copyright notice and this permission notice shall be included  */
+/*   in all copies or substantial portions of the Software.                   */
+/*                                                                            */
+/*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS  */
+/*   OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF               */
+/*   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.   */
+/*   IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY     */
+/*   CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,     */
+/*   TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE        */
+/*   SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                   */
+/*                                                                            */
+/* ************************************************************************** */
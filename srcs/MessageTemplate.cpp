@@ -0,0 +1,214 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   MessageTemplate.cpp                                :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: pdemont <pdemont@student.42lausanne.ch>    +#+  +:+       +#+        */
+/*   By: blucken <blucken@student.42lausanne.ch>  +#+#+#+#+#+   +#+           */
+/*                                                     #+#    #+#             */
+/*   Created: 2026/10/18                              ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+/**
+ * @file MessageTemplate.cpp
+ * @brief Implements the MessageTemplate class.
+ */ 
+
+#include <log42/Args.hpp>
+#include <log42/MessageTemplate.hpp>
+#include <cstring>
+
+namespace log42
+{
+namespace logRecord
+{
+
+namespace
+{
+
+/**
+ * @brief Tells whether a character after a '%' makes a conversion.
+ *
+ * @param spec The character.
+ * @return True for 'd', 'f', 'x', 's' and '%'.
+ */
+bool	isConversion(const char spec)
+{
+	return (spec == 'd' || spec == 'f' || spec == 'x' || spec == 's' || spec == '%');
+}
+
+} // !namespace
+
+/**
+ * @brief Parses a message and records the position of its conversions.
+ *
+ * @param msg The message to parse.
+ */
+MessageTemplate::MessageTemplate(const StringRef &msg) : _text(msg.data(), msg.size()), _conversions()
+{
+	const char *text = this->_text.data();
+	std::size_t size = this->_text.size();
+
+	for (std::size_t i = 0; i + 1 < size; ++i)
+	{
+		if (text[i] != '%' || !isConversion(text[i + 1]))
+			continue ;
+		Conversion conversion = { i, text[i + 1] };
+		this->_conversions.push_back(conversion);
+		++i;
+	}
+}
+
+/**
+ * @brief Destructor for MessageTemplate.
+ */
+MessageTemplate::~MessageTemplate() {}
+
+/**
+ * @brief Copy constructor for MessageTemplate.
+ *
+ * @param rhs The MessageTemplate to copy.
+ */
+MessageTemplate::MessageTemplate(const MessageTemplate &rhs) : _text(rhs._text), _conversions(rhs._conversions) {}
+
+/**
+ * @brief Assignment operator for MessageTemplate.
+ *
+ * @param rhs The MessageTemplate to assign from.
+ * @return Reference to this MessageTemplate.
+ */
+MessageTemplate	&MessageTemplate::operator=(const MessageTemplate &rhs)
+{
+	if (this != &rhs)
+	{
+		this->_text = rhs._text;
+		this->_conversions = rhs._conversions;
+	}
+	return (*this);
+}
+
+/**
+ * @brief Checks whether the template was parsed from a given message.
+ *
+ * @param msg The message to compare with.
+ * @return True if the messages are identical.
+ */
+bool	MessageTemplate::matches(const StringRef &msg) const
+{
+	return (msg.size() == this->_text.size() 
+		&& std::memcmp(msg.data(), this->_text.data(), msg.size()) == 0);
+}
+
+/**
+ * @brief Renders the message with its arguments substituted.
+ *
+ * Each conversion takes the next argument and "%%" yields a single '%'.
+ * Conversions left once the arguments are exhausted are kept verbatim.
+ *
+ * @param args The arguments, in the encoding of Arg::encode().
+ * @param argc The number of encoded arguments.
+ * @param out The buffer to append to.
+ */
+void	MessageTemplate::render(const char *args, std::size_t argc, arena::t_string &out) const
+{
+	const char *text = this->_text.data();
+	std::size_t start = 0;
+
+	t_conversions::const_iterator it;
+	for (it = this->_conversions.begin(); it != this->_conversions.end(); ++it)
+	{
+		if (it->spec == '%')
+		{
+			out.append(text + start, it->pos + 1 - start);
+			start = it->pos + 2;
+			continue ;
+		}
+		if (argc == 0)
+			continue ;
+
+		Arg arg;
+		args = Arg::decode(args, arg);
+		--argc;
+		out.append(text + start, it->pos - start);
+		arg.append(out, it->spec);
+		start = it->pos + 2;
+	}
+	out.append(text + start, this->_text.size() - start);
+}
+
+/**
+ * @brief Renders a message that has no template, scanning it as it goes.
+ *
+ * Same output as render() on a template of the message, without building
+ * one, so a call site logging varying texts does not allocate per record.
+ *
+ * @param msg The message.
+ * @param args The arguments, in the encoding of Arg::encode().
+ * @param argc The number of encoded arguments.
+ * @param out The buffer to append to.
+ */
+void	MessageTemplate::renderText(const StringRef &msg, const char *args, std::size_t argc, arena::t_string &out)
+{
+	const char *text = msg.data();
+	std::size_t size = msg.size();
+	std::size_t start = 0;
+
+	for (std::size_t i = 0; i + 1 < size; ++i)
+	{
+		if (text[i] != '%' || !isConversion(text[i + 1]))
+			continue ;
+		if (text[i + 1] == '%')
+			out.append(text + start, i + 1 - start);
+		else if (argc == 0)
+		{
+			++i;
+			continue ;
+		}
+		else
+		{
+			Arg arg;
+			args = Arg::decode(args, arg);
+			--argc;
+			out.append(text + start, i - start);
+			arg.append(out, text[i + 1]);
+		}
+		start = i + 2;
+		++i;
+	}
+	out.append(text + start, size - start);
+}
+
+} // !logRecord
+} // !log42
+
+/* ************************************************************************** */
+/*                                                                            */
+/*                                MIT License                                 */
+/*                                                                            */
+/*   Copyright (c) 2025 Demont Pieric, Lucken Bénédict                        */
+/*                                                                            */
+/*   Inspired by the Python 'logging' module by Vinay Sajip.                  */
+/*   This implementation was rewritten in C++98 and contains no original      */
+/*   Python source code.                                                      */
+/*                                                                            */
+/*   Permission is hereby granted, free of charge, to any person obtaining    */
+/*   a copy of this software and associated documentation files (the          */
+/*   "Software"), to deal in the Software without restriction, including      */
+/*   without limitation the rights to use, copy, modify, merge, publish,      */
+/*   distribute, sublicense, and/or sell copies of the Software, and to       */
+/*   permit persons to whom the Software is furnished to do so, subject to    */
+/*   the following conditions:                                                */
+/*                                                                            */
+/*   The above copyright notice and this permission notice shall be included  */
+/*   in all copies or substantial portions of the Software.                   */
+/*                                                                            */
+/*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS  */
+/*   OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF               */
+/*   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.   */
+/*   IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY     */
+/*   CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,     */
+/*   TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE        */
+/*   SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                   */
+/*                                                                            */
+/* ************************************************************************** */
@@ -17,6 +17,7 @@
 
 #include <common/common.hpp>
 #include <log42/Node.hpp>
+#include <log42/Sync.hpp>
 #include <string>
 
 namespace log42
@@ -26,20 +27,38 @@ namespace log42
  * @brief Constructs a Node with the given name.
  *
  * @param name The name of the node.
+ * @param kind The kind of the node.
  */
-Node::Node(const std::string &name) : _name(name), _parent() {}
+Node::Node(const std::string &name, const e_Kind kind)
+	: _name(name), _parent(NULL), _firstChild(NULL), _nextSibling(NULL), _prevSibling(NULL), _kind(kind) {}
 
 /**
- * @brief Destructor for Node.
+ * @brief Destructor for Node. Unlinks the node from its parent and orphans
+ * its children.
  */
-Node::~Node() {};
+Node::~Node()
+{
+	Node *parent = this->getParent();
+	if (parent)
+		parent->_unlinkChild(this);
+	while (this->_firstChild)
+	{
+		Node *child = this->_firstChild;
+		this->_unlinkChild(child);
+		sync::store(child->_parent, static_cast<Node *>(NULL));
+	}
+}
 
 /**
  * @brief Copy constructor for Node.
  *
  * @param rhs The Node to copy.
  */
-Node::Node(const Node &rhs) : _name(rhs._name), _parent(rhs._parent) {}
+Node::Node(const Node &rhs)
+	: _name(rhs._name), _parent(NULL), _firstChild(NULL), _nextSibling(NULL), _prevSibling(NULL), _kind(rhs._kind)
+{
+	this->setParent(rhs.getParent());
+}
 
 /**
  * @brief Assignment operator for Node.
@@ -52,7 +71,7 @@ Node &Node::operator=(const Node &rhs)
 	if (this != &rhs)
 	{
 		this->_name = rhs._name;
-		this->_parent = rhs._parent;
+		this->setParent(rhs.getParent());
 	}
 	return (*this);
 }
@@ -68,24 +87,123 @@ const std::string	&Node::getName() const
 }
 
 /**
- * @brief Gets the parent node.
+ * @brief Gets the first of the nodes whose parent this node is.
+ *
+ * @return Pointer to the first child, or NULL if there is none.
+ */
+Node	*Node::getFirstChild() const
+{
+	return (this->_firstChild);
+}
+
+/**
+ * @brief Gets the next child of this node's parent.
+ *
+ * @return Pointer to the next sibling, or NULL for the last child.
+ */
+Node	*Node::getNextSibling() const
+{
+	return (this->_nextSibling);
+}
+
+/**
+ * @brief Sets the parent node, moving this node to the new parent's
+ * children.
+ *
+ * @param parent Pointer to the parent Node, or NULL to detach the node.
+ */
+void	Node::setParent(Node *parent)
+{
+	Node *previous = this->getParent();
+	if (previous)
+		previous->_unlinkChild(this);
+	sync::store(this->_parent, parent);
+	if (parent)
+		parent->_linkChild(this);
+}
+
+/**
+ * @brief Estimates the memory held by the node.
+ *
+ * @return Size in bytes of the object and of its name.
+ */
+std::size_t	Node::getFootprint() const
+{
+	return (sizeof(*this) + stringFootprint(this->_name));
+}
+
+/**
+ * @brief Estimates the heap memory held by a string.
+ *
+ * A string short enough to be stored inline, as most implementations do
+ * within the string object, costs nothing beyond the object itself.
+ *
+ * @param str The string.
+ * @return Size in bytes of the string's heap buffer, or 0.
+ */
+std::size_t	Node::stringFootprint(const std::string &str)
+{
+	if (str.capacity() < sizeof(std::string))
+		return (0);
+	return (str.capacity() + 1);
+}
+
+/**
+ * @brief Allocates the memory of a node, released by operator delete.
+ *
+ * @param size The size of the node.
+ * @return The memory.
+ */
+void	*Node::operator new(std::size_t size)
+{
+	return (::operator new(size));
+}
+
+/**
+ * @brief Frees the memory of a destroyed node through the Epoch.
+ *
+ * The Manager drops its references to a node under its lock, so the
+ * destructor runs there; a thread that found the node in the registry just
+ * before may still read it until its guard ends.
+ *
+ * @param ptr The memory of the node.
+ */
+void	Node::operator delete(void *ptr)
+{
+	sync::Epoch::retireMemory(ptr);
+}
+
+/**
+ * @brief Adds a node at the head of this node's children.
  *
- * @return Pointer to the parent Node.
+ * @param child The node.
  */
-common::core::raii::SharedPtr<Node> Node::getParent() const
+void	Node::_linkChild(Node *child)
 {
-	common::core::raii::SharedPtr<Node> parentSp = this->_parent.lock();
-	return (parentSp);
+	child->_prevSibling = NULL;
+	child->_nextSibling = this->_firstChild;
+	if (this->_firstChild)
+		this->_firstChild->_prevSibling = child;
+	this->_firstChild = child;
 }
 
 /**
- * @brief Sets the parent node.
+ * @brief Removes a node from this node's children, if it is linked there.
  *
- * @param parent Pointer to the parent Node.
+ * @param child The node.
  */
-void	Node::setParent(const common::core::raii::SharedPtr<Node> &parent)
+void	Node::_unlinkChild(Node *child)
 {
-	this->_parent = common::core::raii::WeakPtr<Node>(parent);
+	if (child->_prevSibling)
+		child->_prevSibling->_nextSibling = child->_nextSibling;
+	else if (this->_firstChild == child)
+		this->_firstChild = child->_nextSibling;
+	else
+		return ;
+	if (child->_nextSibling)
+		child->_nextSibling->_prevSibling = child->_prevSibling;
+	child->_prevSibling = NULL;
+	child->_nextSibling = NULL;
 }
 
 } // !log42
@@ -15,11 +15,10 @@
  * @brief Implements the PercentStyle class for percent-style log formatting.
  */ 
 
-#include <common/common.hpp>
 #include <log42/PercentStyle.hpp>
-#include <iomanip>
-
-using namespace common::core;
+#include <cstdio>
+#include <cstring>
+#include <stdexcept>
 
 namespace log42
 {
@@ -40,14 +39,50 @@ const std::string PercentStyle::asctimeFormat = "%(asctime)";
 const std::string PercentStyle::asctimeSearch = "%(asctime)";
 
 /**
- * @brief Constructs a PercentStyle object.
+ * @brief Names of the record attributes, indexed by e_Field.
+ */
+static const char	*fieldNames[] = {
+	"", "asctime", "created", "filename", "funcName", "levelname", "levelno",
+	"lineno", "message", "module", "msecs", "name", "pathname", "relativeCreated"
+};
+
+/**
+ * @brief Appends the decimal representation of an integer.
+ *
+ * @param out The buffer to append to.
+ * @param value The value to append.
+ * @param width Minimum number of digits, zero-padded.
+ */
+static void	appendNumber(arena::t_string &out, long value, int width = 0)
+{
+	char buffer[32];
+	char *end = buffer + sizeof(buffer);
+	char *p = end;
+	unsigned long u = value < 0 ? -static_cast<unsigned long>(value) : value;
+
+	do
+	{
+		*--p = static_cast<char>('0' + u % 10);
+		u /= 10;
+	} while (u);
+	while (end - p < width)
+		*--p = '0';
+	if (value < 0)
+		*--p = '-';
+	out.append(p, end - p);
+}
+
+/**
+ * @brief Constructs a PercentStyle object and compiles its format string.
  *
  * @param fmt The format string to use.
  * @param defaults Default values for format fields.
  */
 PercentStyle::PercentStyle(const std::string &fmt, const t_defaults defaults) 
-	: _fmt(fmt), _defaults(defaults) 
-{}
+	: _defaults(defaults), _segments(), _fmt(fmt), _usesTime(false)
+{
+	this->_compile();
+}
 
 /**
  * @brief Destructor for PercentStyle.
@@ -59,7 +94,8 @@ PercentStyle::~PercentStyle() {}
  *
  * @param rhs The PercentStyle to copy.
  */
-PercentStyle::PercentStyle(const PercentStyle &rhs) : _fmt(rhs._fmt), _defaults(rhs._defaults) {}
+PercentStyle::PercentStyle(const PercentStyle &rhs) 
+	: _defaults(rhs._defaults), _segments(rhs._segments), _fmt(rhs._fmt), _usesTime(rhs._usesTime) {}
 
 /**
  * @brief Assignment operator for PercentStyle.
@@ -73,6 +109,8 @@ PercentStyle &PercentStyle::operator=(const PercentStyle &rhs)
 	{
 		this->_fmt = rhs._fmt;
 		this->_defaults = rhs._defaults;
+		this->_segments = rhs._segments;
+		this->_usesTime = rhs._usesTime;
 	}
 	return (*this);
 }
@@ -94,7 +132,7 @@ std::string PercentStyle::getFmt() const
  */
 bool PercentStyle::useTime() const
 {
-	return (this->_fmt.find(asctimeSearch) != std::string::npos);
+	return (this->_usesTime);
 }
 
 /**
@@ -112,52 +150,209 @@ void PercentStyle::validate() const
  * @brief Formats a log record according to the format string.
  *
  * @param record The log record to format.
+ * @param asctime The formatted creation time of the record.
  * @return The formatted log message.
  */
-std::string	PercentStyle::format(const logRecord::LogRecord &record) const
+std::string	PercentStyle::format(const logRecord::LogRecord &record, const std::string &asctime) const
 {
-	return (this->_format(record));
+	arena::Scope scope;
+	arena::t_string out;
+	this->_format(record, asctime, out);
+	return (std::string(out.data(), out.size()));
+}
+
+/**
+ * @brief Formats a log record according to the format string, appending the
+ * result to a dispatch buffer.
+ *
+ * @param record The log record to format.
+ * @param asctime The formatted creation time of the record.
+ * @param out The buffer to append to.
+ */
+void	PercentStyle::format(const logRecord::LogRecord &record, const StringRef &asctime, arena::t_string &out) const
+{
+	this->_format(record, asctime, out);
 }
 
 /**
  * @brief Internal formatting implementation for percent-style formatting.
  *
  * @param record The log record to format.
- * @return The formatted log message.
+ * @param asctime The formatted creation time of the record.
+ * @param out The buffer to append to.
+ */
+void	PercentStyle::_format(const logRecord::LogRecord &record, const StringRef &asctime, arena::t_string &out) const
+{
+	t_segments::const_iterator it;
+	for (it = this->_segments.begin(); it != this->_segments.end(); ++it)
+	{
+		if (it->field == LITERAL)
+			out.append(it->text.data(), it->text.size());
+		else if (it->field == EXTRA)
+			this->_appendExtra(record, *it, out);
+		else
+			this->_appendField(record, it->field, asctime, out);
+	}
+}
+
+/**
+ * @brief Splits the format string into literal and attribute segments.
+ *
+ * Placeholders naming a record attribute become attribute segments and the
+ * others field segments, which fall back to the default of that name or to
+ * the placeholder itself.
  */
-std::string	PercentStyle::_format(const logRecord::LogRecord &record) const
-{
-	std::string result = this->_fmt;
-	t_defaults defaults(this->_defaults);
-
-	defaults["created"] = utils::toString(record.getCreated());
-	defaults["filename"] = record.getFilename();
-	defaults["funcName"] = record.getFuncName();
-	defaults["levelname"] = record.getLevelName();
-	defaults["levelno"] = utils::toString(record.getLevelNo());
-	defaults["lineno"] = utils::toString(record.getLineNo());
-	defaults["message"] = record.getMessage();
-	defaults["module"] = record.getModule();
-	std::ostringstream oss;
-	oss << std::setfill('0') << std::setw(3) << utils::toString(record.getMsecs());
-	defaults["msecs"] = oss.str();
-	defaults["name"] = record.getName();
-	defaults["pathname"] = record.getPathname();
-	defaults["relativeCreated"] = utils::toString(record.getRelativeCreated());
-	defaults["asctime"] = record.getAsctime();
-
-	t_defaults::iterator it;
-	for (it = defaults.begin(); it != defaults.end(); ++it)
+void	PercentStyle::_compile()
+{
+	std::size_t start = 0;
+	std::size_t pos = 0;
+	std::string literal;
+
+	this->_segments.clear();
+	this->_usesTime = false;
+	while ((pos = this->_fmt.find("%(", pos)) != std::string::npos)
 	{
-		std::string placeholder = "%(" + it->first + ")";
-		std::size_t pos = 0;
-		while ((pos = result.find(placeholder, pos)) != std::string::npos)
+		std::size_t close = this->_fmt.find(')', pos + 2);
+		if (close == std::string::npos)
+			break ;
+
+		std::string key = this->_fmt.substr(pos + 2, close - pos - 2);
+		e_Field field = _lookup(key.c_str(), key.size());
+		literal.append(this->_fmt, start, pos - start);
+		if (!literal.empty())
+		{
+			Segment text = { LITERAL, literal, "" };
+			this->_segments.push_back(text);
+			literal.clear();
+		}
+		if (field != LITERAL)
+		{
+			Segment attribute = { field, key, "" };
+			this->_segments.push_back(attribute);
+			if (field == ASCTIME)
+				this->_usesTime = true;
+		}
+		else
 		{
-			result.replace(pos, placeholder.length(), it->second);
-			pos += it->second.length();
+			t_defaults::const_iterator it = this->_defaults.find(key);
+			Segment extra = { EXTRA, key, it != this->_defaults.end()
+				? it->second : this->_fmt.substr(pos, close + 1 - pos) };
+			this->_segments.push_back(extra);
 		}
+		pos = close + 1;
+		start = pos;
+	}
+	literal.append(this->_fmt, start, std::string::npos);
+	if (!literal.empty())
+	{
+		Segment text = { LITERAL, literal, "" };
+		this->_segments.push_back(text);
+	}
+}
+
+/**
+ * @brief Resolves a placeholder name to a record attribute.
+ *
+ * @param name The placeholder name.
+ * @param len The length of the name.
+ * @return The attribute, or LITERAL if the name is not a record attribute.
+ */
+PercentStyle::e_Field	PercentStyle::_lookup(const char *name, std::size_t len)
+{
+	for (int field = ASCTIME; field <= RELATIVECREATED; ++field)
+	{
+		if (std::strlen(fieldNames[field]) == len && std::strncmp(fieldNames[field], name, len) == 0)
+			return (static_cast<e_Field>(field));
+	}
+	return (LITERAL);
+}
+
+/**
+ * @brief Appends the value of a record attribute.
+ *
+ * @param record The log record to read from.
+ * @param field The attribute to append.
+ * @param asctime The formatted creation time of the record.
+ * @param out The buffer to append to.
+ */
+void	PercentStyle::_appendField(const logRecord::LogRecord &record, e_Field field, const StringRef &asctime, arena::t_string &out) const
+{
+	char buffer[32];
+
+	switch (field)
+	{
+		case ASCTIME: this->_appendExpanded(record, asctime, out); break ;
+		case CREATED: appendNumber(out, static_cast<long>(record.getCreated())); break ;
+		case FILENAME: out.append(record.getFilename()); break ;
+		case FUNCNAME: out.append(record.getFuncName()); break ;
+		case LEVELNAME: out.append(record.getLevelName()); break ;
+		case LEVELNO: appendNumber(out, record.getLevelNo()); break ;
+		case LINENO: appendNumber(out, record.getLineNo()); break ;
+		case MESSAGE: record.appendMessage(out); break ;
+		case MODULE: out.append(record.getModule()); break ;
+		case MSECS: appendNumber(out, record.getMsecs(), 3); break ;
+		case NAME: out.append(record.getName()); break ;
+		case PATHNAME: out.append(record.getPathname()); break ;
+		case RELATIVECREATED:
+			std::snprintf(buffer, sizeof(buffer), "%g", record.getRelativeCreated());
+			out.append(buffer);
+			break ;
+		default: break ;
+	}
+}
+
+/**
+ * @brief Appends a structured field of the record, or the fallback of the
+ * segment if the record lacks it.
+ *
+ * @param record The log record to read from.
+ * @param segment The field segment.
+ * @param out The buffer to append to.
+ */
+void	PercentStyle::_appendExtra(const logRecord::LogRecord &record, const Segment &segment, arena::t_string &out) const
+{
+	Arg value;
+
+	if (record.getField(segment.text, value))
+		value.append(out, 's');
+	else
+		out.append(segment.fallback.data(), segment.fallback.size());
+}
+
+/**
+ * @brief Appends text produced outside the format, such as the formatted
+ * time, expanding the record attributes it refers to.
+ *
+ * This is what lets a date format contain %(msecs).
+ *
+ * @param record The log record to read from.
+ * @param text The text to expand.
+ * @param out The buffer to append to.
+ */
+void	PercentStyle::_appendExpanded(const logRecord::LogRecord &record, const StringRef &text, arena::t_string &out) const
+{
+	const char *data = text.data();
+	std::size_t size = text.size();
+	std::size_t start = 0;
+
+	for (std::size_t i = 0; i + 1 < size; ++i)
+	{
+		if (data[i] != '%' || data[i + 1] != '(')
+			continue ;
+		const char *close = static_cast<const char *>(std::memchr(data + i + 2, ')', size - i - 2));
+		if (!close)
+			break ;
+
+		std::size_t len = close - (data + i + 2);
+		e_Field field = _lookup(data + i + 2, len);
+		if (field == LITERAL || field == ASCTIME)
+			continue ;
+		out.append(data + start, i - start);
+		this->_appendField(record, field, StringRef(""), out);
+		i += len + 2;
+		start = i + 1;
 	}
-	return (result);
+	out.append(data + start, size - start);
 }
 
 } // !style
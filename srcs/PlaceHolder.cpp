@@ -15,9 +15,9 @@
  * @brief Implements the PlaceHolder class for managing placeholder loggers.
  */ 
 
-#include <common/common.hpp>
 #include <log42/Node.hpp>
 #include <log42/PlaceHolder.hpp>
+#include <algorithm>
 
 namespace log42
 {
@@ -27,12 +27,13 @@ namespace placeholder
 /**
  * @brief Constructs a PlaceHolder with an initial logger.
  *
+ * @param name The name the placeholder stands for.
  * @param alogger Pointer to the initial logger node.
  */
-PlaceHolder::PlaceHolder(const common::core::raii::SharedPtr<Node> &alogger) : Node(alogger ? alogger->getName() : ""), _loggerSet()
+PlaceHolder::PlaceHolder(const std::string &name, Node *alogger) : Node(name, Node::PLACEHOLDER), _loggerSet()
 {
 	if (alogger)
-		this->_loggerSet.insert(alogger);
+		this->_loggerSet.push_back(alogger);
 };
 
 /**
@@ -66,20 +67,43 @@ PlaceHolder &PlaceHolder::operator=(const PlaceHolder &rhs)
 /**
  * @brief Appends a logger node to the placeholder set.
  *
+ * A logger is appended once, when it is created.
+ *
  * @param alogger Pointer to the logger node to append.
  */
-void	PlaceHolder::append(const common::core::raii::SharedPtr<Node> &alogger)
+void	PlaceHolder::append(Node *alogger)
 {
 	if (alogger)
-		this->_loggerSet.insert(alogger);
+		this->_loggerSet.push_back(alogger);
+}
+
+/**
+ * @brief Removes logger nodes from the placeholder set.
+ *
+ * The list is compacted in one pass, and its storage is given back once it
+ * is mostly empty.
+ *
+ * @param nodes The nodes to remove, sorted by address.
+ */
+void	PlaceHolder::remove(const t_nodes &nodes)
+{
+	std::size_t kept = 0;
+	for (std::size_t i = 0; i < this->_loggerSet.size(); ++i)
+	{
+		if (!std::binary_search(nodes.begin(), nodes.end(), this->_loggerSet[i]))
+			this->_loggerSet[kept++] = this->_loggerSet[i];
+	}
+	this->_loggerSet.resize(kept);
+	if (kept < this->_loggerSet.capacity() / 4)
+		t_nodes(this->_loggerSet).swap(this->_loggerSet);
 }
 
 /**
- * @brief Gets the set of logger nodes associated with this placeholder.
+ * @brief Gets the logger nodes associated with this placeholder.
  *
- * @return Reference to the set of logger node pointers.
+ * @return Reference to the logger node pointers.
  */
-const std::set<common::core::raii::SharedPtr<Node> > &PlaceHolder::getLoggerSet() const
+const t_nodes	&PlaceHolder::getLoggerSet() const
 {
 	return (this->_loggerSet);
 }
@@ -95,6 +119,16 @@ std::string PlaceHolder::toString() const
 	return ("<PlaceHolder " + getName());
 }
 
+/**
+ * @brief Estimates the memory held by the placeholder.
+ *
+ * @return Size in bytes of the object, its name and its logger list.
+ */
+std::size_t	PlaceHolder::getFootprint() const
+{
+	return (sizeof(*this) + stringFootprint(this->getName()) + this->_loggerSet.capacity() * sizeof(Node *));
+}
+
 } // !placeholder
 } // !log42
 
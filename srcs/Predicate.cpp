@@ -0,0 +1,141 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   Predicate.cpp                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: pdemont <pdemont@student.42lausanne.ch>    +#+  +:+       +#+        */
+/*   By: blucken <blucken@student.42lausanne.ch>  +#+#+#+#+#+   +#+           */
+/*                                                     #+#    #+#             */
+/*   Created: 2026/10/18                              ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+/**
+ * @file Predicate.cpp
+ * @brief Implements the Predicate interface.
+ */ 
+
+#include <log42/Filterer.hpp>
+#include <log42/Predicate.hpp>
+
+namespace log42
+{
+namespace filter
+{
+
+namespace
+{
+
+/**
+ * @brief Set while the calling thread logs a summary.
+ */
+__thread bool	summarizing = false;
+
+/**
+ * @brief Marks the calling thread as logging a summary for its lifetime.
+ */
+struct SummaryScope
+{
+	SummaryScope()
+	{
+		summarizing = true;
+	}
+
+	~SummaryScope()
+	{
+		summarizing = false;
+	}
+};
+
+} // !namespace
+
+/**
+ * @brief Constructs a Predicate.
+ */
+Predicate::Predicate() {}
+
+/**
+ * @brief Destructor for Predicate.
+ */
+Predicate::~Predicate() {}
+
+/**
+ * @brief Tells whether the calling thread is logging a summary, which every
+ * predicate passes.
+ *
+ * @return True inside _summarize().
+ */
+bool	Predicate::_isSummary()
+{
+	return (summarizing);
+}
+
+/**
+ * @brief Hands a summary record, with the logger name, level and call site
+ * of a record, to the filterer applying the predicate: a handler emits it
+ * itself, and a logger passes it to its handlers and its ancestors'.
+ *
+ * @param record The record the summary is about.
+ * @param msg The summary message.
+ * @param args The arguments of the summary message.
+ * @param owner The filterer test() was called by.
+ */
+void	Predicate::_summarize(const logRecord::LogRecord &record, const StringRef &msg, const Args &args,
+			filterer::Filterer &owner)
+{
+	Predicate::_summarize(record.getName(), record.getLevelNo(), record.getCallSite(), msg, args, owner);
+}
+
+/**
+ * @brief Hands a summary record with the given logger name, level and call
+ * site to the filterer applying the predicate, for records that are no
+ * longer at hand.
+ *
+ * @param name The logger name of the summarized records.
+ * @param level The level of the summarized records.
+ * @param site The call site of the summarized records, or NULL.
+ * @param msg The summary message.
+ * @param args The arguments of the summary message.
+ * @param owner The filterer test() was called by.
+ */
+void	Predicate::_summarize(const StringRef &name, const logRecord::e_LogLevel level,
+			const logRecord::CallSite *site, const StringRef &msg, const Args &args,
+			filterer::Filterer &owner)
+{
+	logRecord::LogRecord summary(name, level, site, msg, args);
+	SummaryScope scope;
+	owner._handleSummary(summary);
+}
+
+} // !filter
+} // !log42
+
+/* ************************************************************************** */
+/*                                                                            */
+/*                                MIT License                                 */
+/*                                                                            */
+/*   Copyright (c) 2025 Demont Pieric, Lucken Bénédict                        */
+/*                                                                            */
+/*   Inspired by the Python 'logging' module by Vinay Sajip.                  */
+/*   This implementation was rewritten in C++98 and contains no original      */
+/*   Python source code.                                                      */
+/*                                                                            */
+/*   Permission is hereby granted, free of charge, to any person obtaining    */
+/*   a copy of this software and associated documentation files (the          */
+/*   "Software"), to deal in the Software without restriction, including      */
+/*   without limitation the rights to use, copy, modify, merge, publish,      */
+/*   distribute, sublicense, and/or sell copies of the Software, and to       */
+/*   permit persons to whom the Software is furnished to do so, subject to    */
+/*   the following conditions:                                                */
+/*                                                                            */
+/*   The above copyright notice and this permission notice shall be included  */
+/*   in all copies or substantial portions of the Software.                   */
+/*                                                                            */
+/*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS  */
+/*   OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF               */
+/*   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.   */
+/*   IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY     */
+/*   CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,     */
+/*   TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE        */
+/*   SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                   */
+/*                                                                            */
+/* ************************************************************************** */
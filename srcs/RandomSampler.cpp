@@ -0,0 +1,91 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   RandomSampler.cpp                                  :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: pdemont <pdemont@student.42lausanne.ch>    +#+  +:+       +#+        */
+/*   By: blucken <blucken@student.42lausanne.ch>  +#+#+#+#+#+   +#+           */
+/*                                                     #+#    #+#             */
+/*   Created: 2026/10/18                              ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+/**
+ * @file RandomSampler.cpp
+ * @brief Implements the RandomSampler.
+ */ 
+
+#include <log42/RandomSampler.hpp>
+
+namespace log42
+{
+namespace filter
+{
+
+/**
+ * @brief Constructs a RandomSampler.
+ *
+ * @param rate Probability of keeping a record, from 0 (none) to 1 (all).
+ */
+RandomSampler::RandomSampler(const double rate)
+	: Sampler(), _threshold(rate <= 0 ? 0 : rate >= 1 ? 0x100000000UL : static_cast<unsigned long>(rate * 4294967296.0)) {}
+
+/**
+ * @brief Destructor for RandomSampler.
+ */
+RandomSampler::~RandomSampler() {}
+
+/**
+ * @brief Gets the estimated cost of a decision.
+ *
+ * @return 5: a few thread-local arithmetic operations.
+ */
+unsigned int	RandomSampler::getCost() const
+{
+	return (5);
+}
+
+/**
+ * @brief Draws whether a record is kept.
+ *
+ * @param site Unused.
+ * @return True with the configured probability.
+ */
+bool	RandomSampler::_sample(const logRecord::CallSite *site) const
+{
+	(void)site;
+	return (Sampler::_random() < this->_threshold);
+}
+
+} // !filter
+} // !log42
+
+/* ************************************************************************** */
+/*                                                                            */
+/*                                MIT License                                 */
+/*                                                                            */
+/*   Copyright (c) 2025 Demont Pieric, Lucken Bénédict                        */
+/*                                                                            */
+/*   Inspired by the Python 'logging' module by Vinay Sajip.                  */
+/*   This implementation was rewritten in C++98 and contains no original      */
+/*   Python source code.                                                      */
+/*                                                                            */
+/*   Permission is hereby granted, free of charge, to any person obtaining    */
+/*   a copy of this software and associated documentation files (the          */
+/*   "Software"), to deal in the Software without restriction, including      */
+/*   without limitation the rights to use, copy, modify, merge, publish,      */
+/*   distribute, sublicense, and/or sell copies of the Software, and to       */
+/*   permit persons to whom the Software is furnished to do so, subject to    */
+/*   the following conditions:                                                */
+/*                                                                            */
+/*   The above copyright notice and this permission notice shall be included  */
+/*   in all copies or substantial portions of the Software.                   */
+/*                                                                            */
+/*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS  */
+/*   OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF               */
+/*   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.   */
+/*   IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY     */
+/*   CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,     */
+/*   TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE        */
+/*   SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                   */
+/*                                                                            */
+/* ************************************************************************** */
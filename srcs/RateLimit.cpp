@@ -0,0 +1,234 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   RateLimit.cpp                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: pdemont <pdemont@student.42lausanne.ch>    +#+  +:+       +#+        */
+/*   By: blucken <blucken@student.42lausanne.ch>  +#+#+#+#+#+   +#+           */
+/*                                                     #+#    #+#             */
+/*   Created: 2026/10/18                              ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+/**
+ * @file RateLimit.cpp
+ * @brief Implements the RateLimit predicate.
+ */ 
+
+#include <log42/RateLimit.hpp>
+#include <log42/Sync.hpp>
+#include <time.h>
+
+namespace log42
+{
+namespace filter
+{
+
+namespace
+{
+
+/**
+ * @brief Reads the monotonic clock.
+ *
+ * @return The time in nanoseconds.
+ */
+unsigned long	nowNanos()
+{
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (static_cast<unsigned long>(ts.tv_sec) * 1000000000UL + static_cast<unsigned long>(ts.tv_nsec));
+}
+
+/**
+ * @brief Hashes a logger name into a non-null key.
+ *
+ * @param name The logger name.
+ * @return The key.
+ */
+unsigned long	nameKey(const char *name)
+{
+	unsigned long hash = 14695981039346656037UL;
+	for (; *name; ++name)
+		hash = (hash ^ static_cast<unsigned char>(*name)) * 1099511628211UL;
+	return (hash ? hash : 1);
+}
+
+} // !namespace
+
+/**
+ * @brief Constructs a RateLimit.
+ *
+ * @param perSecond Records passed per second and key, in the long run.
+ * @param burst Records a full bucket passes at once.
+ * @param key PER_CALL_SITE or PER_LOGGER.
+ * @param capacity Number of buckets, rounded up to a power of two.
+ */
+RateLimit::RateLimit(const double perSecond, const unsigned int burst, const e_Key key, const std::size_t capacity)
+	: Predicate(),
+	_interval(perSecond > 0 ? static_cast<unsigned long>(1e9 / perSecond) : 1000000000UL),
+	_tolerance(0), _key(key), _buckets(NULL), _mask(0), _suppressed(0)
+{
+	std::size_t size = maxProbes;
+	while (size < capacity)
+		size <<= 1;
+	if (this->_interval == 0)
+		this->_interval = 1;
+	this->_tolerance = (burst > 1 ? burst - 1 : 0) * this->_interval;
+	this->_buckets = new Bucket[size]();
+	this->_mask = size - 1;
+}
+
+/**
+ * @brief Destructor for RateLimit.
+ */
+RateLimit::~RateLimit()
+{
+	delete[] this->_buckets;
+}
+
+/**
+ * @brief Takes a token from the record's bucket.
+ *
+ * The bucket is full again at `full`; a record arriving at `now` passes if
+ * the bucket holds a token, i.e. if `full - now` is within the burst, and
+ * moves `full` one interval later.
+ *
+ * @param record The log record to check.
+ * @param owner The filterer applying the predicate.
+ * @return True if the record passes, false if it is dropped.
+ */
+bool	RateLimit::test(const logRecord::LogRecord &record, filterer::Filterer &owner) const
+{
+	if (Predicate::_isSummary())
+		return (true);
+
+	unsigned long key = (this->_key == PER_LOGGER) ? nameKey(record.getName())
+		: reinterpret_cast<unsigned long>(record.getCallSite());
+	Bucket *bucket = this->_bucket(key ? key : 1);
+	const unsigned long now = nowNanos();
+	unsigned long full = sync::load(bucket->full);
+
+	for (;;)
+	{
+		unsigned long start = full > now ? full : now;
+		if (start - now > this->_tolerance)
+		{
+			sync::fetchAdd(bucket->dropped, 1UL);
+			sync::fetchAdd(this->_suppressed, 1UL);
+			return (false);
+		}
+		if (sync::compareAndSwap(bucket->full, full, start + this->_interval))
+			break ;
+		full = sync::load(bucket->full);
+	}
+
+	unsigned long dropped = sync::load(bucket->dropped);
+	while (dropped && !sync::compareAndSwap(bucket->dropped, dropped, 0UL))
+		dropped = sync::load(bucket->dropped);
+	if (dropped)
+		this->_report(record, dropped, owner);
+	return (true);
+}
+
+/**
+ * @brief Gets the estimated cost of a test.
+ *
+ * @return 30: a clock read and a compare-and-swap.
+ */
+unsigned int	RateLimit::getCost() const
+{
+	return (30);
+}
+
+/**
+ * @brief Tells whether the decision only depends on the level and call site.
+ *
+ * @return False: it depends on time.
+ */
+bool	RateLimit::isStatic() const
+{
+	return (false);
+}
+
+/**
+ * @brief Gets the number of records dropped so far.
+ *
+ * @return The number of records dropped by every bucket.
+ */
+unsigned long	RateLimit::getSuppressed() const
+{
+	return (sync::load(this->_suppressed));
+}
+
+/**
+ * @brief Finds the bucket of a key, claiming a free one on first use.
+ *
+ * @param key The non-null key.
+ * @return The key's bucket, or a shared one if its probe sequence is full.
+ */
+RateLimit::Bucket	*RateLimit::_bucket(const unsigned long key) const
+{
+	unsigned long hash = key * 2654435761UL;
+	std::size_t index = (hash ^ (hash >> 16)) & this->_mask;
+
+	for (std::size_t i = 0; i < maxProbes; ++i)
+	{
+		Bucket *bucket = &this->_buckets[(index + i) & this->_mask];
+		unsigned long current = sync::load(bucket->key);
+		if (current == key)
+			return (bucket);
+		if (current == 0 && (sync::compareAndSwap(bucket->key, 0UL, key) || sync::load(bucket->key) == key))
+			return (bucket);
+	}
+	return (&this->_buckets[index]);
+}
+
+/**
+ * @brief Logs how many records a bucket dropped, through the record's
+ * logger and at its level.
+ *
+ * @param record The first record passed after the drops.
+ * @param count The number of records dropped.
+ * @param owner The filterer applying the predicate.
+ */
+void	RateLimit::_report(const logRecord::LogRecord &record, const unsigned long count, filterer::Filterer &owner) const
+{
+	if (this->_key == PER_CALL_SITE)
+		Predicate::_summarize(record, "suppressed %d similar messages from %s:%d",
+			Args(count, record.getFilename(), record.getLineNo()), owner);
+	else
+		Predicate::_summarize(record, "suppressed %d similar messages", Args(count), owner);
+}
+
+} // !filter
+} // !log42
+
+/* ************************************************************************** */
+/*                                                                            */
+/*                                MIT License                                 */
+/*                                                                            */
+/*   Copyright (c) 2025 Demont Pieric, Lucken Bénédict                        */
+/*                                                                            */
+/*   Inspired by the Python 'logging' module by Vinay Sajip.                  */
+/*   This implementation was rewritten in C++98 and contains no original      */
+/*   Python source code.                                                      */
+/*                                                                            */
+/*   Permission is hereby granted, free of charge, to any person obtaining    */
+/*   a copy of this software and associated documentation files (the          */
+/*   "Software"), to deal in the Software without restriction, including      */
+/*   without limitation the rights to use, copy, modify, merge, publish,      */
+/*   distribute, sublicense, and/or sell copies of the Software, and to       */
+/*   permit persons to whom the Software is furnished to do so, subject to    */
+/*   the following conditions:                                                */
+/*                                                                            */
+/*   The above copyright notice and this permission notice shall be included  */
+/*   in all copies or substantial portions of the Software.                   */
+/*                                                                            */
+/*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS  */
+/*   OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF               */
+/*   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.   */
+/*   IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY     */
+/*   CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,     */
+/*   TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE        */
+/*   SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                   */
+/*                                                                            */
+/* ************************************************************************** */
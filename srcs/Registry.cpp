@@ -0,0 +1,341 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   Registry.cpp                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: pdemont <pdemont@student.42lausanne.ch>    +#+  +:+       +#+        */
+/*   By: blucken <blucken@student.42lausanne.ch>  +#+#+#+#+#+   +#+           */
+/*                                                     #+#    #+#             */
+/*   Created: 2026/10/18                              ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+/**
+ * @file Registry.cpp
+ * @brief Implements the Registry class.
+ */
+
+#include <log42/Registry.hpp>
+#include <log42/Sync.hpp>
+#include <cstring>
+
+namespace log42
+{
+namespace manager
+{
+
+/**
+ * @brief Allocates an entry with its name inline.
+ *
+ * @param name The full name of the node.
+ * @param node The logger or placeholder.
+ * @param alogger The node as a logger, NULL for a placeholder.
+ * @return The new entry, released with delete.
+ */
+Registry::Entry	*Registry::Entry::create(const std::string &name, Node *node, logger::Logger *alogger)
+{
+	Entry *entry = static_cast<Entry *>(::operator new(sizeof(Entry) + name.size()));
+	entry->hash = _hash(name);
+	entry->node = node;
+	entry->alogger = alogger;
+	entry->length = name.size();
+	std::memcpy(entry->name, name.data(), name.size());
+	entry->name[name.size()] = '\0';
+	return (entry);
+}
+
+/**
+ * @brief Releases an entry allocated by create.
+ *
+ * @param entry The entry.
+ */
+void	Registry::Entry::operator delete(void *entry)
+{
+	::operator delete(entry);
+}
+
+/**
+ * @brief Allocates a table of empty slots.
+ *
+ * @param capacity The number of slots, a power of two.
+ */
+Registry::Table::Table(std::size_t capacity) : mask(capacity - 1), slots(new Entry *[capacity]())
+{
+}
+
+/**
+ * @brief Frees the slots, leaving the entries to their owner.
+ */
+Registry::Table::~Table()
+{
+	delete[] this->slots;
+}
+
+/**
+ * @brief Constructs an empty registry.
+ */
+Registry::Registry() : _table(new Table(initialCapacity)), _size(0)
+{
+}
+
+/**
+ * @brief Destroys the registry and its entries.
+ */
+Registry::~Registry()
+{
+	for (std::size_t i = 0; i <= this->_table->mask; ++i)
+		delete this->_table->slots[i];
+	delete this->_table;
+}
+
+/**
+ * @brief Looks a logger up by name, without locking.
+ *
+ * @param name The full name of the logger.
+ * @return The logger, or NULL if the name is unknown (or not yet indexed) or
+ * designates a placeholder.
+ */
+logger::Logger	*Registry::find(const StringRef &name) const
+{
+	sync::Epoch::Guard guard;
+	const Entry *entry = this->_lookup(name);
+	return (entry ? entry->alogger : NULL);
+}
+
+/**
+ * @brief Looks a logger or placeholder up by name, without locking.
+ *
+ * @param name The full name of the node.
+ * @return The node, or NULL if the name is unknown (or not yet indexed).
+ */
+Node	*Registry::findNode(const StringRef &name) const
+{
+	sync::Epoch::Guard guard;
+	const Entry *entry = this->_lookup(name);
+	return (entry ? entry->node : NULL);
+}
+
+/**
+ * @brief Binds a name to a node, replacing its previous binding if any.
+ *
+ * Callers must serialize bindings.
+ *
+ * @param name The full name of the node.
+ * @param node The logger or placeholder.
+ * @param alogger The node as a logger, NULL for a placeholder.
+ */
+void	Registry::bind(const std::string &name, Node *node, logger::Logger *alogger)
+{
+	Entry *entry = Entry::create(name, node, alogger);
+
+	Table *table = this->_table;
+	std::size_t slot = _probe(table, entry->hash, name);
+	if (table->slots[slot])
+	{
+		Entry *previous = table->slots[slot];
+		sync::store(table->slots[slot], entry);
+		sync::Epoch::retire(previous);
+		return ;
+	}
+
+	if ((this->_size + 1) * 4 > (table->mask + 1) * 3)
+	{
+		table = this->_resize((table->mask + 1) * 2);
+		slot = _probe(table, entry->hash, name);
+	}
+	sync::store(table->slots[slot], entry);
+	++this->_size;
+}
+
+/**
+ * @brief Removes the binding of a name, if any.
+ *
+ * Callers must serialize this with bindings. The entries following the
+ * removed one in its probe sequence are shifted back so that every entry
+ * stays reachable from its home slot.
+ *
+ * @param name The full name of the node.
+ */
+void	Registry::unbind(const StringRef &name)
+{
+	Table *table = this->_table;
+	std::size_t hole = _probe(table, _hash(name), name);
+	Entry *removed = table->slots[hole];
+	if (!removed)
+		return ;
+
+	for (std::size_t i = (hole + 1) & table->mask; table->slots[i]; i = (i + 1) & table->mask)
+	{
+		Entry *entry = table->slots[i];
+		std::size_t home = entry->hash & table->mask;
+		if (((i - home) & table->mask) >= ((i - hole) & table->mask))
+		{
+			sync::store(table->slots[hole], entry);
+			hole = i;
+		}
+	}
+	sync::store(table->slots[hole], static_cast<Entry *>(NULL));
+	sync::Epoch::retire(removed);
+	--this->_size;
+	if (table->mask + 1 > initialCapacity && this->_size * 8 < table->mask + 1)
+		this->_resize((table->mask + 1) / 2);
+}
+
+/**
+ * @brief Removes every entry.
+ *
+ * Concurrent lookups keep reading the old table until they leave their
+ * guard, after which it is destroyed with its entries.
+ */
+void	Registry::clear()
+{
+	Table *table = this->_table;
+	__atomic_store_n(&this->_table, new Table(initialCapacity), __ATOMIC_SEQ_CST);
+	for (std::size_t i = 0; i <= table->mask; ++i)
+	{
+		if (table->slots[i])
+			sync::Epoch::retire(table->slots[i]);
+	}
+	sync::Epoch::retire(table);
+	this->_size = 0;
+}
+
+/**
+ * @brief Gets the number of indexed names.
+ *
+ * @return The number of entries.
+ */
+std::size_t	Registry::size() const
+{
+	return (this->_size);
+}
+
+/**
+ * @brief Gets the memory held by the registry.
+ *
+ * Callers must serialize this with bindings.
+ *
+ * @return Size in bytes of the registry, its table and its entries.
+ */
+std::size_t	Registry::getFootprint() const
+{
+	std::size_t bytes = sizeof(*this) + sizeof(Table) + (this->_table->mask + 1) * sizeof(Entry *);
+	for (std::size_t i = 0; i <= this->_table->mask; ++i)
+	{
+		if (this->_table->slots[i])
+			bytes += sizeof(Entry) + this->_table->slots[i]->length;
+	}
+	return (bytes);
+}
+
+/**
+ * @brief Moves the entries to a table of another size and swaps it in.
+ *
+ * Concurrent lookups keep reading the old table until they leave their
+ * guard, after which it is destroyed.
+ *
+ * @param capacity The number of slots of the new table, a power of two
+ * with room for every entry.
+ * @return The new table.
+ */
+Registry::Table	*Registry::_resize(std::size_t capacity)
+{
+	Table *table = this->_table;
+	Table *resized = new Table(capacity);
+	for (std::size_t i = 0; i <= table->mask; ++i)
+	{
+		Entry *moved = table->slots[i];
+		if (moved)
+			resized->slots[_probe(resized, moved->hash, StringRef(moved->name, moved->length))] = moved;
+	}
+	__atomic_store_n(&this->_table, resized, __ATOMIC_SEQ_CST);
+	sync::Epoch::retire(table);
+	return (resized);
+}
+
+/**
+ * @brief Hashes a name with 64-bit FNV-1a.
+ *
+ * @param name The name.
+ * @return The hash.
+ */
+unsigned long	Registry::_hash(const StringRef &name)
+{
+	unsigned long long hash = 14695981039346656037ULL;
+	const unsigned char *it = reinterpret_cast<const unsigned char *>(name.data());
+	for (std::size_t i = 0; i < name.size(); ++i)
+	{
+		hash ^= it[i];
+		hash *= 1099511628211ULL;
+	}
+	return (static_cast<unsigned long>(hash));
+}
+
+/**
+ * @brief Finds the slot holding a name, or the free slot ending its probe
+ * sequence.
+ *
+ * @param table The table, with at least one free slot.
+ * @param hash The hash of the name.
+ * @param name The name.
+ * @return The index of the slot.
+ */
+std::size_t	Registry::_probe(const Table *table, unsigned long hash, const StringRef &name)
+{
+	std::size_t i = hash & table->mask;
+	for (;;)
+	{
+		const Entry *entry = sync::load(table->slots[i]);
+		if (!entry || (entry->hash == hash && entry->length == name.size()
+			&& std::memcmp(entry->name, name.data(), name.size()) == 0))
+			return (i);
+		i = (i + 1) & table->mask;
+	}
+}
+
+/**
+ * @brief Finds the entry of a name in the current table.
+ *
+ * Must be called inside an Epoch::Guard, which keeps the entry alive.
+ *
+ * @param name The name.
+ * @return The entry, or NULL if the name is not indexed.
+ */
+const Registry::Entry	*Registry::_lookup(const StringRef &name) const
+{
+	const Table *table = __atomic_load_n(&this->_table, __ATOMIC_SEQ_CST);
+	return (sync::load(table->slots[_probe(table, _hash(name), name)]));
+}
+
+} // !manager
+} // !log42
+
+/* ************************************************************************** */
+/*                                                                            */
+/*                                MIT License                                 */
+/*                                                                            */
+/*   Copyright (c) 2025 Demont Pieric, Lucken Bénédict                        */
+/*                                                                            */
+/*   Inspired by the Python 'logging' module by Vinay Sajip.                  */
+/*   This implementation was rewritten in C++98 and contains no original      */
+/*   Python source code.                                                      */
+/*                                                                            */
+/*   Permission is hereby granted, free of charge, to any person obtaining    */
+/*   a copy of this software and associated documentation files (the          */
+/*   "Software"), to deal in the Software without restriction, including      */
+/*   without limitation the rights to use, copy, modify, merge, publish,      */
+/*   distribute, sublicense, and/or sell copies of the Software, and to       */
+/*   permit persons to whom the Software is furnished to do so, subject to    */
+/*   the following conditions:                                                */
+/*                                                                            */
+/*   The above copyright notice and this permission notice shall be included  */
+/*   in all copies or substantial portions of the Software.                   */
+/*                                                                            */
+/*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS  */
+/*   OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF               */
+/*   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.   */
+/*   IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY     */
+/*   CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,     */
+/*   TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE        */
+/*   SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                   */
+/*                                                                            */
+/* ************************************************************************** */
@@ -0,0 +1,114 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   ReservoirSampler.cpp                               :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: pdemont <pdemont@student.42lausanne.ch>    +#+  +:+       +#+        */
+/*   By: blucken <blucken@student.42lausanne.ch>  +#+#+#+#+#+   +#+           */
+/*                                                     #+#    #+#             */
+/*   Created: 2026/10/18                              ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+/**
+ * @file ReservoirSampler.cpp
+ * @brief Implements the ReservoirSampler.
+ */ 
+
+#include <log42/ReservoirSampler.hpp>
+#include <log42/Sync.hpp>
+#include <common/common.hpp>
+
+namespace log42
+{
+namespace filter
+{
+
+/**
+ * @brief Constructs a ReservoirSampler.
+ *
+ * @param size Records kept per window at most.
+ * @param seconds Length of a window.
+ */
+ReservoirSampler::ReservoirSampler(const unsigned long size, const unsigned int seconds)
+	: Sampler(), _size(size), _seconds(seconds ? seconds : 1), _window(0), _seen(0), _kept(0), _previous(0) {}
+
+/**
+ * @brief Destructor for ReservoirSampler.
+ */
+ReservoirSampler::~ReservoirSampler() {}
+
+/**
+ * @brief Gets the estimated cost of a decision.
+ *
+ * @return 20: a clock read and a few atomic operations.
+ */
+unsigned int	ReservoirSampler::getCost() const
+{
+	return (20);
+}
+
+/**
+ * @brief Counts a record in the current window and draws whether it is kept.
+ *
+ * The thread that moves the sampler to a new window carries the count of
+ * the old one over; records counted concurrently with the switch may be
+ * lost, which only skews the estimate of the volume.
+ *
+ * @param site Unused.
+ * @return True if the record is kept.
+ */
+bool	ReservoirSampler::_sample(const logRecord::CallSite *site) const
+{
+	(void)site;
+	const long window = static_cast<long>(common::core::utils::nowSec()) / this->_seconds;
+	long current = sync::load(this->_window);
+	if (current != window && sync::compareAndSwap(this->_window, current, window))
+	{
+		sync::store(this->_previous, current + 1 == window ? sync::load(this->_seen) : 0UL);
+		sync::store(this->_seen, 0UL);
+		sync::store(this->_kept, 0UL);
+	}
+
+	const unsigned long seen = sync::fetchAdd(this->_seen, 1UL) + 1;
+	const unsigned long previous = sync::load(this->_previous);
+	const unsigned long volume = seen > previous ? seen : previous;
+	if (sync::load(this->_kept) >= this->_size)
+		return (false);
+	if (volume > this->_size && Sampler::_random() * volume >= (this->_size << 32))
+		return (false);
+	return (sync::fetchAdd(this->_kept, 1UL) < this->_size);
+}
+
+} // !filter
+} // !log42
+
+/* ************************************************************************** */
+/*                                                                            */
+/*                                MIT License                                 */
+/*                                                                            */
+/*   Copyright (c) 2025 Demont Pieric, Lucken Bénédict                        */
+/*                                                                            */
+/*   Inspired by the Python 'logging' module by Vinay Sajip.                  */
+/*   This implementation was rewritten in C++98 and contains no original      */
+/*   Python source code.                                                      */
+/*                                                                            */
+/*   Permission is hereby granted, free of charge, to any person obtaining    */
+/*   a copy of this software and associated documentation files (the          */
+/*   "Software"), to deal in the Software without restriction, including      */
+/*   without limitation the rights to use, copy, modify, merge, publish,      */
+/*   distribute, sublicense, and/or sell copies of the Software, and to       */
+/*   permit persons to whom the Software is furnished to do so, subject to    */
+/*   the following conditions:                                                */
+/*                                                                            */
+/*   The above copyright notice and this permission notice shall be included  */
+/*   in all copies or substantial portions of the Software.                   */
+/*                                                                            */
+/*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS  */
+/*   OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF               */
+/*   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.   */
+/*   IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY     */
+/*   CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,     */
+/*   TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE        */
+/*   SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                   */
+/*                                                                            */
+/* ************************************************************************** */
@@ -0,0 +1,144 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   Sampler.cpp                                        :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: pdemont <pdemont@student.42lausanne.ch>    +#+  +:+       +#+        */
+/*   By: blucken <blucken@student.42lausanne.ch>  +#+#+#+#+#+   +#+           */
+/*                                                     #+#    #+#             */
+/*   Created: 2026/10/18                              ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+/**
+ * @file Sampler.cpp
+ * @brief Implements the Sampler interface.
+ */ 
+
+#include <log42/Sampler.hpp>
+#include <log42/Sync.hpp>
+#include <ctime>
+
+namespace log42
+{
+namespace filter
+{
+
+namespace
+{
+
+/**
+ * @brief State of the calling thread's generator; null until first used.
+ */
+__thread unsigned long	randomState = 0;
+
+} // !namespace
+
+/**
+ * @brief Constructs a Sampler.
+ */
+Sampler::Sampler() : Predicate(), _sampledOut(0) {}
+
+/**
+ * @brief Destructor for Sampler.
+ */
+Sampler::~Sampler() {}
+
+/**
+ * @brief Decides whether a record of a call site is kept, counting it if
+ * not. Summaries are always kept.
+ *
+ * @param site The call site of the record.
+ * @return True if the record is kept.
+ */
+bool	Sampler::keep(const logRecord::CallSite *site) const
+{
+	if (Predicate::_isSummary() || this->_sample(site))
+		return (true);
+	sync::fetchAdd(this->_sampledOut, 1UL);
+	return (false);
+}
+
+/**
+ * @brief Decides whether a record is kept.
+ *
+ * @param record The log record to check.
+ * @param owner The filterer applying the predicate.
+ * @return True if the record is kept.
+ */
+bool	Sampler::test(const logRecord::LogRecord &record, filterer::Filterer &owner) const
+{
+	(void)owner;
+	return (this->keep(record.getCallSite()));
+}
+
+/**
+ * @brief Tells whether the decision only depends on the level and call site.
+ *
+ * @return False: a sampler keeps a share of the records of each site.
+ */
+bool	Sampler::isStatic() const
+{
+	return (false);
+}
+
+/**
+ * @brief Gets the number of records sampled out so far.
+ *
+ * @return The number of records dropped.
+ */
+unsigned long	Sampler::getSampledOut() const
+{
+	return (sync::load(this->_sampledOut));
+}
+
+/**
+ * @brief Draws from the calling thread's xorshift generator, seeded from
+ * the thread and the time on first use.
+ *
+ * @return 32 random bits.
+ */
+unsigned long	Sampler::_random()
+{
+	unsigned long x = randomState;
+	if (x == 0)
+		x = (reinterpret_cast<unsigned long>(&randomState) ^ static_cast<unsigned long>(std::time(NULL))) | 1;
+	x ^= x << 13;
+	x ^= x >> 7;
+	x ^= x << 17;
+	randomState = x;
+	return ((x * 2685821657736338717UL) >> 32);
+}
+
+} // !filter
+} // !log42
+
+/* ************************************************************************** */
+/*                                                                            */
+/*                                MIT License                                 */
+/*                                                                            */
+/*   Copyright (c) 2025 Demont Pieric, Lucken Bénédict                        */
+/*                                                                            */
+/*   Inspired by the Python 'logging' module by Vinay Sajip.                  */
+/*   This implementation was rewritten in C++98 and contains no original      */
+/*   Python source code.                                                      */
+/*                                                                            */
+/*   Permission is hereby granted, free of charge, to any person obtaining    */
+/*   a copy of this software and associated documentation files (the          */
+/*   "Software"), to deal in the Software without restriction, including      */
+/*   without limitation the rights to use, copy, modify, merge, publish,      */
+/*   distribute, sublicense, and/or sell copies of the Software, and to       */
+/*   permit persons to whom the Software is furnished to do so, subject to    */
+/*   the following conditions:                                                */
+/*                                                                            */
+/*   The above copyright notice and this permission notice shall be included  */
+/*   in all copies or substantial portions of the Software.                   */
+/*                                                                            */
+/*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS  */
+/*   OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF               */
+/*   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.   */
+/*   IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY     */
+/*   CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,     */
+/*   TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE        */
+/*   SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                   */
+/*                                                                            */
+/* ************************************************************************** */
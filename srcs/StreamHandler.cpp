@@ -53,6 +53,7 @@ StreamHandler	&StreamHandler::operator=(const StreamHandler &rhs)
 	if (this != &rhs)
 	{
 		Handler::operator=(rhs);
+		sync::ScopedLock lock(this->_lock);
 		this->_stream = rhs._stream;
 	}
 	return (*this);
@@ -63,6 +64,7 @@ StreamHandler	&StreamHandler::operator=(const StreamHandler &rhs)
  */
 void	StreamHandler::flush()
 {
+	sync::ScopedLock lock(this->_lock);
 	if (this->_stream)
 		this->_stream->flush();
 }
@@ -76,8 +78,10 @@ void	StreamHandler::emit(logRecord::LogRecord &record)
 {
 	try
 	{
-		std::string msg = this->format(record);
-		*this->_stream << msg << "\n";	
+		arena::t_string msg;
+		this->format(record, msg);
+		msg.push_back('\n');
+		this->_stream->write(msg.data(), msg.size());
 		this->flush();
 	}
 	catch (...)
@@ -94,6 +98,7 @@ void	StreamHandler::emit(logRecord::LogRecord &record)
  */
 std::ostream	&StreamHandler::setStream(std::ostream &stream)
 {
+	sync::ScopedLock lock(this->_lock);
 	std::ostream	&old = *this->_stream;
 	this->flush();
 	this->_stream = &stream;
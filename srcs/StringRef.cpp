@@ -0,0 +1,145 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   StringRef.cpp                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: pdemont <pdemont@student.42lausanne.ch>    +#+  +:+       +#+        */
+/*   By: blucken <blucken@student.42lausanne.ch>  +#+#+#+#+#+   +#+           */
+/*                                                     #+#    #+#             */
+/*   Created: 2026/10/18                              ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+/**
+ * @file StringRef.cpp
+ * @brief Implements the StringRef class.
+ */ 
+
+#include <log42/StringRef.hpp>
+#include <cstring>
+
+namespace log42
+{
+
+/**
+ * @brief Constructs a StringRef over a NUL-terminated string.
+ *
+ * @param str The string to reference, NULL being treated as empty.
+ */
+StringRef::StringRef(const char *str) : _data(str ? str : ""), _size(str ? std::strlen(str) : 0) {}
+
+/**
+ * @brief Constructs a StringRef over the content of a std::string.
+ *
+ * @param str The string to reference.
+ */
+StringRef::StringRef(const std::string &str) : _data(str.data()), _size(str.size()) {}
+
+/**
+ * @brief Constructs a StringRef over a sized character sequence.
+ *
+ * @param data The characters to reference.
+ * @param size The number of characters.
+ */
+StringRef::StringRef(const char *data, std::size_t size) : _data(data), _size(size) {}
+
+/**
+ * @brief Destructor for StringRef.
+ */
+StringRef::~StringRef() {}
+
+/**
+ * @brief Copy constructor for StringRef.
+ *
+ * @param rhs The StringRef to copy.
+ */
+StringRef::StringRef(const StringRef &rhs) : _data(rhs._data), _size(rhs._size) {}
+
+/**
+ * @brief Assignment operator for StringRef.
+ *
+ * @param rhs The StringRef to assign from.
+ * @return Reference to this StringRef.
+ */
+StringRef	&StringRef::operator=(const StringRef &rhs)
+{
+	if (this != &rhs)
+	{
+		this->_data = rhs._data;
+		this->_size = rhs._size;
+	}
+	return (*this);
+}
+
+/**
+ * @brief Gets the referenced characters (not necessarily NUL-terminated).
+ *
+ * @return Pointer to the first character.
+ */
+const char	*StringRef::data() const
+{
+	return (this->_data);
+}
+
+/**
+ * @brief Gets the number of referenced characters.
+ *
+ * @return The size.
+ */
+std::size_t	StringRef::size() const
+{
+	return (this->_size);
+}
+
+/**
+ * @brief Checks whether the reference is empty.
+ *
+ * @return True if empty, false otherwise.
+ */
+bool	StringRef::empty() const
+{
+	return (this->_size == 0);
+}
+
+/**
+ * @brief Copies the referenced characters into a std::string.
+ *
+ * @return The owned copy.
+ */
+std::string	StringRef::str() const
+{
+	return (std::string(this->_data, this->_size));
+}
+
+} // !log42
+
+/* ************************************************************************** */
+/*                                                                            */
+/*                                MIT License                                 */
+/*                                                                            */
+/*   Copyright (c) 2025 Demont Pieric, Lucken Bénédict                        */
+/*                                                                            */
+/*   Inspired by the Python 'logging' module by Vinay Sajip.                  */
+/*   This implementation was rewritten in C++98 and contains no original      */
+/*   Python source code.                                                      */
+/*                                                                            */
+/*   Permission is hereby granted, free of charge, to any person obtaining    */
+/*   a copy of this software and associated documentation files (the          */
+/*   "Software"), to deal in the Software without restriction, including      */
+/*   without limitation the rights to use, copy, modify, merge, publish,      */
+/*   distribute, sublicense, and/or sell copies of the Software, and to       */
+/*   permit persons to whom the Software is furnished to do so, subject to    */
+/*   the following conditions:                                                */
+/*                                                                            */
+/*   The above copyright notice and this permission notice shall be included  */
+/*   in all copies or substantial portions of the Software.                   */
+/*                                                                            */
+/*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS  */
+/*   OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF               */
+/*   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.   */
+/*   IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY     */
+/*   CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,     */
+/*   TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE        */
+/*   SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                   */
+/*                                                                            */
+/* ************************************************************************** */
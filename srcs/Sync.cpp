@@ -0,0 +1,440 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   Sync.cpp                                           :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: pdemont <pdemont@student.42lausanne.ch>    +#+  +:+       +#+        */
+/*   By: blucken <blucken@student.42lausanne.ch>  +#+#+#+#+#+   +#+           */
+/*                                                     #+#    #+#             */
+/*   Created: 2026/10/18                              ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+/**
+ * @file Sync.cpp
+ * @brief Implements the Mutex, ScopedLock and Epoch classes.
+ */ 
+
+#include <log42/Sync.hpp>
+#include <climits>
+#include <time.h>
+
+namespace log42
+{
+namespace sync
+{
+
+/**
+ * @brief Constructs a Mutex.
+ *
+ * @param recursive True to let the owning thread lock it again.
+ */
+Mutex::Mutex(bool recursive)
+{
+	pthread_mutexattr_t attr;
+	pthread_mutexattr_init(&attr);
+	if (recursive)
+		pthread_mutexattr_settype(&attr, PTHREAD_MUTEX_RECURSIVE);
+	pthread_mutex_init(&this->_mutex, &attr);
+	pthread_mutexattr_destroy(&attr);
+}
+
+/**
+ * @brief Destructor for Mutex.
+ */
+Mutex::~Mutex()
+{
+	pthread_mutex_destroy(&this->_mutex);
+}
+
+/**
+ * @brief Locks the mutex, blocking until it is available.
+ */
+void	Mutex::lock()
+{
+	pthread_mutex_lock(&this->_mutex);
+}
+
+/**
+ * @brief Unlocks the mutex.
+ */
+void	Mutex::unlock()
+{
+	pthread_mutex_unlock(&this->_mutex);
+}
+
+/**
+ * @brief Locks a mutex until the end of the scope.
+ *
+ * @param mutex The mutex to hold.
+ */
+ScopedLock::ScopedLock(Mutex &mutex) : _mutex(mutex)
+{
+	this->_mutex.lock();
+}
+
+/**
+ * @brief Unlocks the held mutex.
+ */
+ScopedLock::~ScopedLock()
+{
+	this->_mutex.unlock();
+}
+
+/**
+ * @brief Gets the lock serializing the writers of an object.
+ *
+ * Objects are spread by address over a fixed set of locks, so an object
+ * that is rarely written does not carry a mutex of its own. The locks are
+ * never destroyed, which keeps them usable from static destructors.
+ *
+ * @param address The address of the object.
+ * @return The lock of the object's stripe.
+ */
+Mutex	&stripeLock(const void *address)
+{
+	static const std::size_t stripeCount = 64;
+	static Mutex *stripes = new Mutex[stripeCount];
+
+	std::size_t stripe = reinterpret_cast<std::size_t>(address) >> 4;
+	return (stripes[(stripe ^ (stripe >> 6)) % stripeCount]);
+}
+
+/**
+ * @brief Gets the lock serializing the writers of published values and the
+ * reference counts they hold.
+ *
+ * The lock is recursive, since destroying a retired version may destroy
+ * others, and is never destroyed.
+ *
+ * @return The lock.
+ */
+Mutex	&referenceLock()
+{
+	static Mutex *lock = new Mutex(true);
+	return (*lock);
+}
+
+/**
+ * @brief Tells whether a period has elapsed since the last time this
+ * returned true for the same timestamp, and claims the new period if so.
+ *
+ * Backs LOG_EVERY_MS, whose timestamp is a static of the call site. Of
+ * the threads racing past an elapsed period, exactly one wins the
+ * compare-and-swap.
+ *
+ * @param last Monotonic time, in milliseconds, of the last success; null
+ * before the first one.
+ * @param period Milliseconds between two successes.
+ * @return True if the period was claimed.
+ */
+bool	everyMillis(unsigned long &last, const unsigned long period)
+{
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	const unsigned long now = static_cast<unsigned long>(ts.tv_sec) * 1000UL + static_cast<unsigned long>(ts.tv_nsec) / 1000000UL + 1;
+	unsigned long previous = load(last);
+
+	if (previous && now - previous < period)
+		return (false);
+	return (compareAndSwap(last, previous, now));
+}
+
+namespace
+{
+
+/**
+ * @brief Epoch record of a thread, reused by later threads once it exits.
+ */
+struct Participant
+{
+	unsigned long	epoch;
+	bool			inUse;
+	Participant		*next;
+};
+
+/**
+ * @brief Value waiting for the readers that may hold it to leave.
+ */
+struct Retired
+{
+	void			*ptr;
+	void			(*destroy)(void *);
+	unsigned long	epoch;
+	Retired			*next;
+};
+
+/**
+ * @brief Global epoch, advanced by every retirement.
+ */
+unsigned long		globalEpoch = 1;
+
+/**
+ * @brief Push-only list of the thread records.
+ */
+Participant			*participants = NULL;
+
+/**
+ * @brief Values retired and not yet destroyed, newest first.
+ */
+Retired				*retired = NULL;
+
+/**
+ * @brief Number of values in the retired list.
+ */
+std::size_t			retiredCount = 0;
+
+/**
+ * @brief Lock protecting the retired list.
+ */
+pthread_mutex_t		retiredLock = PTHREAD_MUTEX_INITIALIZER;
+
+/**
+ * @brief Record of the calling thread, NULL until its first guard.
+ */
+__thread Participant	*localParticipant = NULL;
+
+/**
+ * @brief Guard nesting depth of the calling thread.
+ */
+__thread unsigned int	localDepth = 0;
+
+/**
+ * @brief Key releasing a thread's record when the thread exits.
+ */
+pthread_key_t		participantKey;
+pthread_once_t		participantKeyOnce = PTHREAD_ONCE_INIT;
+
+/**
+ * @brief Marks the record of an exiting thread as reusable.
+ *
+ * @param participant The record.
+ */
+void	releaseParticipant(void *participant)
+{
+	Participant *record = static_cast<Participant *>(participant);
+	store(record->epoch, 0UL);
+	store(record->inUse, false);
+}
+
+/**
+ * @brief Creates the key releasing the thread records.
+ */
+void	createParticipantKey()
+{
+	pthread_key_create(&participantKey, releaseParticipant);
+}
+
+/**
+ * @brief Claims a free thread record, or registers a new one.
+ *
+ * @return The record of the calling thread.
+ */
+Participant	*acquireParticipant()
+{
+	Participant *record = NULL;
+	for (Participant *it = load(participants); it && !record; it = it->next)
+	{
+		if (!load(it->inUse) && compareAndSwap(it->inUse, false, true))
+			record = it;
+	}
+	if (!record)
+	{
+		record = new Participant();
+		record->epoch = 0;
+		record->inUse = true;
+		do
+			record->next = load(participants);
+		while (!compareAndSwap(participants, record->next, record));
+	}
+	pthread_once(&participantKeyOnce, createParticipantKey);
+	pthread_setspecific(participantKey, record);
+	return (record);
+}
+
+/**
+ * @brief Detaches the retired values no reader can hold any more.
+ *
+ * Must be called with the retired list locked.
+ *
+ * @return The detached values.
+ */
+Retired	*detachReclaimable()
+{
+	unsigned long oldest = ULONG_MAX;
+	for (Participant *it = load(participants); it; it = it->next)
+	{
+		unsigned long epoch = __atomic_load_n(&it->epoch, __ATOMIC_SEQ_CST);
+		if (epoch != 0 && epoch < oldest)
+			oldest = epoch;
+	}
+
+	Retired *reclaimable = NULL;
+	Retired **link = &retired;
+	while (*link)
+	{
+		Retired *node = *link;
+		if (node->epoch < oldest)
+		{
+			*link = node->next;
+			node->next = reclaimable;
+			reclaimable = node;
+			--retiredCount;
+		}
+		else
+			link = &node->next;
+	}
+	return (reclaimable);
+}
+
+/**
+ * @brief Destroys detached retired values.
+ *
+ * Runs without the retired list locked, since destroying a value may retire
+ * others.
+ *
+ * @param nodes The values to destroy.
+ */
+void	destroyRetired(Retired *nodes)
+{
+	while (nodes)
+	{
+		Retired *next = nodes->next;
+		nodes->destroy(nodes->ptr);
+		delete nodes;
+		nodes = next;
+	}
+}
+
+/**
+ * @brief Frees memory retired with Epoch::retireMemory().
+ *
+ * @param ptr The memory.
+ */
+void	freeMemory(void *ptr)
+{
+	::operator delete(ptr);
+}
+
+} // !namespace
+
+/**
+ * @brief Destroys every retired value no reader can hold any more.
+ */
+void	Epoch::collect()
+{
+	pthread_mutex_lock(&retiredLock);
+	Retired *reclaimable = detachReclaimable();
+	pthread_mutex_unlock(&retiredLock);
+	destroyRetired(reclaimable);
+}
+
+/**
+ * @brief Gets the number of retired values not yet destroyed.
+ *
+ * @return The number of pending values.
+ */
+std::size_t	Epoch::pending()
+{
+	pthread_mutex_lock(&retiredLock);
+	std::size_t count = retiredCount;
+	pthread_mutex_unlock(&retiredLock);
+	return (count);
+}
+
+/**
+ * @brief Enters a read-side critical section of the calling thread.
+ *
+ * The outermost guard announces the current epoch with a sequentially
+ * consistent exchange, so a writer scanning the records either sees it or
+ * has already unlinked what it retires before the guard's reads.
+ */
+void	Epoch::_enter()
+{
+	if (localDepth++ != 0)
+		return ;
+	if (!localParticipant)
+		localParticipant = acquireParticipant();
+	__atomic_exchange_n(&localParticipant->epoch, load(globalEpoch), __ATOMIC_SEQ_CST);
+}
+
+/**
+ * @brief Leaves a read-side critical section of the calling thread.
+ */
+void	Epoch::_leave()
+{
+	if (--localDepth == 0)
+		store(localParticipant->epoch, 0UL);
+}
+
+/**
+ * @brief Schedules the memory of a value already destroyed to be freed once
+ * no reader can hold it.
+ *
+ * For values whose destructor must run where they are unlinked, while
+ * readers may still load fields that the destructor leaves untouched.
+ *
+ * @param ptr The memory, allocated with operator new, or NULL.
+ */
+void	Epoch::retireMemory(void *ptr)
+{
+	if (ptr)
+		_retire(ptr, &freeMemory);
+}
+
+/**
+ * @brief Retires a value and destroys the retired values that became
+ * unreachable.
+ *
+ * @param ptr The value.
+ * @param destroy The function destroying it.
+ */
+void	Epoch::_retire(void *ptr, void (*destroy)(void *))
+{
+	Retired *node = new Retired();
+	node->ptr = ptr;
+	node->destroy = destroy;
+
+	pthread_mutex_lock(&retiredLock);
+	node->epoch = __atomic_fetch_add(&globalEpoch, 1UL, __ATOMIC_SEQ_CST);
+	node->next = retired;
+	retired = node;
+	++retiredCount;
+	Retired *reclaimable = detachReclaimable();
+	pthread_mutex_unlock(&retiredLock);
+	destroyRetired(reclaimable);
+}
+
+} // !sync
+} // !log42
+
+/* ************************************************************************** */
+/*                                                                            */
+/*                                MIT License                                 */
+/*                                                                            */
+/*   Copyright (c) 2025 Demont Pieric, Lucken Bénédict                        */
+/*                                                                            */
+/*   Inspired by the Python 'logging' module by Vinay Sajip.                  */
+/*   This implementation was rewritten in C++98 and contains no original      */
+/*   Python source code.                                                      */
+/*                                                                            */
+/*   Permission is hereby granted, free of charge, to any person obtaining    */
+/*   a copy of this software and associated documentation files (the          */
+/*   "Software"), to deal in the Software without restriction, including      */
+/*   without limitation the rights to use, copy, modify, merge, publish,      */
+/*   distribute, sublicense, and/or sell copies of the Software, and to       */
+/*   permit persons to whom the Software is furnished to do so, subject to    */
+/*   the following conditions:                                                */
+/*                                                                            */
+/*   The above copyright notice and this permission notice shall be included  */
+/*   in all copies or substantial portions of the Software.                   */
+/*                                                                            */
+/*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS  */
+/*   OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF               */
+/*   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.   */
+/*   IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY     */
+/*   CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,     */
+/*   TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE        */
+/*   SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                   */
+/*                                                                            */
+/* ************************************************************************** */
@@ -12,6 +12,8 @@
 
 #include <log42/Log42.hpp>
 #include <iostream>
+#include <sstream>
+#include <unistd.h>
 
 using namespace log42;
 using namespace log42::logger;
@@ -28,6 +30,20 @@ static void testBasicConfigErrors();
 static void testChildLogger();
 static void testPlaceHolder();
 static void testDisableLogs();
+static void testMessageArguments();
+static void testLoggerLookup();
+static void testTreeFootprint();
+static void testLoggerReclamation();
+static void testLoggerHandle();
+static void testCompiledFilters();
+static void testPredicateFilters();
+static void testRateLimit();
+static void testDeduplicator();
+static void testSampling();
+static void testConditionalMacros();
+static void testLogStream();
+static void testStructuredFields();
+static void testJsonFormatter();
 
 int main() {
 	testManualConfig();
@@ -38,6 +54,20 @@ int main() {
 	testChildLogger();
 	testPlaceHolder();
 	testDisableLogs();
+	testMessageArguments();
+	testLoggerLookup();
+	testTreeFootprint();
+	testLoggerReclamation();
+	testLoggerHandle();
+	testCompiledFilters();
+	testPredicateFilters();
+	testRateLimit();
+	testDeduplicator();
+	testSampling();
+	testConditionalMacros();
+	testLogStream();
+	testStructuredFields();
+	testJsonFormatter();
 	return 0;
 }
 
@@ -226,6 +256,540 @@ static void testDisableLogs()
 	}
 }
 
+static void testMessageArguments()
+{
+	std::cout << "\n===== TEST 9: Message arguments =====" << std::endl;
+	try {
+		common::core::raii::SharedPtr<logger::Logger> logger = Manager::getInstance().getLogger("argstest");
+		common::core::raii::SharedPtr<StreamHandler> ch = MAKE_SHARED(StreamHandler, std::cout);
+		Formatter fmt("[%(name)] %(levelname): %(message)");
+		ch->setFormatter(fmt);
+		logger->addHandler(common::core::raii::staticPointerCast<handler::Handler>(ch));
+		logger->setLevel(DEBUG);
+		disable(NOTSET);
+
+		std::string user = "marvin";
+		t_args legacy;
+		legacy.push_back("legacy");
+
+		INFO(logger, "%d items, %f%% done, flags 0x%x, user %s", 42, 12.5, 255u, user);
+		INFO(logger, "hex of -1: int 0x%x, long 0x%x", -1, -1L);
+		INFO(logger, "%s arguments still work", &legacy);
+		DEBUG(logger, "%d and %s left untouched");
+		DEBUG(logger, "100%% without arguments, %d%% with %s", 100, "arguments");
+		DEBUG(logger, "100%% without arguments");
+		for (int i = 0; i < 2; ++i)
+			INFO(logger, i ? "second text %d from one call site" : "first text %d from one call site", i);
+
+		shutdown();
+	} 
+	catch (const std::exception &e) 
+	{
+		std::cerr << "Test 9 failed: " << e.what() << std::endl;
+	}
+}
+
+static void testLoggerLookup()
+{
+	std::cout << "\n===== TEST 10: Logger lookup without reference =====" << std::endl;
+	try {
+		common::core::raii::SharedPtr<logger::Logger> logger = getLogger("lookup.service");
+		common::core::raii::SharedPtr<StreamHandler> ch = MAKE_SHARED(StreamHandler, std::cout);
+		Formatter fmt("[%(name)] %(levelname): %(message)");
+		ch->setFormatter(fmt);
+		logger->addHandler(common::core::raii::staticPointerCast<handler::Handler>(ch));
+
+		logger::Logger *found = getLoggerPtr("lookup.service");
+		logger::Logger *created = getLoggerPtr("lookup.service.tenant");
+		std::cout << "same logger: " << (found == logger.get() ? "yes" : "no") << std::endl;
+		std::cout << "root: " << (getLoggerPtr() == getLogger().get() ? "yes" : "no") << std::endl;
+		WARNING(created, "Message from a logger created by lookup");
+
+		shutdown();
+	} 
+	catch (const std::exception &e) 
+	{
+		std::cerr << "Test 10 failed: " << e.what() << std::endl;
+	}
+}
+
+static void testTreeFootprint()
+{
+	std::cout << "\n===== TEST 11: Tree footprint =====" << std::endl;
+	try {
+		manager::Manager &manager = manager::Manager::getInstance();
+		getLoggerPtr();
+		manager::Manager::Footprint before = manager.getFootprint();
+		getLoggerPtr("footprint.tenant.a");
+		getLoggerPtr("footprint.tenant.b");
+		manager::Manager::Footprint partial = manager.getFootprint();
+		getLoggerPtr("footprint.tenant");
+		manager::Manager::Footprint after = manager.getFootprint();
+
+		std::cout << "loggers: +" << partial.loggers - before.loggers
+			<< ", placeholders: +" << partial.placeholders - before.placeholders << std::endl;
+		std::cout << "after resolving: loggers +" << after.loggers - before.loggers
+			<< ", placeholders +" << after.placeholders - before.placeholders << std::endl;
+		std::cout << "bytes grew: " << (after.bytes > before.bytes ? "yes" : "no") << std::endl;
+
+		shutdown();
+	} 
+	catch (const std::exception &e) 
+	{
+		std::cerr << "Test 11 failed: " << e.what() << std::endl;
+	}
+}
+
+static void testLoggerReclamation()
+{
+	std::cout << "\n===== TEST 12: Logger reclamation =====" << std::endl;
+	try {
+		manager::Manager &manager = manager::Manager::getInstance();
+		common::core::raii::SharedPtr<logger::Logger> service = getLogger("reclaim.service");
+		common::core::raii::SharedPtr<StreamHandler> ch = MAKE_SHARED(StreamHandler, std::cout);
+		Formatter fmt("[%(name)] %(levelname): %(message)");
+		ch->setFormatter(fmt);
+		service->addHandler(common::core::raii::staticPointerCast<handler::Handler>(ch));
+
+		getLoggerPtr("reclaim.service.conn1.db");
+		getLoggerPtr("reclaim.service.conn2");
+		getLoggerPtr("reclaim.service.conn3")->setLevel(ERROR);
+		logger::Logger *held = retainLogger("reclaim.service.conn4");
+		common::core::raii::SharedPtr<logger::Logger> kept = getLogger("reclaim.service.conn5");
+
+		manager::Manager::Footprint before = manager.getFootprint();
+		std::cout << "reclaimed by the first sweep: " << reclaimLoggers() << std::endl;
+		std::cout << "reclaimed: " << reclaimLoggers() << std::endl;
+		manager::Manager::Footprint after = manager.getFootprint();
+		std::cout << "loggers: -" << before.loggers - after.loggers
+			<< ", placeholders: -" << before.placeholders - after.placeholders << std::endl;
+
+		WARNING(held, "Message from a retained logger");
+		WARNING(kept, "Message from a logger kept by getLogger()");
+		std::cout << "getLogger() result kept: " << (getLoggerPtr("reclaim.service.conn5") == kept.get() ? "yes" : "no") << std::endl;
+		held->release();
+		reclaimLoggers();
+		std::cout << "reclaimed after release: " << reclaimLoggers() << std::endl;
+		WARNING(getLoggerPtr("reclaim.service.conn1.db"), "Message from a recreated logger");
+		std::cout << "configured logger kept: " << (getLoggerPtr("reclaim.service.conn3")->getEffectiveLevel() == ERROR ? "yes" : "no") << std::endl;
+
+		shutdown();
+	} 
+	catch (const std::exception &e) 
+	{
+		std::cerr << "Test 12 failed: " << e.what() << std::endl;
+	}
+}
+
+static void logThroughHandle(int round)
+{
+	for (int i = 0; i < 3; ++i)
+	{
+		LOGGER_DEBUG("handle.service", "Hidden debug message %d", i);
+		LOGGER_INFO("handle.service", "Info message %d of round %d", i, round);
+		if (i == 1)
+			getLoggerPtr("handle.service")->setLevel(WARNING);
+	}
+}
+
+static void testLoggerHandle()
+{
+	std::cout << "\n===== TEST 13: Logger handle at the call site =====" << std::endl;
+	try {
+		for (int round = 0; round < 2; ++round)
+		{
+			common::core::raii::SharedPtr<logger::Logger> service = getLogger("handle.service");
+			common::core::raii::SharedPtr<StreamHandler> ch = MAKE_SHARED(StreamHandler, std::cout);
+			Formatter fmt("[%(name)] %(levelname): %(message)");
+			ch->setFormatter(fmt);
+			service->addHandler(common::core::raii::staticPointerCast<handler::Handler>(ch));
+			service->setLevel(INFO);
+
+			logThroughHandle(round);
+			LOGGER_WARNING("handle.service.child", "Warning from a child handle");
+
+			int evaluated = 0;
+			LOGGER_DEBUG("handle.service", "Never built %d", ++evaluated);
+			std::cout << "disabled arguments evaluated: " << evaluated << std::endl;
+
+			shutdown();
+		}
+	} 
+	catch (const std::exception &e) 
+	{
+		std::cerr << "Test 13 failed: " << e.what() << std::endl;
+	}
+}
+
+static void testCompiledFilters()
+{
+	std::cout << "\n===== TEST 14: Compiled filter sets =====" << std::endl;
+	try {
+		common::core::raii::SharedPtr<logger::Logger> service = getLogger("filters");
+		Formatter fmt("[%(name)] %(levelname): %(message)");
+
+		common::core::raii::SharedPtr<StreamHandler> nested = MAKE_SHARED(StreamHandler, std::cout);
+		nested->setFormatter(fmt);
+		nested->addFilter(filter::Filter("filters.net"));
+		nested->addFilter(filter::Filter("filters.net.http"));
+		service->addHandler(common::core::raii::staticPointerCast<handler::Handler>(nested));
+
+		common::core::raii::SharedPtr<StreamHandler> allowed = MAKE_SHARED(StreamHandler, std::cout);
+		allowed->setFormatter(Formatter("(allow-list) [%(name)] %(levelname): %(message)"));
+		allowed->setMatch(filter::ANY);
+		allowed->addFilter(filter::Filter("filters.db"));
+		allowed->addFilter(filter::Filter("filters.net.http"));
+		service->addHandler(common::core::raii::staticPointerCast<handler::Handler>(allowed));
+
+		WARNING(getLoggerPtr("filters.net"), "Message from the network");
+		WARNING(getLoggerPtr("filters.net.http"), "Message from HTTP");
+		WARNING(getLoggerPtr("filters.net.http2"), "Message from HTTP/2");
+		WARNING(getLoggerPtr("filters.db.pool"), "Message from the pool");
+		WARNING(getLoggerPtr("filters.dbx"), "Message from another subsystem");
+
+		shutdown();
+	} 
+	catch (const std::exception &e) 
+	{
+		std::cerr << "Test 14 failed: " << e.what() << std::endl;
+	}
+}
+
+static bool skipTests(const LogRecord &record, void *calls)
+{
+	++*static_cast<int *>(calls);
+	return (std::string(record.getFuncName()).find("Test") == std::string::npos);
+}
+
+static void testPredicateFilters()
+{
+	std::cout << "\n===== TEST 15: Predicate filters =====" << std::endl;
+	try {
+		common::core::raii::SharedPtr<logger::Logger> service = getLogger("predicates");
+		common::core::raii::SharedPtr<StreamHandler> ch = MAKE_SHARED(StreamHandler, std::cout);
+		ch->setFormatter(Formatter("[%(name)] %(levelname): %(message)"));
+		service->addHandler(common::core::raii::staticPointerCast<handler::Handler>(ch));
+
+		int calls = 0;
+		ch->addFilter(common::core::raii::SharedPtr<filter::Predicate>(new filter::MessageContains("noise", false)));
+		ch->addFilter(common::core::raii::SharedPtr<filter::Predicate>(new filter::CallbackPredicate(skipTests, &calls, 10, true)));
+		ch->addFilter(common::core::raii::SharedPtr<filter::Predicate>(new filter::LevelRange(INFO, ERROR)));
+		std::cout << "filters: " << ch->getFilterCount() << std::endl;
+
+		for (int i = 0; i < 3; ++i)
+		{
+			INFO(service, "Pass %d", i);
+			INFO(service, "Pass %d with noise", i);
+			CRITICAL(service, "Critical %d", i);
+		}
+		std::cout << "static callback calls: " << calls << std::endl;
+
+		shutdown();
+	} 
+	catch (const std::exception &e) 
+	{
+		std::cerr << "Test 15 failed: " << e.what() << std::endl;
+	}
+}
+
+
+static void testRateLimit()
+{
+	std::cout << "\n===== TEST 16: Rate limit =====" << std::endl;
+	try {
+		common::core::raii::SharedPtr<logger::Logger> service = getLogger("limited");
+		common::core::raii::SharedPtr<StreamHandler> ch = MAKE_SHARED(StreamHandler, std::cout);
+		ch->setFormatter(Formatter("[%(name)] %(levelname): %(message)"));
+		service->addHandler(common::core::raii::staticPointerCast<handler::Handler>(ch));
+		std::ostringstream unlimited;
+		service->addHandler(common::core::raii::staticPointerCast<handler::Handler>(MAKE_SHARED(StreamHandler, unlimited)));
+
+		filter::RateLimit *limit = new filter::RateLimit(10, 2);
+		ch->addFilter(common::core::raii::SharedPtr<filter::Predicate>(limit));
+
+		for (int round = 0; round < 2; ++round)
+		{
+			for (int i = 0; i < 5; ++i)
+				ERROR(service, "Round %d burst %d", round, i);
+			usleep(250000);
+		}
+		std::cout << "suppressed: " << limit->getSuppressed() << std::endl;
+		std::cout << "summary reached the unlimited handler: " << (unlimited.str().find("suppressed") != std::string::npos ? "yes" : "no") << std::endl;
+
+		shutdown();
+	} 
+	catch (const std::exception &e) 
+	{
+		std::cerr << "Test 16 failed: " << e.what() << std::endl;
+	}
+}
+
+
+static void testDeduplicator()
+{
+	std::cout << "\n===== TEST 17: Deduplicator =====" << std::endl;
+	try {
+		common::core::raii::SharedPtr<logger::Logger> service = getLogger("dedup");
+		std::ostringstream out;
+		common::core::raii::SharedPtr<StreamHandler> ch = MAKE_SHARED(StreamHandler, out);
+		ch->setFormatter(Formatter("[%(name)] %(levelname): %(message)"));
+		service->addHandler(common::core::raii::staticPointerCast<handler::Handler>(ch));
+
+		filter::Deduplicator *dedup = new filter::Deduplicator(0.2);
+		service->addFilter(common::core::raii::SharedPtr<filter::Predicate>(dedup));
+
+		for (int round = 0; round < 2; ++round)
+		{
+			for (int i = 0; i < 4; ++i)
+				WARNING(service, "Disk %s is full", "/var");
+			WARNING(service, "Round %d done", round);
+			usleep(250000);
+		}
+		std::string longText(300, 'x');
+		for (int i = 0; i < 3; ++i)
+			WARNING(service, "Long %s", longText);
+		WARNING(service, "Long run done");
+
+		std::istringstream lines(out.str());
+		std::string line;
+		while (std::getline(lines, line))
+		{
+			std::string::size_type between = line.find(" between");
+			if (between != std::string::npos)
+				line.erase(between, line.find(": ", between) - between);
+			if (line.size() > 120)
+				line = line.substr(0, 60) + " ... " + line.substr(line.size() - 12);
+			std::cout << line << std::endl;
+		}
+		std::cout << "collapsed: " << dedup->getCollapsed() << std::endl;
+
+		shutdown();
+	} 
+	catch (const std::exception &e) 
+	{
+		std::cerr << "Test 17 failed: " << e.what() << std::endl;
+	}
+}
+
+
+static void testSampling()
+{
+	std::cout << "\n===== TEST 18: Sampling =====" << std::endl;
+	try {
+		common::core::raii::SharedPtr<logger::Logger> service = getLogger("sampled");
+		common::core::raii::SharedPtr<StreamHandler> ch = MAKE_SHARED(StreamHandler, std::cout);
+		ch->setFormatter(Formatter("[%(name)] %(levelname): %(message)"));
+		service->addHandler(common::core::raii::staticPointerCast<handler::Handler>(ch));
+		service->setLevel(DEBUG);
+
+		common::core::raii::SharedPtr<filter::Sampler> everyThird(new filter::CountSampler(3));
+		service->setSampler(everyThird, INFO);
+		for (int i = 0; i < 7; ++i)
+		{
+			DEBUG(service, "Debug %d", i);
+			WARNING(service, "Warning %d", i);
+		}
+		std::cout << "1-in-3 sampled out: " << everyThird->getSampledOut() << std::endl;
+
+		common::core::raii::SharedPtr<filter::Sampler> none(new filter::RandomSampler(0.0));
+		service->setSampler(none);
+		for (int i = 0; i < 100; ++i)
+			DEBUG(service, "Never %d", i);
+		std::cout << "0% sampled out: " << none->getSampledOut() << std::endl;
+
+		common::core::raii::SharedPtr<filter::Sampler> reservoir(new filter::ReservoirSampler(2, 3600));
+		service->setSampler(reservoir);
+		for (int i = 0; i < 10; ++i)
+			DEBUG(service, "Reservoir %d", i);
+		std::cout << "reservoir sampled out: " << reservoir->getSampledOut() << std::endl;
+
+		service->setSampler(common::core::raii::SharedPtr<filter::Sampler>());
+		DEBUG(service, "Unsampled");
+
+		shutdown();
+	} 
+	catch (const std::exception &e) 
+	{
+		std::cerr << "Test 18 failed: " << e.what() << std::endl;
+	}
+}
+
+
+static int countEvaluation(int *evaluations, int value)
+{
+	++*evaluations;
+	return (value);
+}
+
+static logger::Logger *countLookup(int *lookups, logger::Logger *alogger)
+{
+	++*lookups;
+	return (alogger);
+}
+
+static void testConditionalMacros()
+{
+	std::cout << "\n===== TEST 19: Conditional macros =====" << std::endl;
+	try {
+		common::core::raii::SharedPtr<logger::Logger> service = getLogger("conditional");
+		common::core::raii::SharedPtr<StreamHandler> ch = MAKE_SHARED(StreamHandler, std::cout);
+		ch->setFormatter(Formatter("[%(name)] %(levelname): %(message)"));
+		service->addHandler(common::core::raii::staticPointerCast<handler::Handler>(ch));
+		service->setLevel(INFO);
+
+		int evaluations = 0;
+		for (int i = 0; i < 10; ++i)
+		{
+			LOG_EVERY_N(service, INFO, 4, "Every 4th: %d", countEvaluation(&evaluations, i));
+			LOG_FIRST_N(service, WARNING, 2, "First 2: %d", i);
+			LOG_EVERY_MS(service, WARNING, 60000, "Once a minute: %d", i);
+			LOG_IF(service, ERROR, i == 7, "Only at %d", i);
+			LOG_IF(service, DEBUG, true, "Disabled level: %d", countEvaluation(&evaluations, i));
+		}
+		std::cout << "argument evaluations: " << evaluations << std::endl;
+
+		int lookups = 0;
+		for (int i = 0; i < 3; ++i)
+		{
+			LOG_EVERY_N(service, INFO, 0, "Every 0th: %d", i);
+			LOG_IF(countLookup(&lookups, service.get()), WARNING, i == 1, "Looked up once: %d", i);
+		}
+		std::cout << "logger lookups: " << lookups << std::endl;
+
+		shutdown();
+	} 
+	catch (const std::exception &e) 
+	{
+		std::cerr << "Test 19 failed: " << e.what() << std::endl;
+	}
+}
+
+
+/**
+ * @brief Writes a list of ports, for LOG_WITH.
+ */
+struct PortList
+{
+	const int	*ports;
+	int			count;
+
+	void	operator()(std::ostream &out) const
+	{
+		out << "ports:";
+		for (int i = 0; i < this->count; ++i)
+			out << ' ' << this->ports[i];
+	}
+};
+
+static void testLogStream()
+{
+	std::cout << "\n===== TEST 20: Log stream =====" << std::endl;
+	try {
+		common::core::raii::SharedPtr<logger::Logger> service = getLogger("stream");
+		common::core::raii::SharedPtr<StreamHandler> ch = MAKE_SHARED(StreamHandler, std::cout);
+		ch->setFormatter(Formatter("[%(name)] %(levelname): %(message)"));
+		service->addHandler(common::core::raii::staticPointerCast<handler::Handler>(ch));
+		service->setLevel(INFO);
+
+		int evaluations = 0;
+		LOG_STREAM(service, INFO) << "took " << 12.5 << " ms, 100% done, " << countEvaluation(&evaluations, 3) << " retries";
+		LOG_STREAM(service, DEBUG) << "never built " << countEvaluation(&evaluations, 0);
+		std::cout << "argument evaluations: " << evaluations << std::endl;
+
+		const int ports[] = { 80, 443, 8080 };
+		PortList list = { ports, 3 };
+		LOG_WITH(service, WARNING, list);
+
+		logger::Logger *raw = service.get();
+		if (evaluations)
+			LOG_STREAM(raw, ERROR) << "inside an if";
+		else
+			std::cout << "dangling else" << std::endl;
+
+		shutdown();
+	} 
+	catch (const std::exception &e) 
+	{
+		std::cerr << "Test 20 failed: " << e.what() << std::endl;
+	}
+}
+
+static void testStructuredFields()
+{
+	std::cout << "\n===== TEST 21: Structured fields =====" << std::endl;
+	try {
+		common::core::raii::SharedPtr<logger::Logger> service = getLogger("fields");
+		common::core::raii::SharedPtr<StreamHandler> ch = MAKE_SHARED(StreamHandler, std::cout);
+		t_defaults defaults;
+		defaults["user"] = "-";
+		ch->setFormatter(Formatter("[%(name)] %(levelname) user=%(user) ms=%(ms) ok=%(ok) region=%(region) %(other): %(message)",
+			Formatter::defaultTimeFormat, true, defaults));
+		service->addHandler(common::core::raii::staticPointerCast<handler::Handler>(ch));
+		service->setLevel(INFO);
+		service->setField("region", "eu-west");
+
+		std::string user = "alice";
+		LOG_FIELDS(service, INFO, log42::Fields().add("user", user).add("ms", 12.5).add("ok", true), "login %s", "done");
+		LOG_FIELDS(service, WARNING, log42::Fields().add("ms", 250).add("region", "us-east"), "slow login");
+		INFO(service, "no call fields");
+
+		service->setField("region", "ap-south");
+		service->removeField("missing");
+		INFO(service, "replaced region, %d logger field", static_cast<int>(service->getFieldCount()));
+		service->clearFields();
+		INFO(service, "cleared, %d logger fields", static_cast<int>(service->getFieldCount()));
+
+		shutdown();
+	} 
+	catch (const std::exception &e) 
+	{
+		std::cerr << "Test 21 failed: " << e.what() << std::endl;
+	}
+}
+
+static void testJsonFormatter()
+{
+	std::cout << "\n===== TEST 22: JSON formatter =====" << std::endl;
+	try {
+		common::core::raii::SharedPtr<logger::Logger> service = getLogger("json");
+		common::core::raii::SharedPtr<StreamHandler> ch = MAKE_SHARED(StreamHandler, std::cout);
+		t_defaults defaults;
+		defaults["env"] = "test";
+		ch->setFormatter(formatter::JsonFormatter("%(levelname) %(name) %(message) %(lineno) %(env) %(user)",
+			formatter::JsonFormatter::defaultJsonTimeFormat, defaults));
+		service->addHandler(common::core::raii::staticPointerCast<handler::Handler>(ch));
+		service->setLevel(INFO);
+		service->setField("region", "eu-west");
+
+		INFO(service, "plain message, long enough to take the word-at-a-time path");
+		INFO(service, "quote \" backslash \\ tab \t newline \n bell \a and caf\xc3\xa9");
+		LOG_FIELDS(service, WARNING, log42::Fields().add("user", "bob").add("ms", 12.5).add("ok", false)
+			.add("retries", 3).add("path", "C:\\tmp\n").add("region", "us-east"), "%d fields", 6);
+
+		std::string line = formatter::JsonFormatter().format(logRecord::LogRecord("json", ERROR, "main.cpp", 1, "x", log42::Args()));
+		std::cout << "default members start with: " << line.substr(0, line.find(':')) << std::endl;
+
+		line = formatter::JsonFormatter("%(message) %(msecs)").format(logRecord::LogRecord("json", ERROR, "main.cpp", 1, "x", log42::Args()));
+		std::string msecs = line.substr(line.find("\"msecs\":") + 8);
+		msecs = msecs.substr(0, msecs.find('}'));
+		bool unpadded = !msecs.empty() && msecs.size() <= 3 && msecs.find_first_not_of("0123456789") == std::string::npos
+			&& (msecs == "0" || msecs[0] != '0');
+		std::cout << "msecs member: " << (unpadded ? "unpadded number" : msecs) << std::endl;
+
+		try {
+			formatter::JsonFormatter invalid("%(levelname)");
+		} catch (const std::invalid_argument &e) {
+			std::cout << "rejected: " << e.what() << std::endl;
+		}
+
+		shutdown();
+	} 
+	catch (const std::exception &e) 
+	{
+		std::cerr << "Test 22 failed: " << e.what() << std::endl;
+	}
+}
+
 /* ************************************************************************** */
 /*                                                                            */
 /*                                MIT License                                 */